@@ -0,0 +1,161 @@
+// ads1115.h
+#ifndef ADS1115_H
+#define ADS1115_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "calibration.h"
+
+// The ADS1115 as the logger uses it, described once: its data rates and gains with the codes of
+// their fields in the config register, and for each channel of the controller (VOLTAGE, CURRENT,
+// RESISTANCE) its input, its default gain and how its counts become volts, amperes or ohms.
+// Everything is constexpr, checked by the static_asserts below, and the nominal conversion of
+// every channel and gain is a function of its own (AdcConversion), with its constants folded.
+// A gain is an index in ADC_GAINS, the one of the SET_CONFIG command (command.h).
+
+struct AdcRate
+{
+    uint16_t samples; // Per second
+    uint16_t code;    // DR field
+};
+
+struct AdcGain
+{
+    uint16_t code;   // PGA field
+    float fullScale; // Volts
+};
+
+enum ADC_FORMULA
+{
+    ADC_PROPORTIONAL, // factor * volts - offset: divider on the input, or current transformer
+    ADC_DIVIDER       // The resistance that divides ADC_SUPPLY with factor ohms, less factor
+};
+
+struct AdcChannel
+{
+    const char *name;
+    uint16_t mux;    // MUX field: the input of the channel
+    uint8_t gain;    // Default, when the command channel chose none
+    float factor;    // See ADC_FORMULA
+    float offset;    // In the units of the channel
+    uint8_t formula; // ADC_FORMULA
+    uint8_t mode;    // Of the Measurement (model.h): 1 for the mean, 2 for the mean square
+};
+
+constexpr AdcRate ADC_RATES[] = {{8, 0x0000}, {16, 0x0020}, {32, 0x0040}, {64, 0x0060},
+                                 {128, 0x0080}, {250, 0x00A0}, {475, 0x00C0}, {860, 0x00E0}};
+constexpr AdcGain ADC_GAINS[] = {{0x0000, 6.144f}, {0x0200, 4.096f}, {0x0400, 2.048f},
+                                 {0x0600, 1.024f}, {0x0800, 0.512f}, {0x0A00, 0.256f}};
+constexpr float ADC_SUPPLY = 3.3f;
+constexpr AdcChannel ADC_CHANNELS[] = {
+    {"Voltage", 0x4000, 0, 4.334335237f, 0, ADC_PROPORTIONAL, 1}, // AIN0, (R1 + R2) / R2 of the divider
+    {"Current", 0x3000, 3, 30, 0, ADC_PROPORTIONAL, 2},           // AIN2 - AIN3, 30 A/V of the transformer
+    {"Resistance", 0x5000, 1, 999, 0, ADC_DIVIDER, 1}};           // AIN1, R3 between AIN1 and GND
+
+constexpr uint8_t ADC_RATE_COUNT = sizeof(ADC_RATES) / sizeof(ADC_RATES[0]);
+constexpr uint8_t ADC_GAIN_COUNT = sizeof(ADC_GAINS) / sizeof(ADC_GAINS[0]);
+constexpr uint8_t ADC_CHANNEL_COUNT = sizeof(ADC_CHANNELS) / sizeof(ADC_CHANNELS[0]);
+
+/**
+ * @brief Returns the volts of a count at a gain.
+ */
+constexpr float adcLsb(uint8_t gain)
+{
+    return ADC_GAINS[gain].fullScale / 32768;
+}
+
+/**
+ * @brief Returns the index of a rate in ADC_RATES, or -1 if the ADC has no such rate.
+ */
+constexpr int adcRateIndex(int samples, uint8_t from = 0)
+{
+    return from == ADC_RATE_COUNT ? -1 : ADC_RATES[from].samples == samples ? from : adcRateIndex(samples, from + 1);
+}
+
+constexpr bool adcRatesValid(uint8_t i = 0)
+{
+    return i == ADC_RATE_COUNT ||
+           (ADC_RATES[i].code == i << 5 && (i == 0 || ADC_RATES[i].samples > ADC_RATES[i - 1].samples) && adcRatesValid(i + 1));
+}
+
+constexpr bool adcGainsValid(uint8_t i = 0)
+{
+    return i == ADC_GAIN_COUNT ||
+           (ADC_GAINS[i].code == i << 9 && (i < 2 || ADC_GAINS[i].fullScale * 2 == ADC_GAINS[i - 1].fullScale) && adcGainsValid(i + 1));
+}
+
+constexpr bool adcChannelsValid(uint8_t i = 0)
+{
+    return i == ADC_CHANNEL_COUNT ||
+           (ADC_CHANNELS[i].gain < ADC_GAIN_COUNT && ADC_CHANNELS[i].factor > 0 && (ADC_CHANNELS[i].mode == 1 || ADC_CHANNELS[i].mode == 2) &&
+            (ADC_CHANNELS[i].mux & 0x7000) == ADC_CHANNELS[i].mux && adcChannelsValid(i + 1));
+}
+
+static_assert(adcRatesValid(), "ADC_RATES must be increasing, with the DR code of their index");
+static_assert(adcGainsValid(), "ADC_GAINS must halve the full scale from 4.096 V, with the PGA code of their index");
+static_assert(adcChannelsValid(), "ADC_CHANNELS need a gain of ADC_GAINS, a positive factor and a MUX code");
+static_assert(adcLsb(0) == 0.0001875f && adcLsb(3) == 0.00003125f, "A count is the full scale / 2^15");
+static_assert(ADC_RATES[ADC_RATE_COUNT - 1].samples == 860, "The acquisition is sized for at most 860 SPS");
+static_assert(ADC_CHANNEL_COUNT == CALIBRATION_CHANNELS, "A calibration curve per channel");
+static_assert(ADC_GAIN_COUNT == CALIBRATION_DEFAULT_GAIN && CALIBRATION_GAINS == ADC_GAIN_COUNT + 1,
+              "A calibration curve per gain, then one for the default gain");
+
+/**
+ * @brief Nominal conversion of the counts of a channel at a gain to the units of the channel.
+ *
+ * Specialized by formula: convert() has no branch, and curve() gives the same conversion as a
+ * CalibrationCurve, from which the tables of the acquisition are compiled.
+ */
+template <uint8_t channel, uint8_t gain, uint8_t formula = ADC_CHANNELS[channel].formula>
+struct AdcConversion;
+
+template <uint8_t channel, uint8_t gain>
+struct AdcConversion<channel, gain, ADC_PROPORTIONAL>
+{
+    static_assert(channel < ADC_CHANNEL_COUNT && gain < ADC_GAIN_COUNT, "No such channel or gain");
+
+    static constexpr float slope() { return adcLsb(gain) * ADC_CHANNELS[channel].factor; }
+
+    static float convert(float counts) { return counts * slope() - ADC_CHANNELS[channel].offset; }
+
+    static CalibrationCurve curve()
+    {
+        CalibrationCurve curve;
+        curve.kind = CURVE_POLYNOMIAL;
+        curve.count = 2;
+        curve.values[0] = -ADC_CHANNELS[channel].offset;
+        curve.values[1] = slope();
+        return curve;
+    }
+};
+
+template <uint8_t channel, uint8_t gain>
+struct AdcConversion<channel, gain, ADC_DIVIDER>
+{
+    static_assert(channel < ADC_CHANNEL_COUNT && gain < ADC_GAIN_COUNT, "No such channel or gain");
+
+    // factor * (ADC_SUPPLY / volts - 1), with volts = counts * adcLsb(gain)
+    static constexpr float numerator() { return ADC_CHANNELS[channel].factor * ADC_SUPPLY / adcLsb(gain); }
+
+    static float convert(float counts) { return numerator() / counts - ADC_CHANNELS[channel].factor - ADC_CHANNELS[channel].offset; }
+
+    static CalibrationCurve curve()
+    {
+        CalibrationCurve curve;
+        curve.kind = CURVE_INVERSE;
+        curve.count = 2;
+        curve.values[0] = -ADC_CHANNELS[channel].factor - ADC_CHANNELS[channel].offset;
+        curve.values[1] = numerator();
+        return curve;
+    }
+};
+
+// The AdcConversion of every channel and gain, by channel and gain
+struct AdcConversionEntry
+{
+    float (*convert)(float counts);
+    CalibrationCurve (*curve)();
+};
+
+extern const AdcConversionEntry ADC_CONVERSIONS[ADC_CHANNEL_COUNT][ADC_GAIN_COUNT];
+#endif // ADS1115_H
@@ -0,0 +1,33 @@
+// bitmap_rle.h
+#ifndef BITMAP_RLE_H
+#define BITMAP_RLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#define memcpy_P memcpy
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#endif
+
+// Size of a full 128x64 SSD1306 frame (8 pages of 128 columns)
+#define RLE_FRAME_SIZE 1024
+
+// Full-screen assets generated by tools/bitmap_rle.py (src/bitmap_assets.cpp)
+extern const unsigned char rle_Menu_1[];
+extern const unsigned char rle_Menu_2[];
+extern const unsigned char rle_Menu_3[];
+extern const unsigned char rle_Menu_4[];
+extern const unsigned char rle_Menu_5[];
+extern const unsigned char rle_Output_mode[];
+extern const unsigned char rle_Input_mode[];
+extern const unsigned char rle_sample_rate_set[];
+extern const unsigned char rle_logger[];
+extern const unsigned char rle_error_sdcard[];
+extern const unsigned char rle_error_serial[];
+extern const unsigned char rle_waiting_serial[];
+
+size_t rleDecode(const unsigned char *src, uint8_t *dst, size_t size);
+#endif // BITMAP_RLE_H
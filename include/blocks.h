@@ -0,0 +1,66 @@
+// blocks.h
+#ifndef BLOCKS_H
+#define BLOCKS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "codec.h"
+
+// A record of compressed samples, written to the SD card and, in compressed mode, to the
+// serial port. The header is little-endian and followed by `length` bytes of encodeBlock() output.
+// The CRC covers the header up to the crc field and the payload, so a torn or stale record
+// is recognised without decoding it.
+#define BLOCK_MAGIC 0xCD
+
+struct __attribute__((packed)) BlockHeader
+{
+    uint8_t magic;     // BLOCK_MAGIC
+    uint8_t flags;     // Reserved, 0
+    uint16_t length;   // Size of the compressed payload
+    uint16_t session;  // Number of the session file the record was written to, 0 on the serial port
+    uint32_t sequence; // Index of the record since the acquisition started
+    uint32_t first;    // Index of the first sample since the acquisition started
+    uint32_t time;     // Milliseconds since the acquisition started, at the first sample
+    uint32_t crc;      // CRC-32 of the fields above and of the payload
+};
+
+#define BLOCK_MAX_SIZE (sizeof(BlockHeader) + CODEC_MAX_SIZE)
+#define BLOCK_ANY_SESSION 0xFFFF // Accepted by checkRecord() in place of a session number
+
+int checkRecord(const uint8_t *data, size_t length, uint16_t session);
+
+// Range and sum of the samples of a record, kept by the block index (storage_format.h)
+struct BlockSummary
+{
+    uint16_t count;
+    int16_t minimum;
+    int16_t maximum;
+    int32_t sum;
+};
+
+void summarizeBlock(const int16_t *samples, uint16_t count, BlockSummary *summary);
+
+// Receives every complete record
+typedef void (*BlockSink)(const uint8_t *record, size_t length, const BlockSummary *summary);
+
+class BlockWriter
+{
+private:
+    BlockSink sink;
+    int16_t samples[CODEC_BLOCK_SAMPLES];
+    uint16_t count;     // Samples waiting in the block
+    uint16_t session;   // Stamped on every record
+    uint32_t sequence;  // Index of the next record
+    uint32_t first;     // Index of samples[0] since the acquisition started
+    uint32_t startTime; // Time the acquisition started
+    uint32_t blockTime; // Time of samples[0]
+
+public:
+    BlockWriter(BlockSink sink);
+    void reset(uint32_t now, uint16_t session);
+    void setSession(uint16_t session);
+    void insert(int16_t sample, uint32_t now);
+    void flush();
+    uint32_t getSampleCount();
+};
+#endif // BLOCKS_H
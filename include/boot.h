@@ -0,0 +1,60 @@
+// boot.h
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Timeline of the start-up of the logger: when each stage began and ended, in microseconds
+// since the firmware started, and how it ended. The stages on the I2C bus and the RTC run in
+// setup() while the card and the Wi-Fi come up in tasks of their own, so the stages overlap.
+// Each stage is written by the one task that runs it; a stage that its waiter gave up on is
+// marked BOOT_TIMEOUT and keeps that result if it ends later.
+#define BOOT_TIMELINE_TEXT 768 // Longest text of formatBootTimeline()
+
+enum BOOT_STAGE
+{
+    BOOT_SERIAL,
+    BOOT_PINS,    // Buttons, LEDs and buzzer
+    BOOT_SCREEN,
+    BOOT_ADC,
+    BOOT_RTC,
+    BOOT_SETTINGS,
+    BOOT_CONFIG,  // Configuration file on the card (config.h), when there is one
+    BOOT_CARD,    // Mount, recovery of the last session and calibration file
+    BOOT_WIFI,
+    BOOT_SAMPLE,  // First sample read from the ADC
+    BOOT_STAGES
+};
+
+enum BOOT_RESULT
+{
+    BOOT_NOT_RUN,
+    BOOT_RUNNING,
+    BOOT_OK,
+    BOOT_FAILED,
+    BOOT_TIMEOUT
+};
+
+struct BootStage
+{
+    uint32_t start;
+    uint32_t end;
+    volatile uint8_t result; // BOOT_RESULT
+};
+
+class BootTimeline
+{
+private:
+    BootStage stages[BOOT_STAGES];
+
+public:
+    BootTimeline();
+    void begin(BOOT_STAGE stage, uint32_t now);
+    void end(BOOT_STAGE stage, bool succeeded, uint32_t now);
+    void giveUp(BOOT_STAGE stage, uint32_t now);
+    uint8_t getResult(BOOT_STAGE stage) const { return stages[stage].result; }
+    const BootStage &getStage(BOOT_STAGE stage) const { return stages[stage]; }
+    size_t format(char *text, size_t size) const;
+};
+#endif // BOOT_H
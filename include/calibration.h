@@ -0,0 +1,97 @@
+// calibration.h
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Conversion of ADC counts to the units of a channel: volts, amperes or ohms at the terminals.
+//
+// A curve can be given for every channel and gain in CALIBRATION_FILE on the card, one per line:
+//   voltage 0 poly -0.0025 0.000812659 [c2 [c3]]     value = c0 + c1 x + c2 x^2 + c3 x^3
+//   resistance default inverse -999 26373600         value = c0 + c1 / x
+//   current 3 table 0:0 1000:0.93 32767:30.6         straight lines through the points
+// where x is in counts (for the current, the RMS of the counts of a window), the channel is
+// named as in the menu, and the gain is its index in the SET_CONFIG command (command.h) or
+// "default" for the default gain of the channel. Lines starting with '#' are comments. A curve
+// of the configuration file (config.h) takes the place of the file's, and one fitted on the
+// logger by the CALIBRATE command (fitCurve) that of both; the channels and gains without a
+// curve use their nominal conversion.
+//
+// The curve of an acquisition is compiled by CalibrationTable into a table of fixed-point
+// values, so that converting a sample is a lookup and a linear interpolation, cheap enough
+// for every sample at the full rate. For each sign, the nodes are 1 count apart below
+// CALIBRATION_LINEAR, then CALIBRATION_OCTAVE_NODES per octave: the spacing grows with the
+// counts, which keeps the relative error of the interpolation constant for curves like 1/x.
+#define CALIBRATION_FILE "/calibration.txt"
+#define CALIBRATION_FILE_SIZE 4096 // Longest file read
+#define CALIBRATION_CHANNELS 3     // VOLTAGE, CURRENT and RESISTANCE of the controller
+#define CALIBRATION_GAINS 7        // The gains of the command channel, then the default one
+#define CALIBRATION_DEFAULT_GAIN 6
+#define CALIBRATION_MAX_POINTS 16  // Of a "table" curve
+#define CALIBRATION_CURVE_TEXT_SIZE 528 // formatCurve() of a table of CALIBRATION_MAX_POINTS points
+
+#define CALIBRATION_OCTAVE_BITS 5
+#define CALIBRATION_LINEAR (1 << CALIBRATION_OCTAVE_BITS) // 32
+#define CALIBRATION_OCTAVE_NODES (1 << CALIBRATION_OCTAVE_BITS)
+// 32 nodes below CALIBRATION_LINEAR, 10 octaves up to 32768, the node of 32768 and one past it
+#define CALIBRATION_NODES (CALIBRATION_LINEAR + (15 - CALIBRATION_OCTAVE_BITS) * CALIBRATION_OCTAVE_NODES + 2)
+
+enum CURVE_KIND
+{
+    CURVE_NONE,       // Not calibrated: the nominal conversion of the channel
+    CURVE_POLYNOMIAL, // values[] are the coefficients, from degree 0
+    CURVE_INVERSE,    // values[0] + values[1] / x
+    CURVE_TABLE       // Points (counts[i], values[i]) in increasing counts
+};
+
+struct CalibrationCurve
+{
+    uint8_t kind;  // CURVE_KIND
+    uint8_t count; // Coefficients or points
+    float counts[CALIBRATION_MAX_POINTS];
+    float values[CALIBRATION_MAX_POINTS];
+};
+
+float evaluateCurve(const CalibrationCurve &curve, float counts);
+bool isValidCurve(const CalibrationCurve &curve);
+bool parseCurve(const char *text, CalibrationCurve *curve);
+char *formatCurve(char *buffer, const CalibrationCurve &curve);
+bool parseCalibrationLine(const char *line, uint8_t *channel, uint8_t *gain, CalibrationCurve *curve);
+int parseCalibration(const char *text, CalibrationCurve curves[CALIBRATION_CHANNELS][CALIBRATION_GAINS], int *errorLine);
+bool fitCurve(const float *counts, const float *values, uint8_t points, uint8_t degree, CalibrationCurve *curve, float *residual);
+
+class CalibrationTable
+{
+private:
+    int32_t positive[CALIBRATION_NODES]; // At the counts of the nodes
+    int32_t negative[CALIBRATION_NODES]; // At minus the counts of the nodes
+    float unit;                          // Value of 1 in the table
+
+    static float nodeCounts(uint16_t node);
+
+public:
+    CalibrationTable();
+    void compile(const CalibrationCurve &curve);
+    float getError(const CalibrationCurve &curve) const;
+    float getUnit() const { return unit; }
+    float convert(float counts) const;
+
+    /**
+     * @brief Converts a sample, in units of getUnit().
+     */
+    int32_t convert(int16_t sample) const
+    {
+        const int32_t *nodes = sample < 0 ? negative : positive;
+        uint32_t magnitude = sample < 0 ? -(int32_t)sample : sample;
+        if (magnitude < CALIBRATION_LINEAR)
+            return nodes[magnitude];
+        uint8_t octave = 31 - __builtin_clz(magnitude);
+        uint8_t shift = octave - CALIBRATION_OCTAVE_BITS;
+        uint16_t node = (octave - CALIBRATION_OCTAVE_BITS) * CALIBRATION_OCTAVE_NODES + (magnitude >> shift);
+        int32_t low = nodes[node];
+        int32_t step = nodes[node + 1] - low;
+        return low + (int32_t)(((int64_t)step * (magnitude & ((1U << shift) - 1))) >> shift);
+    }
+};
+#endif // CALIBRATION_H
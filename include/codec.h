@@ -0,0 +1,30 @@
+// codec.h
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Lossless codec for blocks of raw ADC samples.
+//
+// Every block starts with a method byte: the low nibble is the predictor order (0 keeps
+// the samples verbatim, 1 codes x[n] - x[n-1], 2 codes x[n] - 2x[n-1] + x[n-2]), the high
+// nibble is the Rice parameter k. A little-endian sample count follows, then the residuals,
+// zigzag mapped and Rice coded MSB first. Residuals whose quotient reaches CODEC_ESCAPE
+// (always the case for the first samples of a block, which are predicted from zero) are
+// written as CODEC_ESCAPE one bits followed by the value in CODEC_ESCAPE_BITS bits.
+
+#define CODEC_BLOCK_SAMPLES 256 // Largest block
+#define CODEC_HEADER_SIZE 3
+#define CODEC_MAX_SIZE (CODEC_HEADER_SIZE + 2 * CODEC_BLOCK_SAMPLES) // A block never grows past verbatim
+
+#define CODEC_VERBATIM 0
+#define CODEC_DELTA1 1
+#define CODEC_DELTA2 2
+#define CODEC_MAX_K 15
+#define CODEC_ESCAPE 24
+#define CODEC_ESCAPE_BITS 20 // A zigzagged second-order residual of int16 samples needs 19 bits
+
+size_t encodeBlock(const int16_t *samples, uint16_t count, uint8_t *out);
+int decodeBlock(const uint8_t *in, size_t length, int16_t *samples, uint16_t capacity);
+#endif // CODEC_H
@@ -0,0 +1,97 @@
+// command.h
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary command channel on the serial port, next to the sample stream.
+//
+// A frame is a start byte, a command code, a payload length, the payload and the CRC-32
+// (crc32.h, little-endian) of the code, the length and the payload. The PC sends requests
+// starting with COMMAND_REQUEST; the logger answers every one with a frame starting with
+// COMMAND_REPLY, the same code with COMMAND_REPLY_FLAG set, and a payload whose first byte is
+// a COMMAND_STATUS. All numbers in the payloads are little-endian. Device times are
+// microseconds since boot.
+#define COMMAND_REQUEST 0xA5
+#define COMMAND_REPLY 0xA6
+#define COMMAND_REPLY_FLAG 0x80
+#define COMMAND_MAX_PAYLOAD 32
+#define COMMAND_OVERHEAD 7 // Start, code, length and CRC
+#define COMMAND_MAX_FRAME (COMMAND_OVERHEAD + COMMAND_MAX_PAYLOAD)
+#define COMMAND_TIMEOUT 100 // Milliseconds after which an incomplete frame is dropped
+#define COMMAND_VERSION 1
+
+// Command codes, with their request and reply payloads (after the status byte)
+#define COMMAND_PING 0x01            // -> u8 protocol version
+#define COMMAND_GET_STATUS 0x02      // -> u8 mode, u8 channel, u16 rate, u8 gain, u8 acquiring, u16 session, u32 samples, u32 uptime ms
+#define COMMAND_SET_CONFIG 0x03      // u8 mode, u8 channel, u16 rate, u8 gain (COMMAND_GAIN_DEFAULT for the channel's) ->
+#define COMMAND_START 0x04           // [u8 compressed] ->
+#define COMMAND_STOP 0x05            // -> u32 samples
+#define COMMAND_GET_COUNTERS 0x06    // -> u32 samples, u32 records, u32 commands, u32 rejected frames, u32 dropped batches, u32 dropped samples
+#define COMMAND_GET_CALIBRATION 0x07 // -> f32 gain (volts per count), f32 offset, f32 factor, u8 curve (calibration.h), f32 table error
+#define COMMAND_TIME_SYNC 0x08       // u64 host time -> u64 host time (echoed), u64 device time at reception, u64 device time at reply
+#define COMMAND_TIME_MARK 0x09       // Not a request: sent by the logger once per second while streaming, -> u32 sample, u64 device time of that sample
+#define COMMAND_SET_BAUD 0x0A        // u32 baud -> (the reply is sent at the old speed)
+#define COMMAND_BENCHMARK 0x0B       // u32 bytes -> u32 bytes, u32 microseconds; the bytes of a test pattern come before the reply
+#define COMMAND_GET_TRANSFERS 0x0C   // -> u32 missed samples, u32 longest web poll us, u32 downloads started, u32 completed, u32 bytes, u32 ms
+#define COMMAND_GET_METRICS 0x0D     // u16 offset -> u16 length, the text of GET /metrics (metrics.h) from offset, 29 bytes at most;
+                                     // offset 0 takes a new snapshot of at most COMMAND_METRICS_TEXT bytes, read on by the next requests
+#define COMMAND_CALIBRATE 0x0E       // u8 step (CALIBRATE_STEP), then its request -> its reply, see below
+#define COMMAND_SET_AUTOSTART 0x0F   // u8 enabled -> (saved with the configuration, settings.h)
+#define COMMAND_GET_BOOT 0x10        // u16 offset -> like GET_METRICS, with the text of the boot timeline (boot.h)
+#define COMMAND_SPECTRUM 0x11        // u16 size, u8 window (spectrum.h) -> (the spectrum mode starts from the main loop and
+                                     // sends a record every size / 2 samples); size 0 leaves it
+
+#define COMMAND_METRICS_TEXT 4096
+
+#define COMMAND_GAIN_DEFAULT 0xFF
+
+// Steps of the guided calibration of the current channel and gain: the operator applies a known
+// input, CALIBRATE_POINT averages a number of windows of its counts (the RMS of the counts for
+// the current), and once every reference is measured CALIBRATE_FIT fits the curve (calibration.h)
+// and keeps it in NVS. Only CALIBRATE_CLEAR is allowed while acquiring.
+enum CALIBRATE_STEP
+{
+    CALIBRATE_BEGIN = 0,  // u8 windows per point, u8 degree from 1 to 3 -> (the routine starts from the main loop)
+    CALIBRATE_POINT = 1,  // f32 reference value -> (its windows are averaged from the next one)
+    CALIBRATE_STATUS = 2, // -> u8 running, u8 points measured, u8 measuring, u8 windows averaged, f32 counts of the last point
+    CALIBRATE_FIT = 3,    // -> u8 coefficients, f32 each from degree 0, f32 RMS residual; the curve is saved and the routine ends
+    CALIBRATE_CANCEL = 4, // -> (the routine ends, nothing is saved)
+    CALIBRATE_CLEAR = 5   // -> (the curve saved for the current channel and gain is removed)
+};
+
+enum COMMAND_STATUS
+{
+    COMMAND_OK = 0,
+    COMMAND_UNKNOWN = 1, // Unknown command code
+    COMMAND_INVALID = 2, // Malformed payload or value out of range
+    COMMAND_BUSY = 3     // Not allowed while acquiring
+};
+
+enum COMMAND_PARSE
+{
+    COMMAND_NONE,    // The byte is not part of a frame
+    COMMAND_PENDING, // The byte belongs to an incomplete frame
+    COMMAND_READY,   // A valid frame is complete
+    COMMAND_REJECTED // A frame was complete but its CRC or length was wrong
+};
+
+class CommandParser
+{
+private:
+    uint8_t frame[COMMAND_MAX_FRAME];
+    uint8_t received;  // Bytes of the current frame, 0 when waiting for a start byte
+    uint8_t start;     // Start byte accepted
+    uint32_t lastByte; // Time of the last byte of the current frame
+
+public:
+    CommandParser(uint8_t start);
+    COMMAND_PARSE feed(uint8_t byte, uint32_t now);
+    uint8_t getCommand() const;
+    uint8_t getLength() const;
+    const uint8_t *getPayload() const;
+};
+
+size_t encodeCommand(uint8_t start, uint8_t command, const uint8_t *payload, uint8_t length, uint8_t *out);
+#endif // COMMAND_H
@@ -0,0 +1,81 @@
+// config.h
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "calibration.h"
+#include "settings.h"
+
+// Configuration of the logger from CONFIG_FILE on the card, read at boot after the settings kept
+// in NVS, which it overrides. The file is one JSON object whose members are all optional:
+//   {
+//     "version": 1,
+//     "channel": "voltage",                     "voltage", "current" or "resistance"
+//     "rate": 860,                              samples per second, one of the rates of the ADC
+//     "gain": "default",                        index in the gains of SET_CONFIG (command.h), or "default"
+//     "autostart": false,                       start logging at boot, without the menu
+//     "rotation": {"megabytes": 64, "minutes": 60},
+//     "sinks": {"output": "sd", "compressed": false, "mqtt_raw": false},
+//     "calibration": [
+//       {"channel": "voltage", "gain": "default", "poly": [-0.0025, 0.000812659]},
+//       {"channel": "resistance", "gain": 1, "inverse": [-999, 26373600]},
+//       {"channel": "current", "gain": 3, "table": [[0, 0], [1000, 0.93], [32767, 30.6]]}
+//     ]
+//   }
+// where the output is "display", "serial" or "sd" (the MODE of the controller), "compressed"
+// sends compressed blocks on the serial port and "mqtt_raw" publishes the samples to the broker
+// too. The curves are those of the calibration file (calibration.h) and take its place.
+//
+// The file is read through a CONFIG_READ_BUFFER buffer into a JSON document of CONFIG_POOL_SIZE
+// bytes, allocated once, so neither grows with the file: a file too large for the pool is
+// rejected. A file that breaks the schema (unknown member, wrong type, value out of range) is
+// rejected as a whole, and the logger keeps its settings.
+#define CONFIG_FILE "/config.json"
+#define CONFIG_VERSION 1
+#define CONFIG_POOL_SIZE 8192 // Bytes of the JSON document
+#define CONFIG_READ_BUFFER 64 // Bytes read from the file at a time
+#define CONFIG_NESTING 5      // Deepest nesting of arrays and objects, that of the points of a "table"
+#define CONFIG_ERROR_SIZE 96  // Longest message of parseConfig()
+
+// What the file describes, on top of the values given to parseConfig()
+struct LoggerConfig
+{
+    Settings settings;       // settings.h
+    uint32_t rotateSize;     // Bytes of a session file (storage.h)
+    uint32_t rotateDuration; // Milliseconds of a session file
+    bool mqttRaw;            // Publish the samples to the MQTT broker too
+    CalibrationCurve curves[CALIBRATION_CHANNELS][CALIBRATION_GAINS]; // CURVE_NONE where not given
+};
+
+// What the logger can do, against which the file is checked besides the rates and gains of
+// the ADC (ads1115.h)
+struct ConfigLimits
+{
+    uint32_t maxRotateSize; // Bytes
+};
+
+// Bytes of the file, read in CONFIG_READ_BUFFER chunks by fill(); the parser reads it one
+// character at a time through read()
+class ConfigSource
+{
+private:
+    char buffer[CONFIG_READ_BUFFER];
+    size_t length;
+    size_t position;
+    uint32_t total;
+
+protected:
+    virtual size_t fill(char *data, size_t size) = 0;
+
+public:
+    ConfigSource();
+    virtual ~ConfigSource() {}
+    int read();
+    size_t readBytes(char *data, size_t size);
+    uint32_t getTotal() const { return total; }
+};
+
+bool parseConfig(ConfigSource &source, const ConfigLimits &limits, LoggerConfig *config, size_t *poolUsed,
+                 char *error, size_t errorSize);
+#endif // CONFIG_H
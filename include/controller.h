@@ -6,7 +6,10 @@
 #include "view.h"
 #include <Adafruit_ADS1X15.h>
 #include <SD.h>
+#include <Ds1302.h>
 #include "model.h"
+#include "format.h"
+#include "calibration.h"
 
 // Dichiazione enum
 enum MODE
@@ -31,24 +34,45 @@ extern int scrollFrequency;
 extern int scrollDuration;
 extern int selectFrequency;
 extern int selectDuration;
+extern Ds1302 rtc;
 
 // Dichiarazione delle funzioni
 void initializeSerial();
 boolean initializeOutputDevices();
 boolean initializeInputDevices();
 boolean ADCinitialize();
+boolean isAdcReady();
+boolean isCardReady();
+void printBootTimeline();
 boolean initializeSDcard();
 void logfileSDcard();
+void loadCalibration();
+boolean loadConfig();
 void writeFile(fs::FS &fs, const char *path, const char *message);
 void appendFile(fs::FS &fs, const char *path, const char *message);
 boolean initializeRTC();
+boolean initializeWifi();
+void pollWebClients();
 boolean initializeDevices();
 boolean goUp();
 boolean goDown();
 boolean select();
+void pollSerialInput();
+boolean takeKey(char key);
+boolean isStartRequested();
+void endAcquisition();
+void executeCommand();
+void sendSerialHeader();
+uint64_t deviceMicros();
+void sendTimeMark(uint32_t sample, uint32_t time);
+boolean serialSend(const uint8_t *data, size_t length);
+void flushSerialBatch();
+uint32_t serialBenchmark(uint32_t bytes);
 void soundBuzzer(int frequency, int duration);
-String getTimeStamp();
-String getDateStamp();
+char *getTimeStamp(char *buffer);
+char *getDateStamp(char *buffer);
+uint32_t getUnixTime();
+void endWindow(float value);
 void loggerActDisplay();
 void loggerActSerial();
 void loggerActSD();
@@ -58,8 +82,27 @@ void infoAct(boolean subSetup);
 void sampleSetAct();
 void setRate(uint16_t value);
 float conversionMeasurement();
+void selectCalibration();
+void calibrateSample(int16_t value);
+boolean readFittedCurve(CalibrationCurve *curve);
+boolean writeFittedCurve(const CalibrationCurve *curve);
+boolean isCalibrationRequested();
+void beginCalibration();
+void calibrationAct();
+boolean isCalibrating();
+void endCalibration();
+boolean isSpectrumRequested();
+void beginSpectrum();
+void spectrumAct();
+boolean isAnalyzing();
+void endSpectrum();
+boolean loadSettings();
+void saveSettings();
 float currentFactor();
 boolean preliminaryControl();
 void adcSetup();
 void setChannel(CHANNEL channel);
+uint8_t channelGain();
+float calculateCoefficient();
+float calculateOffset();
 #endif // CONTROLLER_H
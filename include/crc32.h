@@ -0,0 +1,11 @@
+// crc32.h
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-32 as used by zip and Ethernet (reflected polynomial 0xEDB88320).
+// Pass the previous result as crc to checksum data in pieces, 0 to start.
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length);
+#endif // CRC32_H
@@ -0,0 +1,25 @@
+// downloads.h
+#ifndef DOWNLOADS_H
+#define DOWNLOADS_H
+
+#include <Arduino.h>
+#include "webserver.h"
+
+// The sessions of the SD card over HTTP (webserver.h), while the logger goes on acquiring.
+//
+//   GET /sessions                       The lines of SESSION_INDEX as a JSON array, sent in chunks
+//   GET /session?name=N                 The session file N (0001_241019_123000.ds32) as it is
+//   GET /session?name=N&from=A&to=B     The records of N from A to B milliseconds after its start,
+//                                       behind its text header: a .ds32 file of its own
+//
+// A time range is widened to whole entries of the block index (storage_format.h), and the
+// records of a raw session are sent without their sector footers, as a File session. Files
+// are read HTTP_SOURCE_CHUNK bytes at a time straight into the transmit queue of the client,
+// never as a whole. Both forms take one Range (bytes=A-B, A- or -N) and If-Range with their
+// ETag, so that a transfer cut short can be resumed; the session being written answers 409.
+#define DOWNLOAD_NAME_SIZE 32
+
+void serveSessionList(HttpServer &server, int client, const HttpRequest &request);
+void serveSession(HttpServer &server, int client, const HttpRequest &request);
+void getDownloadCounters(uint32_t *started, uint32_t *completed, uint32_t *bytes, uint32_t *milliseconds);
+#endif // DOWNLOADS_H
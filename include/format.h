@@ -0,0 +1,23 @@
+// format.h
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdint.h>
+
+// Buffer sizes (including the terminator) for the fixed-width stamps
+#define TIMESTAMP_SIZE 9  // HH:MM:SS
+#define DATESTAMP_SIZE 11 // MM/DD/YYYY
+
+// Longest output of formatInt()/formatUInt()/formatFixed(), including the terminator
+#define FORMAT_NUMBER_SIZE 24
+
+// Every function writes into the caller's buffer, terminates it and returns a pointer
+// to the terminator, so that calls can be chained without measuring the string again.
+char *formatString(char *buffer, const char *text);
+char *formatUInt(char *buffer, uint32_t value);
+char *formatInt(char *buffer, int32_t value);
+char *formatFixed(char *buffer, float value, uint8_t decimals);
+char *formatEngineering(char *buffer, float value, uint8_t decimals, char *prefix);
+char *formatTime(char *buffer, uint8_t hour, uint8_t minute, uint8_t second);
+char *formatDate(char *buffer, uint8_t month, uint8_t day, uint16_t year);
+#endif // FORMAT_H
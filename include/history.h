@@ -0,0 +1,47 @@
+// history.h
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The last samples of the acquisition, kept in a ring for the chart of the web page, and
+// their reduction to a fixed number of points for a window of any length.
+//
+// LTTB (Largest-Triangle-Three-Buckets) keeps one real sample per bucket, the one forming
+// the largest triangle with the point kept in the previous bucket and the average of the
+// next bucket, so the shape of the signal survives; min/max keeps the range of every bucket,
+// so no spike is lost. Both walk the ring where it is, bucket after bucket, into arrays
+// supplied by the caller: nothing is copied or allocated, and the work depends on the length
+// of the window only, the output on the number of points only.
+#ifndef HISTORY_SAMPLES
+#define HISTORY_SAMPLES 16384 // Power of two; 19 s at 860 SPS, 34 min at 8 SPS
+#endif
+#define HISTORY_MAX_POINTS 1024
+
+#if (HISTORY_SAMPLES & (HISTORY_SAMPLES - 1)) != 0 || HISTORY_SAMPLES > 65536
+#error "HISTORY_SAMPLES must be a power of two, at most 65536 (offsets are 16 bits)"
+#endif
+
+class SampleHistory
+{
+private:
+    int16_t samples[HISTORY_SAMPLES];
+    uint32_t next; // Index of the next sample since the acquisition started
+
+public:
+    SampleHistory();
+    void reset();
+    void insert(int16_t sample)
+    {
+        samples[next & (HISTORY_SAMPLES - 1)] = sample;
+        next++;
+    }
+    uint32_t getNext() const;
+    uint32_t getRetained() const;
+    int16_t at(uint32_t index) const;
+
+    uint16_t downsampleLttb(uint32_t first, uint32_t count, uint16_t points, uint16_t *offsets, int16_t *values) const;
+    uint16_t downsampleMinMax(uint32_t first, uint32_t count, uint16_t buckets, int16_t *minima, int16_t *maxima) const;
+};
+#endif // HISTORY_H
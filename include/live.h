@@ -0,0 +1,101 @@
+// live.h
+#ifndef LIVE_H
+#define LIVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "webserver.h"
+#include "history.h"
+
+// Live view of the acquisition for the browsers connected to the WebSocket (webserver.h).
+//
+// Samples are sent as raw ADC counts in batches of LIVE_BATCH_SAMPLES, and the statistics of
+// every measurement window (one array of Measurement, a second of samples) when it ends. The
+// description of the acquisition is sent when it starts, when it ends and to every browser
+// that connects, so the page can convert the counts. Messages are little-endian.
+//
+// The samples are also kept in a SampleHistory, from which /chart answers the chart of the
+// page with a fixed number of points for the last seconds: GET /chart?seconds=S&points=P&mode=M,
+// S = 0 for everything retained, M = "lttb" (default) or "minmax". The answer is a ChartHeader
+// followed, for LTTB, by u16 offsets in the window then i16 values, for min/max by i16 minima
+// then i16 maxima of equal buckets.
+#define LIVE_BATCH_SAMPLES 64
+
+#define LIVE_CONFIG 0x01
+#define LIVE_SAMPLES 0x02
+#define LIVE_STATS 0x03
+
+#define CHART_LTTB 0
+#define CHART_MINMAX 1
+#define CHART_DEFAULT_POINTS 400
+
+struct __attribute__((packed)) LiveConfig
+{
+    uint8_t type;      // LIVE_CONFIG
+    uint8_t channel;   // CHANNEL of the controller
+    uint16_t rate;     // Samples per second
+    float gain;        // Volts per count
+    float offset;      // Subtracted from the converted value
+    float factor;      // Divider or shunt factor of the channel
+    uint8_t acquiring; // 1 while samples are being sent
+};
+
+struct __attribute__((packed)) LiveSamples
+{
+    uint8_t type;   // LIVE_SAMPLES
+    uint8_t flags;  // Reserved, 0
+    uint16_t count; // Samples in the batch
+    uint32_t first; // Index of samples[0] since the acquisition started
+    int16_t samples[LIVE_BATCH_SAMPLES];
+};
+
+struct __attribute__((packed)) LiveStats
+{
+    uint8_t type;   // LIVE_STATS
+    uint8_t flags;  // Reserved, 0
+    uint16_t count; // Samples in the window
+    uint32_t first; // Index of the first sample of the window
+    float value;    // Measurement shown on the display for the window
+    float mean;     // In counts
+    float deviation;
+    int16_t minimum;
+    int16_t maximum;
+};
+
+struct __attribute__((packed)) ChartHeader
+{
+    uint8_t mode;    // CHART_LTTB or CHART_MINMAX
+    uint8_t channel; // CHANNEL of the controller
+    uint16_t points; // Points, or buckets
+    uint32_t first;  // Index of the first sample of the window since the acquisition started
+    uint32_t count;  // Samples in the window
+    uint16_t rate;   // Samples per second
+    uint16_t flags;  // Reserved, 0
+    float scale;     // Input units (volts at the terminals) per count: gain times factor
+};
+
+class LiveStream
+{
+private:
+    HttpServer &server;
+    SampleHistory history;
+    LiveConfig config;
+    LiveSamples batch;
+    uint32_t next; // Index of the next sample
+    LiveStats window;
+    LiveStats ended; // The last window, as it was sent
+    int64_t sum;
+    uint64_t squares;
+
+public:
+    LiveStream(HttpServer &server);
+    void begin(uint8_t channel, uint16_t rate, float gain, float offset, float factor);
+    void end();
+    void greet(int client);
+    void insert(int16_t sample);
+    const LiveStats *endWindow(float value);
+    void flush();
+    void sendChart(int client, const HttpRequest &request);
+    const SampleHistory &getHistory() const { return history; }
+};
+#endif // LIVE_H
@@ -0,0 +1,104 @@
+// metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "webserver.h"
+
+// Health and performance metrics of the logger, read by GET /metrics in the OpenMetrics text
+// format (what Prometheus scrapes) and by the GET_METRICS serial command (command.h).
+//
+// A metric is a global object that adds itself to the registry when it is constructed, so
+// every module declares its metrics next to the code that updates them. Updating one is a
+// plain 32-bit add or store, without a lock: each metric is written from a single place, the
+// loop or one interrupt, and 32-bit accesses are atomic on the ESP32, so a scrape always reads
+// a value the metric really held. A histogram counts its observations in fixed buckets, found
+// by comparing with at most METRIC_MAX_BUCKETS bounds.
+#define METRIC_MAX_BUCKETS 10
+#define METRICS_FAMILY_SIZE 1024 // Longest text of one metric
+#define METRICS_CONTENT_TYPE "application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+enum METRIC_TYPE
+{
+    METRIC_COUNTER,  // Only goes up, exposed as name_total
+    METRIC_GAUGE,    // Current value
+    METRIC_HISTOGRAM // Distribution of observations, exposed in seconds
+};
+
+class Metric
+{
+public:
+    const char *name; // OpenMetrics family name, without _total
+    const char *help;
+    METRIC_TYPE type;
+    Metric *next; // In the registry, in construction order
+
+    Metric(const char *name, const char *help, METRIC_TYPE type);
+    size_t format(char *buffer, size_t size) const;
+};
+
+class Counter : public Metric
+{
+private:
+    volatile uint32_t value;
+
+public:
+    Counter(const char *name, const char *help);
+    void add(uint32_t count = 1) { value += count; }
+    uint32_t get() const { return value; }
+};
+
+// A value set by its owner, or read from a function when the registry is scraped
+class Gauge : public Metric
+{
+private:
+    volatile int32_t value;
+    int32_t (*read)();
+
+public:
+    Gauge(const char *name, const char *help, int32_t (*read)() = NULL);
+    void set(int32_t value) { this->value = value; }
+    void raise(int32_t value) // Keeps the highest value set: a high-water mark
+    {
+        if (value > this->value)
+            this->value = value;
+    }
+    int32_t get() const { return read ? read() : value; }
+};
+
+// Observations in microseconds, exposed in seconds; bounds are the upper bounds of the buckets,
+// in increasing order, and one more bucket takes what is above the last
+class Histogram : public Metric
+{
+private:
+    const uint32_t *bounds;
+    uint8_t boundCount;
+    volatile uint32_t buckets[METRIC_MAX_BUCKETS + 1];
+    volatile uint64_t sum;
+
+public:
+    Histogram(const char *name, const char *help, const uint32_t *bounds, uint8_t boundCount);
+    void observe(uint32_t microseconds)
+    {
+        uint8_t bucket = 0;
+        while (bucket < boundCount && microseconds > bounds[bucket])
+            bucket++;
+        buckets[bucket]++;
+        sum += microseconds;
+    }
+    size_t format(char *buffer, size_t size) const;
+};
+
+// Where a text of the registry written in pieces has got to
+struct MetricsCursor
+{
+    const Metric *next;
+    bool ended; // "# EOF" written
+};
+
+void beginMetrics(MetricsCursor &cursor);
+size_t formatMetrics(MetricsCursor &cursor, char *buffer, size_t size);
+size_t writeMetrics(char *buffer, size_t size);
+void serveMetrics(HttpServer &server, int client, const HttpRequest &request);
+#endif // METRICS_H
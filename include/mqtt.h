@@ -0,0 +1,142 @@
+// mqtt.h
+#ifndef MQTT_H
+#define MQTT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "live.h"
+
+// Publishes the statistics of every measurement window, and optionally the raw samples, to an
+// MQTT broker (MQTT 3.1.1, QoS 1), for loggers on a network.
+//
+// Windows are batched MQTT_BATCH_WINDOWS to a message on <prefix>/stats, samples
+// MQTT_RAW_SAMPLES to a message on <prefix>/raw, where the prefix is "ds32/<client id>". A
+// payload is an MqttHeader followed by LiveStats records (live.h) or by i16 ADC counts, all
+// little-endian. A message waits in a RAM queue until the broker acknowledges it. When the
+// queue is full because the broker cannot be reached, messages are appended to the spool (a
+// file on the card, see MqttSpool), and the next ones follow them there until the spool has
+// been replayed, so the broker always receives the messages in order. The spool survives a
+// reboot and is then replayed from its start: (start, sequence) tells a repeated message.
+//
+// Like the web server, the publisher is polled from the loop and never waits: the socket is
+// non-blocking, connecting included, and one message is in flight at a time.
+#define MQTT_PORT 1883
+#define MQTT_KEEPALIVE 30        // Seconds, a PINGREQ is sent after half of it without traffic
+#define MQTT_RETRY 5000          // ms between connection attempts
+#define MQTT_TIMEOUT 10000       // ms for the broker to accept the connection or acknowledge a message
+#define MQTT_BATCH_WINDOWS 10    // LiveStats per message on <prefix>/stats
+#define MQTT_RAW_SAMPLES 512     // Samples per message on <prefix>/raw
+#define MQTT_QUEUE_SIZE 8192     // Bytes of messages waiting in RAM for the broker
+#define MQTT_CLIENT_ID_SIZE 24
+#define MQTT_TOPIC_SIZE 40
+#define MQTT_RECORD_HEADER 3     // u8 topic, u16 length before every message in the queue and the spool
+
+#define MQTT_STATS 0 // Topics
+#define MQTT_RAW 1
+
+struct __attribute__((packed)) MqttHeader
+{
+    uint8_t topic;     // MQTT_STATS or MQTT_RAW
+    uint8_t channel;   // CHANNEL of the controller
+    uint16_t count;    // LiveStats records or samples that follow
+    uint32_t sequence; // Of the message on its topic, from 0 at the start of the acquisition
+    uint32_t start;    // Start of the acquisition, seconds since 1970 (RTC time)
+    uint32_t first;    // Index of the first sample since the acquisition started
+    uint16_t rate;     // Samples per second
+    uint16_t flags;    // Reserved, 0
+    float scale;       // Input units (volts at the terminals) per count: gain times factor
+};
+
+#define MQTT_MAX_MESSAGE (sizeof(MqttHeader) + MQTT_RAW_SAMPLES * sizeof(int16_t))
+#define MQTT_PACKET_SIZE (MQTT_MAX_MESSAGE + MQTT_TOPIC_SIZE + 16)
+
+// Where messages wait while the broker cannot be reached: a file that is only appended to,
+// read from any position, and removed once it has been replayed
+struct MqttSpool
+{
+    bool (*append)(const uint8_t *data, size_t length);
+    size_t (*read)(uint32_t position, uint8_t *data, size_t length);
+    uint32_t (*size)();
+    void (*clear)();
+};
+
+enum MQTT_STATE
+{
+    MQTT_DISCONNECTED,
+    MQTT_CONNECTING, // TCP connection in progress
+    MQTT_WAITING,    // CONNECT sent, waiting for CONNACK
+    MQTT_CONNECTED
+};
+
+class MqttPublisher
+{
+private:
+    MqttSpool spool;
+    const char *host; // IPv4 address of the broker, NULL while disabled
+    uint16_t port;
+    char clientId[MQTT_CLIENT_ID_SIZE];
+    char topics[2][MQTT_TOPIC_SIZE];
+
+    int connection; // Socket, -1 while disconnected
+    MQTT_STATE state;
+    uint32_t stateTime;    // millis() when the state was entered
+    uint32_t lastTransmit; // millis() of the last packet sent
+    uint32_t lastReceive;  // millis() of the last byte received
+    uint8_t packet[MQTT_PACKET_SIZE];
+    size_t packetLength;
+    size_t packetSent;
+    uint8_t input[4]; // CONNACK, PUBACK and PINGRESP are 4 bytes at most
+    size_t inputLength;
+
+    bool inflight;       // A PUBLISH waits for its PUBACK
+    bool inflightSpool;  // It was read from the spool rather than the queue
+    size_t inflightSize; // Of its record in the queue or the spool
+    uint16_t packetId;
+
+    uint8_t queue[MQTT_QUEUE_SIZE];
+    size_t queueHead; // Oldest record not acknowledged
+    size_t queueTail;
+    uint32_t spoolLength;   // Bytes in the spool, 0 when it is empty
+    uint32_t spoolPosition; // Next record to replay
+
+    MqttHeader statsHeader;
+    LiveStats windows[MQTT_BATCH_WINDOWS];
+    MqttHeader rawHeader;
+    int16_t samples[MQTT_RAW_SAMPLES];
+    bool raw;
+    uint32_t next; // Index of the next sample
+
+    void enqueue(MqttHeader &header, const void *body, size_t bodyLength);
+    void connect(uint32_t now);
+    void disconnect(uint32_t now);
+    void setState(MQTT_STATE state, uint32_t now);
+    bool transmit();
+    bool receive(uint32_t now);
+    bool handlePacket(uint32_t now);
+    void publishNext(uint32_t now);
+    void acknowledge();
+    void discardSpool();
+
+public:
+    MqttPublisher(const MqttSpool &spool);
+    void begin(const char *host, uint16_t port, const char *clientId);
+    void start(uint8_t channel, uint16_t rate, float scale, uint32_t startTime, bool raw);
+    void insert(int16_t sample)
+    {
+        if (!raw)
+            return;
+        if (rawHeader.count == 0)
+            rawHeader.first = next;
+        samples[rawHeader.count++] = sample;
+        next++;
+        if (rawHeader.count == MQTT_RAW_SAMPLES)
+            flushRaw();
+    }
+    void addWindow(const LiveStats &window);
+    void flushRaw();
+    void end();
+    void poll(uint32_t now);
+    MQTT_STATE getState() const { return state; }
+    uint32_t getPending() const { return queueTail - queueHead + spoolLength - spoolPosition; }
+};
+#endif // MQTT_H
@@ -0,0 +1,39 @@
+// settings.h
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Settings of the logger kept across reboots, as one NVS blob (SETTINGS_NAMESPACE, SETTINGS_KEY):
+// a SettingsHeader followed by `length` bytes of the Settings fields, in their order. The CRC
+// covers the version, the length and the fields, so a torn or foreign blob is recognised.
+// A new version only appends fields: a shorter blob of the same version gets the defaults of the
+// fields it lacks, and a blob of another version is ignored.
+#define SETTINGS_NAMESPACE "settings"
+#define SETTINGS_KEY "logger"
+#define SETTINGS_VERSION 1
+
+struct __attribute__((packed)) SettingsHeader
+{
+    uint8_t version; // SETTINGS_VERSION
+    uint8_t length;  // Of the fields that follow
+    uint32_t crc;    // CRC-32 of version, length and the fields
+};
+
+struct __attribute__((packed)) Settings
+{
+    uint8_t mode;       // MODE of the controller
+    uint8_t channel;    // CHANNEL of the controller
+    uint16_t rate;      // Samples per second
+    uint8_t gain;       // Index in the gains of SET_CONFIG (command.h), or COMMAND_GAIN_DEFAULT
+    uint8_t compressed; // Compressed blocks on the serial port
+    uint8_t autostart;  // Start logging at boot, without the menu
+};
+
+#define SETTINGS_SIZE (sizeof(SettingsHeader) + sizeof(Settings))
+
+void defaultSettings(Settings *settings);
+size_t encodeSettings(const Settings &settings, uint8_t *out);
+bool decodeSettings(const uint8_t *data, size_t length, Settings *settings);
+#endif // SETTINGS_H
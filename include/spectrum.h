@@ -0,0 +1,98 @@
+// spectrum.h
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "history.h"
+
+// Amplitude spectrum of the last samples of the acquisition, for the spectrum mode started by
+// the SPECTRUM command (command.h).
+//
+// A block of `size` samples, a power of two, is read from the ring of the acquisition
+// (history.h) and weighted by a Hann or a 4-term Blackman-Harris window, less its mean weighted
+// by the window, so that the mean does not leak into the lowest bins. Its real FFT is the
+// complex FFT of size / 2 points, the even samples as real parts and the odd ones as imaginary
+// parts, split into the size / 2 + 1 bins of the real signal. The complex FFT is in place, in
+// floats (the ESP32 has a single-precision FPU): radix-4 decimation in frequency, with one
+// radix-2 stage when the number of points is not a power of 4, then a bit-reversal. The window
+// and the twiddle factors are tabulated by begin(), so a block costs the butterflies and one
+// square root per bin.
+//
+// The amplitudes are in counts, those of sines of the frequency of each bin (bin * rate /
+// size), and the one of bin 0 is the mean. The SPECTRUM_PEAKS largest local maxima are located
+// between bins by a parabola through the logarithm of the amplitudes.
+//
+// In the spectrum mode, each spectrum is sent on the serial port as a record: a SpectrumHeader
+// followed by the `bins` amplitudes as u16, in units of `scale` counts. The CRC covers the
+// header up to the crc field and the amplitudes, as for the records of blocks.h.
+#define SPECTRUM_MIN_SIZE 64
+#define SPECTRUM_MAX_SIZE 1024
+#define SPECTRUM_MAX_BINS (SPECTRUM_MAX_SIZE / 2 + 1)
+#define SPECTRUM_PEAKS 4
+#define SPECTRUM_MAGIC 0xCE
+
+#if SPECTRUM_MAX_SIZE > HISTORY_SAMPLES
+#error "A block of the spectrum must fit in the ring of the acquisition (HISTORY_SAMPLES)"
+#endif
+
+enum SPECTRUM_WINDOW
+{
+    SPECTRUM_HANN = 0,            // Main lobe of 4 bins, first sidelobe at -31 dB
+    SPECTRUM_BLACKMAN_HARRIS = 1, // Main lobe of 8 bins, sidelobes below -92 dB
+    SPECTRUM_WINDOWS
+};
+
+struct __attribute__((packed)) SpectrumPeak
+{
+    float frequency; // Hz, 0 when there is no such peak
+    float amplitude; // Counts
+};
+
+struct __attribute__((packed)) SpectrumHeader
+{
+    uint8_t magic;     // SPECTRUM_MAGIC
+    uint8_t window;    // SPECTRUM_WINDOW
+    uint16_t size;     // Samples of the block
+    uint16_t rate;     // Samples per second
+    uint16_t bins;     // Amplitudes after the header: size / 2 + 1
+    uint32_t sequence; // Index of the spectrum since the mode started
+    uint32_t first;    // Index of the first sample of the block since the mode started
+    uint32_t cycles;   // Processor cycles taken by the transform
+    float scale;       // Counts of an amplitude of 1
+    SpectrumPeak peaks[SPECTRUM_PEAKS]; // By decreasing amplitude
+    uint32_t crc;      // CRC-32 of the fields above and of the amplitudes
+};
+
+#define SPECTRUM_MAX_RECORD (sizeof(SpectrumHeader) + SPECTRUM_MAX_BINS * 2)
+
+class SpectrumAnalyzer
+{
+private:
+    float data[SPECTRUM_MAX_SIZE];                // The block, then its complex FFT: real and imaginary parts
+    float window[SPECTRUM_MAX_SIZE];
+    float twiddles[SPECTRUM_MAX_SIZE * 3 / 2];    // cos and -sin of 2 pi k / size, for k below 3 size / 4
+    float amplitudes[SPECTRUM_MAX_BINS];
+    SpectrumPeak peaks[SPECTRUM_PEAKS];
+    uint16_t size;
+    uint8_t windowKind;
+    float windowSum; // Gain of the window for a sine
+
+    void transformComplex();
+    void findPeaks(uint16_t rate);
+
+public:
+    SpectrumAnalyzer();
+    static bool isValidSize(uint16_t size);
+    bool begin(uint16_t size, uint8_t window);
+    void transform(const SampleHistory &history, uint32_t first, uint16_t rate);
+    uint16_t getSize() const { return size; }
+    uint8_t getWindow() const { return windowKind; }
+    uint16_t getBins() const { return size / 2 + 1; }
+    const float *getAmplitudes() const { return amplitudes; }
+    const SpectrumPeak *getPeaks() const { return peaks; }
+    size_t encode(uint16_t rate, uint32_t sequence, uint32_t first, uint32_t cycles, uint8_t *out) const;
+};
+
+int checkSpectrum(const uint8_t *data, size_t length);
+#endif // SPECTRUM_H
@@ -0,0 +1,66 @@
+// storage.h
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <Arduino.h>
+#include <SD.h>
+#include "storage_format.h"
+#include "blocks.h"
+#ifdef ESP32
+#include "ff.h"
+#include "diskio.h"
+#endif
+
+// Raw sector streaming needs f_expand() to allocate a contiguous extent
+#if defined(FF_USE_EXPAND) && FF_USE_EXPAND
+#define SD_RAW_SUPPORTED 1
+#else
+#define SD_RAW_SUPPORTED 0
+#endif
+
+// Every acquisition gets its own file in SESSION_DIR, named NNNN_YYMMDD_HHMMSS.ds32 from the RTC
+#define SESSION_DIR "/sessions"
+#define SESSION_INDEX "/sessions/index.txt"
+#define SD_MOUNT_POINT "/sd" // Where SD.begin() mounts the card in the VFS, used for truncate()
+#define SPOOL_FILE "/mqtt.spool"  // Messages waiting for the MQTT broker (mqtt.h)
+
+// A session file is closed and the next one opened when one of these limits is reached; they
+// can be changed by setSessionRotation(), the size only lowered
+#define SESSION_ROTATE_SIZE (64UL * 1024 * 1024) // bytes
+#define SESSION_ROTATE_DURATION 3600000UL        // ms
+
+// Files are grown in chunks so that clusters are allocated ahead of the writes
+#define SESSION_PREALLOCATE (1024UL * 1024)
+
+// RAW SECTOR STREAMING
+// The file is allocated as one contiguous extent when the session opens, then written
+// SD_RAW_BURST sectors at a time with multi-sector commands, bypassing FATFS entirely.
+#define SD_RAW_BURST 8
+#define SD_RAW_EXTENT (SESSION_ROTATE_SIZE + SESSION_PREALLOCATE)
+#define SD_RAW_DRIVE 0 // FATFS drive of the card, the first one registered by SD.begin()
+
+// Bytes written by sdBenchmark() through each path (build with -D SD_BENCHMARK)
+#define SD_BENCHMARK_SIZE (4UL * 1024 * 1024)
+
+extern boolean sdRawStreaming;
+
+boolean openSession(const char *header, size_t headerLength);
+size_t sessionWrite(const uint8_t *data, size_t length);
+void sessionWriteRecord(const uint8_t *record, size_t length, const BlockSummary *summary);
+boolean sessionSync();
+void setSessionRotation(uint32_t size, uint32_t duration);
+void closeSession();
+boolean isSessionOpen();
+uint16_t getSessionNumber();
+void recoverSessions();
+size_t readSessionData(File &file, boolean raw, uint32_t position, uint8_t *buffer, size_t length);
+uint32_t getSessionDataPosition(uint32_t position, boolean raw);
+uint32_t getSessionDataSize(File &file, boolean raw);
+bool spoolAppend(const uint8_t *data, size_t length);
+size_t spoolRead(uint32_t position, uint8_t *data, size_t length);
+uint32_t spoolSize();
+void spoolClear();
+#ifdef SD_BENCHMARK
+void sdBenchmark(Print &out);
+#endif
+#endif // STORAGE_H
@@ -0,0 +1,53 @@
+// storage_format.h
+#ifndef STORAGE_FORMAT_H
+#define STORAGE_FORMAT_H
+
+#include <stdint.h>
+
+// Layout of the files on the SD card, shared by the firmware and the host tools.
+
+// A session file starts with the text lines "DS32 <version> <mode>", the header passed to
+// openSession(), "Start: MM/DD/YYYY HH:MM:SS" and an empty line; sample blocks (blocks.h) follow
+#define SESSION_FORMAT_VERSION 2 // 2: records carry a session number, a sequence number and a CRC-32
+
+// Every session file has a block index next to it, with the same name and BLOCK_INDEX_EXTENSION.
+// It holds one BlockIndexEntry every BLOCK_INDEX_INTERVAL records, so a reader can bisect on
+// time or sample number, and skip whole spans of records when it only needs their range or mean.
+#define SESSION_EXTENSION ".ds32"
+#define BLOCK_INDEX_EXTENSION ".idx"
+#define BLOCK_INDEX_INTERVAL 16 // Records per entry; the sum below holds up to 256 records
+
+struct BlockIndexEntry
+{
+    uint32_t offset;   // Position in the session file of the first record (sector footers included)
+    uint32_t sequence; // Sequence number of the first record
+    uint32_t first;    // Index of the first sample
+    uint32_t time;     // Milliseconds since the acquisition started, at the first sample
+    uint32_t count;    // Samples in the records of the entry
+    int16_t minimum;   // Range of those samples
+    int16_t maximum;
+    int32_t sum;       // Their sum, the mean is sum / count
+};
+
+// Fixed-size lines of the index, so that a session's line can be rewritten in place
+#define SESSION_RECORD_SIZE 96
+
+// Index line fields: how the file is written and whether it was closed properly
+#define SESSION_MODE_FILE 'F'
+#define SESSION_MODE_RAW 'R'
+#define SESSION_STATE_WRITING 'W'
+#define SESSION_STATE_CLOSED 'C'
+#define SESSION_STATE_RECOVERED 'R'
+
+// Raw sessions are written in whole sectors
+#define SD_SECTOR_SIZE 512
+
+// The last bytes of every raw sector, so that the written part of an extent can be found after a power loss
+struct SectorFooter
+{
+    uint16_t session;  // Session number, tells apart sectors left on the card by older files
+    uint16_t length;   // Bytes of payload used
+    uint32_t sequence; // Index of the sector in the extent
+};
+#define SD_SECTOR_PAYLOAD (SD_SECTOR_SIZE - sizeof(SectorFooter))
+#endif // STORAGE_FORMAT_H
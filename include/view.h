@@ -4,19 +4,23 @@
 
 #include <Adafruit_SSD1306.h>
 #include "controller.h"
+#include "spectrum.h"
 
 extern int menu;
 int updateMenu(int menu);
 boolean initializeScreen();
+void drawScreenAsset(const unsigned char *asset);
 void updateContextCursor(int position);
 void errorMessageGraphic(int currentMode);
 void waitSerialGraphic();
-void loggerGraphic(String currentTime, float measure);
+void loggerGraphic(const char *currentTime, float measure);
 void printBitmapIcon();
 void printMeasureValue(float measure);
 void outputModeGraphic(int mode);
 void inputModeGraphic(int channel);
-void infoGraphic(String TimeStamp, String DateStamp);
+void infoGraphic(const char *TimeStamp, const char *DateStamp);
 void sampleSetGraphic(int sample);
 void sampleSetSelectorGraphic(boolean arrowup);
+void calibrationGraphic(const char *channel, int points, boolean measuring, int window, int windows);
+void spectrumGraphic(const char *channel, const float *amplitudes, uint16_t bins, const SpectrumPeak *peaks);
 #endif // VIEW_H
\ No newline at end of file
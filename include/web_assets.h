@@ -0,0 +1,29 @@
+// web_assets.h
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#define PROGMEM
+#endif
+
+// Pages of include/website/, minified and gzipped by tools/web_assets.py (src/web_assets.cpp).
+// The data is memory-mapped flash on the ESP32, so it can be handed to a socket as it is.
+struct WebAsset
+{
+    const char *path;    // Served at, with the content hash in it if immutable
+    const char *type;    // Content-Type
+    const char *etag;    // Strong ETag, quoted, from the content hash
+    bool immutable;      // May be cached forever: a new version gets a new path
+    const uint8_t *data; // gzip stream
+    size_t length;
+};
+
+extern const WebAsset webAssets[];
+extern const size_t webAssetCount;
+
+const WebAsset *findWebAsset(const char *path);
+#endif // WEB_ASSETS_H
@@ -0,0 +1,129 @@
+// webserver.h
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "web_assets.h"
+
+// HTTP/1.1 and WebSocket server on plain BSD sockets: lwIP on the ESP32, the POSIX socket
+// API in a host build, so the same code can be exercised from a local browser.
+//
+// Nothing here blocks: handleClients() accepts, reads and writes whatever the sockets allow
+// at that moment and returns, so it can be called from the acquisition loops. Every client
+// has a fixed transmit queue. A response body kept in memory (a web asset in flash) is sent
+// straight from there once the queue has drained, so pages of any size go out without
+// being copied; a WebSocket message that does not fit in the queue of a client is dropped
+// whole for that client only, so a slow browser never holds up the others or the logger.
+//
+// A body too large for memory (a file on the SD card) comes from an HttpBodySource, which
+// fills the empty queue HTTP_SOURCE_CHUNK bytes at a time as the socket takes them. Only one
+// chunk is produced per handleClients() call, for all the clients together, which bounds the
+// time a call can take. A body whose length is not known up front is sent with
+// Transfer-Encoding: chunked.
+#define HTTP_PORT 80
+#define HTTP_MAX_CLIENTS 4
+#define HTTP_MAX_ROUTES 16
+#define HTTP_REQUEST_SIZE 1024 // Request line and headers
+#define HTTP_QUEUE_SIZE 6144   // Transmit queue of each client
+#define HTTP_IDLE_TIMEOUT 5000 // Milliseconds after which an idle keep-alive connection is closed
+#define WS_MAX_MESSAGE 128     // Largest message accepted from a browser
+#define HTTP_SOURCE_CHUNK 2048 // Bytes asked from a body source at a time, four SD sectors
+#define HTTP_CHUNKED ((size_t)-1) // Length of a response whose size is not known
+
+enum WS_EVENT
+{
+    WS_OPEN,    // Handshake complete
+    WS_MESSAGE, // Text or binary message received
+    WS_CLOSE    // Connection closed, by either side
+};
+
+struct HttpRequest
+{
+    const char *method;
+    const char *path;    // Without the query
+    const char *query;   // After '?', "" if none
+    const char *headers; // "Name: value\r\n" lines
+};
+
+class HttpServer;
+
+// Answers a request with respond() and writeBody() or attach(), before returning
+typedef void (*HttpHandler)(HttpServer &server, int client, const HttpRequest &request);
+// Writes the next bytes of a body into buffer, at most size, and returns how many: 0 at the
+// end. Called once with buffer NULL when the body is over or the connection closed, to let go
+// of what the source holds for that client.
+typedef size_t (*HttpBodySource)(int client, uint8_t *buffer, size_t size);
+// Receives the WebSocket events; data and length are only set for WS_MESSAGE
+typedef void (*WebSocketHandler)(HttpServer &server, int client, WS_EVENT event, const uint8_t *data, size_t length);
+
+struct HttpRoute
+{
+    const char *path;
+    HttpHandler handler;
+};
+
+struct HttpClient
+{
+    int socket; // -1 if the slot is free
+    uint8_t state;
+    uint32_t lastActivity;
+    char request[HTTP_REQUEST_SIZE + 1];
+    size_t received;
+    uint8_t queue[HTTP_QUEUE_SIZE];
+    size_t queueStart; // First byte not sent yet
+    size_t queueEnd;
+    const uint8_t *body; // Attached body, sent after the queue
+    size_t bodyLeft;
+    HttpBodySource source; // Attached source, read into the queue once it is empty
+    size_t sourceLeft;     // Bytes still expected from it, or HTTP_CHUNKED
+    bool chunked;          // Whether the response is sent with Transfer-Encoding: chunked
+};
+
+class HttpServer
+{
+private:
+    int listener;
+    HttpClient clients[HTTP_MAX_CLIENTS];
+    HttpRoute routes[HTTP_MAX_ROUTES];
+    uint8_t routeCount;
+    const char *socketPath;
+    WebSocketHandler socketHandler;
+    uint32_t droppedMessages; // WebSocket messages that did not fit in the queue of a client
+    uint32_t now;
+    bool sourceRead; // Whether a body source was read during this handleClients() call
+
+    void acceptClient();
+    void receive(int client);
+    void transmit(int client);
+    bool refill(int client);
+    void release(int client);
+    void handleRequest(int client);
+    void upgrade(int client, const HttpRequest &request);
+    void receiveFrame(int client);
+    bool queueFrame(int client, uint8_t opcode, const uint8_t *data, size_t length);
+    void disconnect(int client);
+
+public:
+    HttpServer();
+    bool begin(uint16_t port);
+    void on(const char *path, HttpHandler handler);
+    void onWebSocket(const char *path, WebSocketHandler handler);
+    void handleClients(uint32_t now);
+
+    bool respond(int client, int status, const char *type, size_t length, const char *headers = NULL);
+    size_t writeBody(int client, const void *data, size_t length);
+    void attach(int client, const uint8_t *data, size_t length);
+    void attach(int client, HttpBodySource source, size_t length);
+    void sendText(int client, int status, const char *type, const char *text);
+    void sendAsset(int client, const HttpRequest &request, const WebAsset &asset);
+
+    bool sendMessage(int client, const uint8_t *data, size_t length);
+    uint8_t broadcast(const uint8_t *data, size_t length);
+    uint8_t getSocketCount() const;
+    uint32_t getDroppedMessages() const;
+};
+
+const char *findHeader(const HttpRequest &request, const char *name, size_t *length);
+bool findParameter(const HttpRequest &request, const char *name, char *value, size_t size);
+#endif // WEBSERVER_H
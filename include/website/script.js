@@ -0,0 +1,156 @@
+// script.js: live view of the logger, fed by the WebSocket of the device and the chart it reduces
+// to one point per pixel (see include/live.h)
+
+const LIVE_CONFIG = 1;
+const LIVE_SAMPLES = 2;
+const LIVE_STATS = 3;
+const UNITS = ['V', 'A', 'Ω'];
+const CHART_LTTB = 0;
+const CHART_PERIOD = 500; // Milliseconds between two charts
+const RECORD_SECONDS = 600; // Samples kept for the download
+
+let socket = null;
+let config = null;
+let chartPending = false;
+let recorded = [];
+let paused = false;
+
+function connect() {
+  socket = new WebSocket('ws://' + location.host + '/ws');
+  socket.binaryType = 'arraybuffer';
+  socket.onmessage = (event) => receive(new DataView(event.data));
+  socket.onclose = () => setTimeout(connect, 1000);
+}
+
+function receive(view) {
+  switch (view.getUint8(0)) {
+    case LIVE_CONFIG:
+      config = {
+        channel: view.getUint8(1),
+        rate: view.getUint16(2, true),
+        gain: view.getFloat32(4, true),
+        offset: view.getFloat32(8, true),
+        factor: view.getFloat32(12, true),
+        acquiring: view.getUint8(16) != 0,
+      };
+      break;
+
+    case LIVE_SAMPLES:
+      if (!config || paused)
+        break;
+      const count = view.getUint16(2, true);
+      const first = view.getUint32(4, true);
+      if (first == 0)
+        recorded = [];
+      for (let i = 0; i < count; i++) {
+        const value = view.getInt16(8 + 2 * i, true) * config.gain * config.factor;
+        if (recorded.length < config.rate * RECORD_SECONDS)
+          recorded.push([first + i, value]);
+      }
+      break;
+
+    case LIVE_STATS:
+      if (!config)
+        break;
+      const unit = ' ' + UNITS[config.channel];
+      const scale = config.gain * config.factor;
+      let text = view.getFloat32(8, true).toFixed(4) + unit;
+      if (document.getElementById('mean').checked)
+        text += '\nmean ' + (view.getFloat32(12, true) * scale).toFixed(4) + unit;
+      if (document.getElementById('std').checked)
+        text += '\nstd ' + (view.getFloat32(16, true) * scale).toFixed(5) + unit;
+      if (document.getElementById('time-acquisition').checked)
+        text += '\n' + (view.getUint32(4, true) / config.rate).toFixed(0) + ' s';
+      document.querySelector('#measurement-value span').innerText = text;
+      break;
+  }
+}
+
+// Asks the device for the selected window reduced to one point (LTTB) or one bucket (min/max) per pixel
+function fetchChart() {
+  const canvas = document.getElementById('chart');
+  if (!canvas || !config || paused || chartPending)
+    return;
+  const [seconds, mode] = document.getElementById('window').value.split(':');
+  chartPending = true;
+  fetch('/chart?seconds=' + seconds + '&points=' + canvas.width + '&mode=' + mode)
+    .then((response) => response.arrayBuffer())
+    .then((buffer) => draw(canvas, new DataView(buffer), seconds))
+    .catch(() => {})
+    .finally(() => chartPending = false);
+}
+
+function draw(canvas, view, seconds) {
+  const mode = view.getUint8(0);
+  const points = view.getUint16(2, true);
+  const count = view.getUint32(8, true);
+  const rate = view.getUint16(12, true);
+  const first = new Int16Array(view.buffer, 20, points); // Offsets (u16) for LTTB, minima for min/max
+  const second = new Int16Array(view.buffer, 20 + 2 * points, points); // Values, or maxima
+
+  const context = canvas.getContext('2d');
+  context.clearRect(0, 0, canvas.width, canvas.height);
+  if (points < 2)
+    return;
+  let minimum = Infinity;
+  let maximum = -Infinity;
+  for (let i = 0; i < points; i++) {
+    minimum = Math.min(minimum, mode == CHART_LTTB ? second[i] : first[i]);
+    maximum = Math.max(maximum, second[i]);
+  }
+  const span = maximum - minimum || 1;
+  const y = (value) => canvas.height - (value - minimum) * canvas.height / span;
+  // A window not filled yet grows from the left
+  const width = canvas.width * Math.min(1, count / Math.max(count, seconds * rate));
+
+  context.beginPath();
+  if (mode == CHART_LTTB) {
+    for (let i = 0; i < points; i++) {
+      const x = (first[i] & 0xffff) * width / (count - 1);
+      if (i == 0)
+        context.moveTo(x, y(second[i]));
+      else
+        context.lineTo(x, y(second[i]));
+    }
+  } else {
+    for (let i = 0; i < points; i++) {
+      const x = (i + 0.5) * width / points;
+      context.moveTo(x, y(first[i]));
+      context.lineTo(x, y(second[i]) - 1);
+    }
+  }
+  context.strokeStyle = '#007bff';
+  context.stroke();
+}
+
+function startMeasurement() {
+  paused = false;
+  if (socket && socket.readyState == WebSocket.OPEN)
+    socket.send('start');
+}
+
+function pauseMeasurement() {
+  paused = !paused;
+}
+
+function stopMeasurement() {
+  if (socket && socket.readyState == WebSocket.OPEN)
+    socket.send('stop');
+}
+
+function downloadData() {
+  const sample = document.getElementById('sample').checked;
+  const timestamp = document.getElementById('timestamp').checked;
+  let csv = (sample ? 'sample,' : '') + (timestamp ? 'time_s,' : '') + 'value\n';
+  for (const [index, value] of recorded) {
+    csv += (sample ? index + ',' : '') + (timestamp && config ? (index / config.rate).toFixed(6) + ',' : '') +
+      value.toPrecision(7) + '\n';
+  }
+  const link = document.createElement('a');
+  link.href = URL.createObjectURL(new Blob([csv], { type: 'text/csv' }));
+  link.download = 'logger.csv';
+  link.click();
+}
+
+connect();
+setInterval(fetchChart, CHART_PERIOD);
@@ -0,0 +1,11 @@
+#include "../include/ads1115.h"
+
+#define ADC_CONVERSION(channel, gain) {AdcConversion<channel, gain>::convert, AdcConversion<channel, gain>::curve}
+#define ADC_CONVERSION_GAINS(channel)                                                               \
+    {ADC_CONVERSION(channel, 0), ADC_CONVERSION(channel, 1), ADC_CONVERSION(channel, 2),            \
+     ADC_CONVERSION(channel, 3), ADC_CONVERSION(channel, 4), ADC_CONVERSION(channel, 5)}
+
+static_assert(ADC_CHANNEL_COUNT == 3 && ADC_GAIN_COUNT == 6, "ADC_CONVERSIONS lists every channel and gain");
+
+const AdcConversionEntry ADC_CONVERSIONS[ADC_CHANNEL_COUNT][ADC_GAIN_COUNT] = {
+    ADC_CONVERSION_GAINS(0), ADC_CONVERSION_GAINS(1), ADC_CONVERSION_GAINS(2)};
@@ -0,0 +1,393 @@
+// Generated by tools/bitmap_rle.py from bitmap_display_png/, do not edit.
+#include "../include/bitmap_rle.h"
+
+// 'Menu_1', 128x64px, 447 bytes (1024 uncompressed)
+const unsigned char rle_Menu_1[] PROGMEM = {
+    0x82, 0x00, 0x00, 0xc0, 0x81, 0x20, 0x00, 0x40, 0x81, 0x00, 0x81, 0x80, 0x81, 0x00, 0x81, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x81, 0x00, 0x82, 0x80, 0x82, 0x00, 0x00, 0xe0, 0x82, 0x00, 0x81, 0x80,
+    0x86, 0x00, 0x81, 0x80, 0x82, 0x00, 0x81, 0x80, 0x81, 0x00, 0x03, 0x80, 0xc0, 0x80, 0x80, 0xb2,
+    0x00, 0x00, 0xfc, 0x81, 0xfe, 0x00, 0xfc, 0x85, 0x00, 0x00, 0x11, 0x81, 0x22, 0x03, 0x1c, 0x00,
+    0x00, 0x19, 0x81, 0x24, 0x0c, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x3f, 0x00,
+    0x00, 0xff, 0x81, 0x20, 0x00, 0x1f, 0x81, 0x00, 0x04, 0x1f, 0x20, 0x00, 0x00, 0x1f, 0x81, 0x24,
+    0x00, 0x17, 0x84, 0x00, 0x00, 0x13, 0x81, 0x24, 0x03, 0x19, 0x00, 0x00, 0x1f, 0x81, 0x24, 0x00,
+    0x17, 0x81, 0x00, 0x02, 0x1f, 0x20, 0x20, 0xb2, 0x00, 0x04, 0x07, 0x0f, 0xaf, 0x0f, 0x07, 0x86,
+    0x00, 0x01, 0x80, 0xc0, 0xe5, 0x40, 0x01, 0xc0, 0x80, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01,
+    0xff, 0x01, 0x81, 0x00, 0x08, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x80, 0x83, 0x00,
+    0x80, 0xfc, 0x84, 0x00, 0x25, 0xe0, 0xf0, 0x10, 0x10, 0xf0, 0xe0, 0x00, 0x00, 0xe0, 0xf0, 0x10,
+    0x10, 0xf0, 0xf0, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xf0, 0xf0, 0x00, 0x00, 0xe0, 0xf0, 0x90,
+    0x90, 0xf0, 0xe0, 0x00, 0x00, 0xf0, 0xf0, 0x40, 0x20, 0x30, 0x30, 0xa8, 0x00, 0x01, 0x01, 0xff,
+    0x87, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x80, 0x81, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x30,
+    0x18, 0x0c, 0x06, 0x02, 0x01, 0x83, 0x00, 0x80, 0x07, 0x82, 0x04, 0x80, 0x00, 0x21, 0x03, 0x07,
+    0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x09, 0x1b, 0x12, 0x12, 0x1f, 0x0f, 0x00, 0x00, 0x09, 0x1b,
+    0x12, 0x12, 0x1f, 0x0f, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x06, 0x02, 0x00, 0x00, 0x07, 0x07,
+    0xac, 0x00, 0x01, 0x80, 0x7f, 0x87, 0x00, 0x00, 0xaa, 0x88, 0x00, 0x01, 0x01, 0x03, 0xe5, 0x02,
+    0x01, 0x03, 0x01, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x00, 0xfc, 0x81, 0x02, 0x03, 0xfc, 0x00,
+    0x00, 0xf8, 0x81, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x08, 0xfc, 0x08, 0x08, 0x00, 0x00, 0xf8, 0x81,
+    0x08, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x08, 0xfc, 0x08, 0x08,
+    0x84, 0x00, 0x09, 0xf8, 0x08, 0x08, 0xf0, 0x08, 0x08, 0xf0, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03,
+    0xf0, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xfe, 0x00, 0x00, 0xf0, 0x81, 0x48, 0x00, 0x70, 0xac,
+    0x00, 0x00, 0xaa, 0x87, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02,
+    0x00, 0x01, 0x81, 0x00, 0x05, 0x01, 0x02, 0x02, 0x00, 0x00, 0x0f, 0x81, 0x02, 0x03, 0x01, 0x00,
+    0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x02, 0x02, 0x84, 0x00, 0x00, 0x03,
+    0x83, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02,
+    0x03, 0x03, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0xac, 0x00, 0x00, 0xaa, 0x83, 0x00};
+// 'Menu_2', 128x64px, 460 bytes (1024 uncompressed)
+const unsigned char rle_Menu_2[] PROGMEM = {
+    0x82, 0x00, 0x00, 0xe0, 0x85, 0x00, 0x81, 0x80, 0x82, 0x00, 0x82, 0x80, 0x81, 0x00, 0x82, 0x80,
+    0x81, 0x00, 0x81, 0x80, 0x81, 0x00, 0x04, 0x80, 0x00, 0x00, 0x80, 0x80, 0xcc, 0x00, 0x00, 0xaa,
+    0x87, 0x00, 0x00, 0x3f, 0x82, 0x20, 0x80, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x1f, 0x00, 0x00,
+    0x4f, 0x81, 0x90, 0x03, 0x7f, 0x00, 0x00, 0x4f, 0x81, 0x90, 0x03, 0x7f, 0x00, 0x00, 0x1f, 0x81,
+    0x24, 0x05, 0x17, 0x00, 0x00, 0x3f, 0x02, 0x01, 0xcc, 0x00, 0x04, 0xc0, 0xe0, 0xea, 0xe0, 0xc0,
+    0x86, 0x00, 0x01, 0x80, 0xc0, 0xe5, 0x40, 0x01, 0xc0, 0x80, 0x86, 0x00, 0x00, 0x7f, 0x81, 0xff,
+    0x00, 0x7f, 0x85, 0x00, 0x01, 0xff, 0x01, 0x81, 0x00, 0x08, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30,
+    0x60, 0x40, 0x80, 0x83, 0x00, 0x2b, 0xf8, 0xfc, 0x04, 0x04, 0xfc, 0xf8, 0x00, 0x00, 0xf0, 0xf0,
+    0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x10, 0xf8, 0xf8, 0x10, 0x10, 0x00, 0x00, 0xf0, 0xf0, 0x10,
+    0x10, 0xf0, 0xe0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x10, 0xf8, 0xf8,
+    0x10, 0x10, 0x84, 0x00, 0x80, 0xf0, 0x1c, 0x10, 0xe0, 0x10, 0xf0, 0xe0, 0x00, 0x00, 0xe0, 0xf0,
+    0x10, 0x10, 0xf0, 0xe0, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xfc, 0xfc, 0x00, 0x00, 0xe0, 0xf0,
+    0x90, 0x90, 0xf0, 0xe0, 0x85, 0x00, 0x01, 0x01, 0xff, 0x87, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01,
+    0xff, 0x80, 0x81, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x01, 0x83, 0x00,
+    0x0d, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x81,
+    0x00, 0x13, 0x03, 0x07, 0x04, 0x04, 0x00, 0x00, 0x1f, 0x1f, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00,
+    0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x81, 0x00, 0x03, 0x03, 0x07, 0x04, 0x04, 0x84, 0x00, 0x80,
+    0x07, 0x1c, 0x00, 0x01, 0x00, 0x07, 0x07, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x00,
+    0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x06, 0x02, 0x85,
+    0x00, 0x01, 0x80, 0x7f, 0x87, 0x00, 0x00, 0xaa, 0x88, 0x00, 0x01, 0x01, 0x03, 0xe5, 0x02, 0x01,
+    0x03, 0x01, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0xf8, 0x81, 0x08,
+    0x03, 0xf0, 0x00, 0x00, 0xf8, 0x81, 0x08, 0x03, 0xf0, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x06, 0xf8,
+    0x00, 0x00, 0x08, 0xfc, 0x08, 0x08, 0x84, 0x00, 0x09, 0xfe, 0x08, 0x10, 0x20, 0x10, 0x08, 0xfe,
+    0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xfe, 0x00, 0x00,
+    0xf0, 0x81, 0x48, 0x00, 0x70, 0xb5, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00,
+    0x03, 0x81, 0x00, 0x03, 0x03, 0x00, 0x00, 0x0f, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81,
+    0x02, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01, 0x02, 0x02, 0x84, 0x00, 0x00, 0x03, 0x83, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x03, 0x00,
+    0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0xb5, 0x00, 0x00, 0xaa, 0x83, 0x00};
+// 'Menu_3', 128x64px, 491 bytes (1024 uncompressed)
+const unsigned char rle_Menu_3[] PROGMEM = {
+    0xf8, 0x00, 0x00, 0xaa, 0x85, 0x00, 0x00, 0xfe, 0x81, 0x01, 0x03, 0xfe, 0x00, 0x00, 0xfc, 0x81,
+    0x00, 0x09, 0xfc, 0x00, 0x00, 0x04, 0xfe, 0x04, 0x04, 0x00, 0x00, 0xfc, 0x81, 0x04, 0x03, 0xf8,
+    0x00, 0x00, 0xfc, 0x81, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x04, 0xfe, 0x04, 0x04, 0x84, 0x00, 0x09,
+    0xfc, 0x04, 0x04, 0x78, 0x04, 0x04, 0xf8, 0x00, 0x00, 0xf8, 0x81, 0x04, 0x03, 0xf8, 0x00, 0x00,
+    0xf8, 0x81, 0x04, 0x03, 0xff, 0x00, 0x00, 0xf8, 0x81, 0x24, 0x00, 0xb8, 0xae, 0x00, 0x00, 0xaa,
+    0x86, 0x00, 0x80, 0x01, 0x01, 0x81, 0xc0, 0x81, 0x40, 0x81, 0x41, 0x83, 0x40, 0x80, 0x41, 0x80,
+    0x40, 0x00, 0x47, 0x81, 0x41, 0x82, 0x40, 0x81, 0x41, 0x83, 0x40, 0x80, 0x41, 0x84, 0x40, 0x00,
+    0x41, 0x83, 0x40, 0x00, 0x41, 0x81, 0x40, 0x81, 0x41, 0x82, 0x40, 0x82, 0x41, 0x81, 0x40, 0x81,
+    0x41, 0xa3, 0x40, 0x01, 0xc0, 0x80, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x01, 0x81,
+    0x00, 0x08, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x80, 0x84, 0x00, 0x80, 0xfc, 0x81,
+    0x00, 0x80, 0xf0, 0x80, 0x10, 0x18, 0xf0, 0xe0, 0x00, 0x00, 0xf0, 0xf0, 0x10, 0x10, 0xf0, 0xe0,
+    0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x10, 0xf8, 0xf8, 0x10, 0x10, 0x84,
+    0x00, 0x80, 0xfc, 0x1c, 0x30, 0x60, 0x30, 0xfc, 0xfc, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xf0,
+    0xe0, 0x00, 0x00, 0xe0, 0xf0, 0x10, 0x10, 0xfc, 0xfc, 0x00, 0x00, 0xe0, 0xf0, 0x90, 0x90, 0xf0,
+    0xe0, 0x8e, 0x00, 0x01, 0x01, 0xff, 0x85, 0x00, 0x00, 0xfc, 0x81, 0xfe, 0x00, 0xfc, 0x85, 0x00,
+    0x01, 0xff, 0x80, 0x81, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x01, 0x84,
+    0x00, 0x80, 0x07, 0x81, 0x00, 0x80, 0x07, 0x80, 0x00, 0x80, 0x07, 0x80, 0x00, 0x80, 0x1f, 0x80,
+    0x04, 0x09, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x03, 0x81, 0x00, 0x03, 0x03,
+    0x07, 0x04, 0x04, 0x84, 0x00, 0x80, 0x07, 0x81, 0x00, 0x80, 0x07, 0x80, 0x00, 0x15, 0x03, 0x07,
+    0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x03, 0x07,
+    0x04, 0x04, 0x06, 0x02, 0x8e, 0x00, 0x01, 0x80, 0x7f, 0x85, 0x00, 0x04, 0x07, 0x0f, 0xaf, 0x0f,
+    0x07, 0x86, 0x00, 0x01, 0x01, 0x03, 0xe5, 0x02, 0x01, 0x03, 0x01, 0x88, 0x00, 0x00, 0xaa, 0x85,
+    0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0xf8, 0x81, 0x08, 0x09, 0xf0, 0x00, 0x00, 0x10, 0xfc, 0x12,
+    0x12, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x00, 0xf0, 0x84, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xfe,
+    0x00, 0x00, 0xf0, 0x81, 0x48, 0x03, 0x70, 0x00, 0x00, 0xf8, 0x81, 0x00, 0x00, 0xf8, 0x81, 0x00,
+    0x00, 0xfa, 0x81, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0x10, 0x00, 0x00, 0xf0, 0x81, 0x48, 0x00,
+    0x70, 0xb4, 0x00, 0x00, 0xaa, 0x85, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00,
+    0x03, 0x81, 0x00, 0x00, 0x03, 0x82, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x01, 0x81, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01,
+    0x02, 0x01, 0x82, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00,
+    0x01, 0x81, 0x02, 0x00, 0x01, 0xb4, 0x00, 0x00, 0xaa, 0x83, 0x00};
+// 'Menu_4', 128x64px, 488 bytes (1024 uncompressed)
+const unsigned char rle_Menu_4[] PROGMEM = {
+    0x80, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x82, 0x80, 0x81, 0x00, 0x82, 0x80, 0x81, 0x00, 0x00, 0x80,
+    0x81, 0x00, 0x06, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x80, 0x80, 0x84, 0x00, 0x01, 0xe0, 0x80, 0x81,
+    0x00, 0x01, 0x80, 0xe0, 0x81, 0x00, 0x81, 0x80, 0x82, 0x00, 0x81, 0x80, 0x00, 0xe0, 0x81, 0x00,
+    0x81, 0x80, 0xb8, 0x00, 0x00, 0xaa, 0x85, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x3f, 0x81, 0x00,
+    0x03, 0x3f, 0x00, 0x00, 0xff, 0x81, 0x20, 0x03, 0x1f, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x00, 0x1f,
+    0x81, 0x00, 0x02, 0x1f, 0x20, 0x20, 0x84, 0x00, 0x09, 0x3f, 0x00, 0x01, 0x02, 0x01, 0x00, 0x3f,
+    0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x1f, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x3f, 0x00, 0x00,
+    0x1f, 0x81, 0x24, 0x00, 0x17, 0xb7, 0x00, 0x00, 0xaa, 0x88, 0x00, 0x01, 0x80, 0xc0, 0xe5, 0x40,
+    0x01, 0xc0, 0x80, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x01, 0x81, 0x00, 0x08, 0x01,
+    0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x80, 0x83, 0x00, 0x80, 0xf8, 0x81, 0x00, 0x80, 0xe0,
+    0x80, 0x20, 0x10, 0xe0, 0xc0, 0x00, 0x00, 0x40, 0xf0, 0xf8, 0x48, 0x48, 0x00, 0x00, 0xc0, 0xe0,
+    0x20, 0x20, 0xe0, 0xc0, 0x84, 0x00, 0x15, 0xc0, 0xe0, 0x20, 0x20, 0xf8, 0xf8, 0x00, 0x00, 0xc0,
+    0xe0, 0x20, 0x20, 0xe0, 0xc0, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0xe0, 0xe0, 0x81, 0x00, 0x80,
+    0xe8, 0x81, 0x00, 0x0d, 0xc0, 0xe0, 0x20, 0x20, 0x60, 0x40, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x20,
+    0xe0, 0xc0, 0x8a, 0x00, 0x01, 0x01, 0xff, 0x87, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x80,
+    0x81, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x01, 0x83, 0x00, 0x80, 0x0f,
+    0x81, 0x00, 0x80, 0x0f, 0x80, 0x00, 0x80, 0x0f, 0x81, 0x00, 0x80, 0x0f, 0x82, 0x00, 0x05, 0x07,
+    0x0f, 0x08, 0x08, 0x0f, 0x07, 0x84, 0x00, 0x15, 0x07, 0x0f, 0x08, 0x08, 0x0f, 0x0f, 0x00, 0x00,
+    0x07, 0x0f, 0x09, 0x09, 0x0d, 0x05, 0x00, 0x00, 0x03, 0x07, 0x0c, 0x0c, 0x07, 0x03, 0x81, 0x00,
+    0x80, 0x0f, 0x81, 0x00, 0x0d, 0x07, 0x0f, 0x08, 0x08, 0x0c, 0x04, 0x00, 0x00, 0x07, 0x0f, 0x09,
+    0x09, 0x0d, 0x05, 0x8a, 0x00, 0x01, 0x80, 0x7f, 0x86, 0x00, 0x02, 0x80, 0xaa, 0x80, 0x87, 0x00,
+    0x01, 0x01, 0x03, 0xe5, 0x02, 0x01, 0x03, 0x01, 0x86, 0x00, 0x83, 0xff, 0x83, 0x00, 0x00, 0x1c,
+    0x81, 0x22, 0x03, 0xc4, 0x00, 0x00, 0x90, 0x81, 0x48, 0x0c, 0xf0, 0x00, 0x00, 0xf8, 0x08, 0x08,
+    0xf0, 0x08, 0x08, 0xf0, 0x00, 0x00, 0xf8, 0x81, 0x08, 0x00, 0xf0, 0x81, 0x00, 0x00, 0xfe, 0x81,
+    0x00, 0x00, 0xf0, 0x81, 0x48, 0x00, 0x70, 0x84, 0x00, 0x00, 0x30, 0x81, 0x48, 0x03, 0x90, 0x00,
+    0x00, 0xf0, 0x81, 0x48, 0x06, 0x70, 0x00, 0x00, 0x08, 0xfc, 0x08, 0x08, 0xb4, 0x00, 0x04, 0x01,
+    0x03, 0xab, 0x03, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81,
+    0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x83, 0x00, 0x03, 0x03, 0x00, 0x00, 0x0f, 0x81, 0x02, 0x00,
+    0x01, 0x81, 0x00, 0x04, 0x01, 0x02, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x01, 0x81, 0x00, 0x02, 0x01,
+    0x02, 0x02, 0xb6, 0x00, 0x00, 0xaa, 0x83, 0x00};
+// 'Menu_5', 128x64px, 411 bytes (1024 uncompressed)
+const unsigned char rle_Menu_5[] PROGMEM = {
+    0x80, 0x00, 0x00, 0xc0, 0x89, 0x00, 0x02, 0x80, 0x40, 0x40, 0x8f, 0x00, 0x00, 0xc0, 0x8f, 0x00,
+    0x00, 0x40, 0xc3, 0x00, 0x00, 0xaa, 0x85, 0x00, 0x00, 0x7f, 0x81, 0x00, 0x00, 0x7f, 0x81, 0x01,
+    0x09, 0x7e, 0x00, 0x00, 0x02, 0x7f, 0x02, 0x02, 0x00, 0x00, 0x3e, 0x81, 0x41, 0x00, 0x3e, 0x84,
+    0x00, 0x00, 0x3e, 0x81, 0x41, 0x03, 0x7f, 0x00, 0x00, 0x3e, 0x81, 0x49, 0x07, 0x2e, 0x00, 0x00,
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x81, 0x00, 0x00, 0x7f, 0x81, 0x00, 0x00, 0x3e, 0x81, 0x41, 0x03,
+    0x22, 0x00, 0x00, 0x3e, 0x81, 0x49, 0x00, 0x2e, 0xb4, 0x00, 0x00, 0xaa, 0x88, 0x00, 0x01, 0x80,
+    0xc0, 0xe5, 0x40, 0x01, 0xc0, 0x80, 0x88, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x01, 0x81,
+    0x00, 0x08, 0x01, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0x40, 0x80, 0x83, 0x00, 0x1e, 0x38, 0x7c,
+    0x44, 0x44, 0xcc, 0x88, 0x00, 0x00, 0x20, 0xb0, 0x90, 0x90, 0xf0, 0xe0, 0x00, 0x00, 0xf0, 0xf0,
+    0x10, 0xe0, 0x10, 0xf0, 0xe0, 0x00, 0x00, 0xf0, 0xf0, 0x10, 0x10, 0xf0, 0xe0, 0x81, 0x00, 0x80,
+    0xfc, 0x81, 0x00, 0x05, 0xe0, 0xf0, 0x90, 0x90, 0xf0, 0xe0, 0x84, 0x00, 0x14, 0x60, 0xf0, 0x90,
+    0x90, 0xb0, 0x20, 0x00, 0x00, 0xe0, 0xf0, 0x90, 0x90, 0xf0, 0xe0, 0x00, 0x00, 0x10, 0xf8, 0xf8,
+    0x10, 0x10, 0x8e, 0x00, 0x01, 0x01, 0xff, 0x87, 0x00, 0x00, 0xaa, 0x87, 0x00, 0x01, 0xff, 0x80,
+    0x81, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x02, 0x01, 0x83, 0x00, 0x1e, 0x02,
+    0x06, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x07,
+    0x07, 0x00, 0x01, 0x00, 0x07, 0x07, 0x00, 0x00, 0x1f, 0x1f, 0x04, 0x04, 0x07, 0x03, 0x81, 0x00,
+    0x0a, 0x03, 0x07, 0x04, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x06, 0x02, 0x84, 0x00, 0x0d, 0x02,
+    0x06, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x04, 0x04, 0x06, 0x02, 0x81, 0x00, 0x03,
+    0x03, 0x07, 0x04, 0x04, 0x8e, 0x00, 0x01, 0x80, 0x7f, 0x87, 0x00, 0x00, 0xaa, 0x88, 0x00, 0x01,
+    0x01, 0x03, 0xe5, 0x02, 0x01, 0x03, 0x01, 0x88, 0x00, 0x00, 0xaa, 0x85, 0x00, 0x00, 0xfe, 0x84,
+    0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xf8, 0x00, 0x00,
+    0xf0, 0x81, 0x08, 0x03, 0xf8, 0x00, 0x00, 0xf0, 0x81, 0x48, 0x07, 0x70, 0x00, 0x00, 0xf8, 0x20,
+    0x10, 0x08, 0x08, 0xcc, 0x00, 0x04, 0xc0, 0xe0, 0xea, 0xe0, 0xc0, 0x83, 0x00, 0x00, 0x03, 0x82,
+    0x02, 0x80, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x04, 0x81, 0x09, 0x03, 0x07,
+    0x00, 0x00, 0x04, 0x81, 0x09, 0x03, 0x07, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00,
+    0x03, 0xd0, 0x00, 0x00, 0x7f, 0x81, 0xff, 0x00, 0x7f, 0x81, 0x00};
+// 'Output_mode', 128x64px, 499 bytes (1024 uncompressed)
+const unsigned char rle_Output_mode[] PROGMEM = {
+    0x8a, 0x00, 0x09, 0xc0, 0x20, 0x10, 0x70, 0x10, 0x70, 0x10, 0x70, 0x10, 0xf0, 0x85, 0x00, 0x00,
+    0xc0, 0x81, 0x20, 0x03, 0x40, 0x00, 0x00, 0xe0, 0x81, 0x20, 0x00, 0xc0, 0x86, 0x00, 0x81, 0x80,
+    0x82, 0x00, 0x81, 0x80, 0x81, 0x00, 0x04, 0x80, 0x00, 0x00, 0x80, 0x80, 0x81, 0x00, 0x81, 0x80,
+    0x00, 0xe0, 0x84, 0x00, 0x81, 0x80, 0x02, 0x00, 0x80, 0x80, 0x82, 0x00, 0x81, 0x80, 0x82, 0x00,
+    0x81, 0x80, 0x00, 0xe0, 0x81, 0x00, 0x81, 0x80, 0x9f, 0x00, 0x00, 0xff, 0x86, 0x80, 0x00, 0xff,
+    0x85, 0x00, 0x00, 0x11, 0x81, 0x22, 0x03, 0x1c, 0x00, 0x00, 0x3f, 0x81, 0x20, 0x01, 0x1f, 0x00,
+    0x83, 0x80, 0x01, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x11, 0x00, 0x00, 0x19, 0x81, 0x24, 0x05, 0x3f,
+    0x00, 0x00, 0x3f, 0x02, 0x01, 0x82, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x00, 0x3f, 0x84, 0x00, 0x09,
+    0x3f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x1f, 0x00, 0x00,
+    0x1f, 0x81, 0x20, 0x03, 0x3f, 0x00, 0x00, 0x1f, 0x81, 0x24, 0x00, 0x17, 0xff, 0x00, 0x9b, 0x00,
+    0x04, 0xfc, 0x04, 0xf4, 0x34, 0x14, 0x84, 0x04, 0x00, 0xfc, 0x85, 0x00, 0x00, 0xfc, 0x81, 0x04,
+    0x00, 0xf8, 0x81, 0x00, 0x00, 0xf4, 0x81, 0x00, 0x00, 0x60, 0x81, 0x90, 0x03, 0x20, 0x00, 0x00,
+    0xf0, 0x81, 0x10, 0x00, 0xe0, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0x20, 0x81, 0x90, 0x03,
+    0xe0, 0x00, 0x00, 0xf0, 0x81, 0x00, 0x00, 0xf0, 0x84, 0x00, 0x00, 0xf8, 0x81, 0x04, 0x03, 0xf8,
+    0x00, 0x00, 0xf0, 0x81, 0x10, 0x00, 0xe0, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xf0, 0x81,
+    0x00, 0x00, 0xf0, 0xa2, 0x00, 0x03, 0x07, 0x04, 0x04, 0x24, 0x82, 0x3c, 0x03, 0x24, 0x04, 0x04,
+    0x07, 0x85, 0x00, 0x00, 0x07, 0x81, 0x04, 0x00, 0x03, 0x81, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00,
+    0x02, 0x81, 0x04, 0x03, 0x03, 0x00, 0x00, 0x1f, 0x81, 0x04, 0x00, 0x03, 0x81, 0x00, 0x04, 0x03,
+    0x04, 0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x07, 0x00, 0x00, 0x09, 0x81, 0x12, 0x00, 0x0f, 0x84,
+    0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x03, 0x00, 0x00, 0x07, 0x81, 0x00, 0x00, 0x07, 0x81, 0x00,
+    0x04, 0x03, 0x04, 0x00, 0x00, 0x09, 0x81, 0x12, 0x00, 0x0f, 0xa4, 0x00, 0x00, 0xc0, 0x84, 0x40,
+    0x00, 0xc0, 0xf5, 0x00, 0x09, 0xf0, 0x1f, 0x10, 0x13, 0x10, 0x10, 0x13, 0x10, 0x1f, 0xf0, 0x86,
+    0x00, 0x00, 0x1c, 0x81, 0x22, 0x03, 0xc4, 0x00, 0x00, 0xf0, 0x81, 0x48, 0x07, 0x70, 0x00, 0x00,
+    0xf8, 0x20, 0x10, 0x08, 0x08, 0x81, 0x00, 0x00, 0xfa, 0x81, 0x00, 0x00, 0x90, 0x81, 0x48, 0x00,
+    0xf0, 0x81, 0x00, 0x00, 0xfe, 0x85, 0x00, 0x09, 0xf8, 0x08, 0x08, 0xf0, 0x08, 0x08, 0xf0, 0x00,
+    0x00, 0xf0, 0x81, 0x08, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0x81, 0x08, 0x03, 0xfe, 0x00, 0x00, 0xf0,
+    0x81, 0x48, 0x00, 0x70, 0xa6, 0x00, 0x09, 0x01, 0x02, 0x04, 0x04, 0x1c, 0x1c, 0x04, 0x04, 0x02,
+    0x01, 0x86, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01,
+    0x00, 0x00, 0x03, 0x85, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x03, 0x81,
+    0x00, 0x01, 0x01, 0x02, 0x84, 0x00, 0x00, 0x03, 0x83, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x81,
+    0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00,
+    0x01, 0x9b, 0x00};
+// 'Input_mode', 128x64px, 525 bytes (1024 uncompressed)
+const unsigned char rle_Input_mode[] PROGMEM = {
+    0x88, 0x00, 0x03, 0xf0, 0x10, 0x00, 0x80, 0x82, 0x40, 0x03, 0x80, 0x00, 0x10, 0xf0, 0x85, 0x00,
+    0x00, 0xe0, 0x81, 0x20, 0x00, 0xc0, 0x81, 0x00, 0x81, 0x80, 0x82, 0x00, 0x81, 0x80, 0x82, 0x00,
+    0x00, 0xa0, 0x82, 0x00, 0x81, 0x80, 0x81, 0x00, 0x03, 0x80, 0xc0, 0x80, 0x80, 0x81, 0x00, 0x81,
+    0x80, 0x81, 0x00, 0x82, 0x80, 0x82, 0x00, 0x81, 0x80, 0x82, 0x00, 0x81, 0x80, 0x85, 0x00, 0x00,
+    0xc0, 0x81, 0x20, 0x03, 0x40, 0x00, 0x00, 0xe0, 0x81, 0x80, 0x81, 0x00, 0x00, 0x40, 0x81, 0x20,
+    0x00, 0xc0, 0x91, 0x00, 0x0b, 0xff, 0x80, 0x27, 0x28, 0x30, 0x00, 0x00, 0x30, 0x28, 0x27, 0x80,
+    0xff, 0x85, 0x00, 0x07, 0x3f, 0x02, 0x06, 0x0a, 0x31, 0x00, 0x00, 0x1f, 0x81, 0x24, 0x03, 0x17,
+    0x00, 0x00, 0x13, 0x81, 0x24, 0x00, 0x19, 0x81, 0x00, 0x00, 0x3f, 0x81, 0x00, 0x00, 0x13, 0x81,
+    0x24, 0x00, 0x19, 0x81, 0x00, 0x05, 0x1f, 0x20, 0x20, 0x00, 0x00, 0x19, 0x81, 0x24, 0x03, 0x3f,
+    0x00, 0x00, 0x3f, 0x81, 0x00, 0x03, 0x3f, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x11, 0x00, 0x00,
+    0x1f, 0x81, 0x24, 0x00, 0x17, 0x84, 0x00, 0x00, 0x1f, 0x81, 0x20, 0x03, 0x10, 0x00, 0x00, 0x3f,
+    0x81, 0x00, 0x07, 0x3f, 0x00, 0x00, 0x10, 0x20, 0x22, 0x22, 0x1d, 0xff, 0x00, 0x90, 0x00, 0x0b,
+    0xfc, 0x04, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x04, 0xfc, 0x85, 0x00, 0x00, 0xfc,
+    0x81, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xe0, 0x81, 0x10, 0x00, 0xe0, 0x81, 0x00, 0x00, 0xfc, 0x81,
+    0x00, 0x06, 0x10, 0xf8, 0x10, 0x10, 0x00, 0x00, 0x20, 0x81, 0x90, 0x03, 0xe0, 0x00, 0x00, 0xe0,
+    0x81, 0x10, 0x03, 0xf0, 0x00, 0x00, 0xe0, 0x81, 0x90, 0x00, 0xe0, 0x84, 0x00, 0x00, 0xf8, 0x81,
+    0x04, 0x03, 0x08, 0x00, 0x00, 0xfc, 0x81, 0x10, 0x07, 0xe0, 0x00, 0x00, 0xf8, 0x84, 0x44, 0x24,
+    0xf8, 0xa6, 0x00, 0x0b, 0x3f, 0x20, 0x00, 0x07, 0x0f, 0x18, 0x18, 0x0f, 0x07, 0x00, 0x20, 0x3f,
+    0x85, 0x00, 0x07, 0x01, 0x02, 0x04, 0x02, 0x01, 0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x03, 0x81,
+    0x00, 0x01, 0x03, 0x04, 0x81, 0x00, 0x05, 0x03, 0x04, 0x04, 0x00, 0x00, 0x03, 0x81, 0x04, 0x03,
+    0x07, 0x00, 0x00, 0x09, 0x81, 0x12, 0x03, 0x0f, 0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x02, 0x84,
+    0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x02, 0x00, 0x00, 0x07, 0x81, 0x00, 0x03, 0x07, 0x00, 0x00,
+    0x03, 0x81, 0x04, 0x00, 0x03, 0xff, 0x00, 0xa5, 0x00, 0x0b, 0xff, 0x01, 0x00, 0xf8, 0xfc, 0x84,
+    0x84, 0xfc, 0xf8, 0x00, 0x01, 0xff, 0x85, 0x00, 0x00, 0xfc, 0x81, 0x02, 0x03, 0x04, 0x00, 0x00,
+    0xf8, 0x81, 0x00, 0x11, 0xf8, 0x00, 0x00, 0xf8, 0x20, 0x10, 0x08, 0x08, 0x00, 0x00, 0xf8, 0x20,
+    0x10, 0x08, 0x08, 0x00, 0x00, 0xf0, 0x81, 0x48, 0x03, 0x70, 0x00, 0x00, 0xf8, 0x81, 0x08, 0x06,
+    0xf0, 0x00, 0x00, 0x08, 0xfc, 0x08, 0x08, 0x84, 0x00, 0x00, 0xfc, 0x81, 0x02, 0x03, 0x04, 0x00,
+    0x00, 0xfe, 0x81, 0x08, 0x07, 0xf0, 0x00, 0x00, 0x84, 0x42, 0x22, 0x12, 0x0c, 0xa4, 0x00, 0x0b,
+    0x0f, 0x08, 0x00, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x00, 0x08, 0x0f, 0x85, 0x00, 0x00, 0x01,
+    0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03, 0x84, 0x00,
+    0x00, 0x03, 0x84, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00, 0x00, 0x03, 0x81, 0x00, 0x00,
+    0x03, 0x81, 0x00, 0x02, 0x01, 0x02, 0x02, 0x84, 0x00, 0x00, 0x01, 0x81, 0x02, 0x03, 0x01, 0x00,
+    0x00, 0x03, 0x81, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x82, 0x02, 0x9a, 0x00};
+// 'sample_rate_set', 128x64px, 346 bytes (1024 uncompressed)
+const unsigned char rle_sample_rate_set[] PROGMEM = {
+    0x85, 0x00, 0x80, 0xc0, 0xca, 0x40, 0x00, 0xc0, 0xa0, 0x40, 0x00, 0xc0, 0x8c, 0x00, 0x80, 0xff,
+    0xca, 0x00, 0x00, 0xff, 0x8a, 0x00, 0x09, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xf0, 0xe0, 0xc0,
+    0x80, 0x8a, 0x00, 0x00, 0xff, 0x8c, 0x00, 0x80, 0xff, 0xca, 0x00, 0x00, 0xff, 0x84, 0x00, 0x04,
+    0x20, 0x30, 0x38, 0x3c, 0x3e, 0x8a, 0x3f, 0x04, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x84, 0x00, 0x00,
+    0xff, 0x8c, 0x00, 0x80, 0xff, 0xca, 0x00, 0x00, 0xff, 0x84, 0x04, 0x94, 0x84, 0x84, 0x04, 0x00,
+    0xff, 0x8c, 0x00, 0x80, 0xff, 0xca, 0x00, 0x00, 0xff, 0x85, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0f,
+    0x1f, 0x3f, 0x7f, 0x84, 0xff, 0x06, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x85, 0x00, 0x00,
+    0xff, 0x8c, 0x00, 0x80, 0x7f, 0xca, 0x40, 0x00, 0x7f, 0x8d, 0x40, 0x03, 0x41, 0x43, 0x43, 0x41,
+    0x8d, 0x40, 0x00, 0x7f, 0x8d, 0x00, 0x00, 0x38, 0x81, 0x44, 0x03, 0x88, 0x00, 0x00, 0x20, 0x81,
+    0x90, 0x0c, 0xe0, 0x00, 0x00, 0xf0, 0x10, 0x10, 0xe0, 0x10, 0x10, 0xe0, 0x00, 0x00, 0xf0, 0x81,
+    0x10, 0x00, 0xe0, 0x81, 0x00, 0x00, 0xfc, 0x81, 0x00, 0x00, 0xe0, 0x81, 0x90, 0x00, 0xe0, 0x84,
+    0x00, 0x00, 0xf0, 0x81, 0x10, 0x03, 0xe0, 0x00, 0x00, 0xe0, 0x81, 0x90, 0x07, 0xe0, 0x00, 0x00,
+    0xf0, 0x40, 0x20, 0x10, 0x10, 0x84, 0x00, 0x00, 0x60, 0x81, 0x90, 0x03, 0x20, 0x00, 0x00, 0xe0,
+    0x81, 0x90, 0x03, 0xe0, 0x00, 0x00, 0xe0, 0x81, 0x10, 0x03, 0x20, 0x00, 0x00, 0xe0, 0x81, 0x10,
+    0x03, 0xe0, 0x00, 0x00, 0xf0, 0x81, 0x10, 0x03, 0xe0, 0x00, 0x00, 0xe0, 0x81, 0x10, 0x00, 0xfc,
+    0x8f, 0x00, 0x00, 0x02, 0x81, 0x04, 0x03, 0x03, 0x00, 0x00, 0x03, 0x81, 0x04, 0x0c, 0x07, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1f, 0x81, 0x04, 0x00, 0x03, 0x81,
+    0x00, 0x04, 0x03, 0x04, 0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x02, 0x84, 0x00, 0x00, 0x1f, 0x81,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x02, 0x00, 0x00, 0x07, 0x88, 0x00, 0x00,
+    0x02, 0x81, 0x04, 0x03, 0x03, 0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x02, 0x00, 0x00, 0x03, 0x81,
+    0x04, 0x03, 0x02, 0x00, 0x00, 0x03, 0x81, 0x04, 0x03, 0x03, 0x00, 0x00, 0x07, 0x81, 0x00, 0x03,
+    0x07, 0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x07, 0x87, 0x00};
+// 'logger', 128x64px, 83 bytes (1024 uncompressed)
+const unsigned char rle_logger[] PROGMEM = {
+    0x81, 0x00, 0x01, 0xe0, 0x10, 0x83, 0x08, 0x01, 0x10, 0xe0, 0x82, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x01, 0x03, 0x04, 0x83, 0x08, 0x01, 0x04, 0x03, 0x82, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xed, 0x80, 0x80, 0x00,
+    0x02, 0xe0, 0x10, 0x08, 0x82, 0x04, 0x07, 0x84, 0x44, 0x24, 0x08, 0x10, 0xe0, 0x00, 0xff, 0xef,
+    0x00, 0x02, 0x0f, 0x10, 0x20, 0x81, 0x40, 0x08, 0x41, 0x42, 0x44, 0x40, 0x20, 0x10, 0x0f, 0x00,
+    0xff, 0xed, 0x00};
+// 'error_sdcard', 128x64px, 653 bytes (1024 uncompressed)
+const unsigned char rle_error_sdcard[] PROGMEM = {
+    0x80, 0x00, 0x80, 0x30, 0x80, 0xcc, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0xcc, 0x82, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x85, 0x00, 0x89, 0xf0, 0x80, 0x00, 0x86, 0xf0, 0x84, 0x00, 0x86, 0xf0,
+    0x86, 0x00, 0x83, 0xf0, 0x83, 0x00, 0x86, 0xf0, 0x88, 0x00, 0x81, 0xf0, 0xa1, 0x00, 0x80, 0x33,
+    0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x85, 0x00, 0x81, 0xff, 0x83, 0x70, 0x83, 0x00,
+    0x81, 0xff, 0x81, 0x70, 0x80, 0xf0, 0x81, 0x0f, 0x81, 0x00, 0x80, 0xff, 0x81, 0x70, 0x81, 0xf0,
+    0x80, 0x0f, 0x81, 0x00, 0x81, 0xff, 0x83, 0x00, 0x81, 0xff, 0x80, 0x00, 0x81, 0xff, 0x81, 0x70,
+    0x80, 0xf0, 0x81, 0x0f, 0x85, 0x00, 0x81, 0xff, 0x87, 0x00, 0x12, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+    0x04, 0xfc, 0x04, 0x04, 0xfc, 0x04, 0x04, 0xfc, 0x04, 0x04, 0xfc, 0x04, 0xfc, 0xf8, 0x85, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x85, 0x00, 0x81, 0x7f, 0x86, 0x78,
+    0x80, 0x00, 0x81, 0x7f, 0x81, 0x00, 0x80, 0x07, 0x81, 0x78, 0x81, 0x00, 0x80, 0x7f, 0x81, 0x00,
+    0x81, 0x07, 0x80, 0x78, 0x81, 0x00, 0x81, 0x07, 0x83, 0x78, 0x81, 0x07, 0x80, 0x00, 0x81, 0x7f,
+    0x81, 0x00, 0x80, 0x07, 0x81, 0x78, 0x85, 0x00, 0x81, 0x73, 0x87, 0x00, 0x00, 0xff, 0x83, 0x00,
+    0x02, 0x70, 0x38, 0x0c, 0x81, 0x04, 0x01, 0x8c, 0xf8, 0x81, 0x00, 0x80, 0xff, 0x85, 0x00, 0x80,
+    0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0xd8, 0x00, 0x00, 0xff, 0x86, 0x00, 0x03,
+    0x6c, 0x6e, 0x03, 0x01, 0x82, 0x00, 0x80, 0xff, 0x85, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x85, 0x00, 0x08, 0x20, 0x50, 0x50, 0x90, 0x00, 0xf0, 0x10, 0x10, 0xe0,
+    0x81, 0x00, 0x12, 0xe0, 0x10, 0x10, 0xa0, 0x00, 0xe0, 0x50, 0x50, 0xe0, 0x00, 0xf0, 0x50, 0xd0,
+    0x20, 0x00, 0xf0, 0x10, 0x10, 0xe0, 0x81, 0x00, 0x0e, 0xf0, 0x20, 0x40, 0xf0, 0x00, 0xe0, 0x10,
+    0x10, 0xe0, 0x00, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x81, 0x00, 0x17, 0xf0, 0x50, 0x50, 0x10, 0x00,
+    0xe0, 0x10, 0x10, 0xe0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x20, 0x40, 0xf0, 0x00, 0xf0,
+    0x10, 0x10, 0xe0, 0x85, 0x00, 0x00, 0x03, 0x8e, 0x02, 0x80, 0x03, 0x85, 0x00, 0x80, 0x33, 0x80,
+    0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x85, 0x00, 0x81, 0x01, 0x80, 0x00, 0x81, 0x01, 0x83,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x09, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x81, 0x01, 0x82, 0x00, 0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x80, 0x01, 0x81, 0x00, 0x80, 0x01, 0x80, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x81, 0x01, 0xa0, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80,
+    0x33, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x33, 0x80, 0x0c, 0x80, 0x00};
+// 'error_serial', 128x64px, 763 bytes (1024 uncompressed)
+const unsigned char rle_error_serial[] PROGMEM = {
+    0x80, 0x00, 0x80, 0x30, 0x80, 0xcc, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0xcc, 0x82, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x04, 0xf8, 0x48, 0x48, 0x08, 0x08, 0x81, 0x00, 0x04, 0x20,
+    0x40, 0x80, 0x40, 0x20, 0x81, 0x00, 0x00, 0xe0, 0x81, 0x20, 0x00, 0xc0, 0x81, 0x00, 0x80, 0x20,
+    0x00, 0xe8, 0x83, 0x00, 0x04, 0xe0, 0x80, 0x40, 0x20, 0x20, 0x81, 0x00, 0x00, 0xc0, 0x81, 0xa0,
+    0x00, 0xc0, 0x81, 0x00, 0x00, 0xc0, 0x81, 0x20, 0x00, 0xf8, 0xb7, 0x00, 0x80, 0x33, 0x80, 0xcc,
+    0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x04, 0x03, 0x22, 0xf2, 0x22, 0x22, 0x81, 0x00,
+    0x14, 0x22, 0x21, 0xe8, 0x01, 0x02, 0x00, 0x00, 0xe0, 0x27, 0x21, 0xc1, 0x21, 0x20, 0xc0, 0x00,
+    0x00, 0xc2, 0xa2, 0xa3, 0xa2, 0xc2, 0x81, 0x00, 0x02, 0x03, 0x00, 0x20, 0x83, 0x00, 0x00, 0x01,
+    0x81, 0x02, 0x82, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x03, 0x90, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0xe0, 0x85, 0x20, 0x8a, 0xa0, 0x80, 0x20, 0x01, 0xc0, 0x80, 0x8a, 0x00, 0x80, 0x33, 0x80, 0xcc,
+    0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x04, 0xc0, 0x40, 0x41, 0x42, 0x82, 0x81, 0x00,
+    0x07, 0x82, 0x42, 0x43, 0x42, 0x82, 0x00, 0x00, 0x03, 0x83, 0x00, 0x03, 0x03, 0x00, 0x00, 0xc1,
+    0x81, 0x02, 0x00, 0xc0, 0x82, 0x00, 0x03, 0x40, 0x42, 0x40, 0x80, 0x81, 0x00, 0x80, 0x10, 0x00,
+    0xf0, 0x83, 0x00, 0x80, 0x40, 0x00, 0xd0, 0x83, 0x00, 0x00, 0x80, 0x81, 0x40, 0x00, 0xf0, 0x88,
+    0x00, 0x0e, 0x83, 0x02, 0x02, 0xfa, 0x02, 0x04, 0x00, 0x00, 0x48, 0x00, 0x00, 0xff, 0x00, 0xf0,
+    0x18, 0x81, 0x00, 0x09, 0x14, 0x08, 0x14, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x89, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x04, 0x87, 0x00, 0x00,
+    0x80, 0x87, 0x81, 0x00, 0x00, 0x03, 0x81, 0x84, 0x00, 0x03, 0x82, 0x00, 0x81, 0x80, 0x82, 0x00,
+    0x04, 0x81, 0x82, 0x84, 0x82, 0x01, 0x81, 0x00, 0x00, 0x02, 0x81, 0x85, 0x00, 0x07, 0x81, 0x00,
+    0x80, 0x84, 0x02, 0x87, 0x84, 0x04, 0x81, 0x00, 0x04, 0x04, 0x84, 0x87, 0x84, 0x04, 0x81, 0x00,
+    0x00, 0x03, 0x81, 0x84, 0x00, 0x07, 0x88, 0x00, 0x0e, 0x03, 0x02, 0x02, 0xfa, 0x82, 0x84, 0x80,
+    0x80, 0x82, 0x80, 0x80, 0xbf, 0xa0, 0xa1, 0xa3, 0x81, 0xa0, 0x09, 0xa5, 0xa2, 0xa5, 0xa0, 0xbf,
+    0x80, 0x80, 0xff, 0x00, 0xff, 0x89, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80,
+    0xcc, 0x84, 0x00, 0x02, 0x0f, 0x02, 0x01, 0x83, 0x00, 0x00, 0x07, 0x81, 0x0a, 0x00, 0x03, 0x81,
+    0x00, 0x00, 0x09, 0x81, 0x0a, 0x00, 0x04, 0x81, 0x00, 0x00, 0x1f, 0x81, 0x04, 0x00, 0x03, 0x81,
+    0x00, 0x04, 0x07, 0x08, 0x48, 0x08, 0x07, 0x81, 0x00, 0x00, 0x0f, 0x81, 0x00, 0x00, 0x0f, 0x81,
+    0x00, 0x00, 0x09, 0x81, 0x0a, 0x00, 0x04, 0x81, 0x00, 0x00, 0x07, 0x81, 0x0a, 0x00, 0xc3, 0x8c,
+    0x00, 0x01, 0x01, 0x02, 0x92, 0x04, 0x01, 0x05, 0x07, 0x89, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82,
+    0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x04, 0x1f, 0x04, 0x02, 0x01, 0x01, 0x81, 0x00, 0x00,
+    0x0e, 0x81, 0x15, 0x00, 0x06, 0x81, 0x00, 0x00, 0x0e, 0x81, 0x11, 0x00, 0x0a, 0x81, 0x00, 0x00,
+    0x0e, 0x81, 0x15, 0x00, 0x06, 0x81, 0x00, 0x80, 0x11, 0x02, 0x1f, 0x10, 0x10, 0x81, 0x00, 0x04,
+    0x07, 0x08, 0x10, 0x08, 0x07, 0x81, 0x00, 0x00, 0x0e, 0x81, 0x15, 0x00, 0x06, 0x81, 0x00, 0x00,
+    0x0e, 0x81, 0x11, 0x00, 0x1f, 0xaf, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80,
+    0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x33, 0x80, 0x0c, 0x80, 0x00};
+// 'waiting_serial', 128x64px, 613 bytes (1024 uncompressed)
+const unsigned char rle_waiting_serial[] PROGMEM = {
+    0x80, 0x00, 0x80, 0x30, 0x80, 0xcc, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30,
+    0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0xcc, 0x82, 0x00,
+    0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x02, 0x80, 0x40, 0x60, 0x8d, 0x50, 0x03, 0xd0, 0x30, 0x10,
+    0xf0, 0xd6, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x06,
+    0xff, 0x00, 0xfe, 0x02, 0x0a, 0x1a, 0x0a, 0x83, 0x02, 0x0d, 0x0a, 0x1a, 0x0a, 0x02, 0xfe, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x80, 0x82, 0xc0, 0x00, 0x40, 0x81, 0x60, 0x80, 0x20,
+    0x82, 0x30, 0x04, 0x60, 0xc0, 0xc0, 0x80, 0x80, 0x8f, 0x00, 0x00, 0x80, 0x94, 0x00, 0x00, 0x80,
+    0x83, 0x40, 0x00, 0xc0, 0x84, 0x80, 0x8a, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33,
+    0x80, 0xcc, 0x84, 0x00, 0x02, 0xff, 0x00, 0x1f, 0x81, 0x10, 0x06, 0x92, 0x16, 0x14, 0x94, 0x14,
+    0x16, 0x92, 0x81, 0x10, 0x06, 0x1f, 0x00, 0xff, 0x00, 0x03, 0xff, 0x03, 0x81, 0x01, 0x8f, 0x00,
+    0x80, 0x01, 0x81, 0x03, 0x0a, 0x00, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02,
+    0x85, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x06, 0x02, 0x06, 0x04, 0x0c,
+    0x08, 0x82, 0x0c, 0x01, 0x3f, 0x40, 0x83, 0x80, 0x06, 0xff, 0x40, 0x40, 0x52, 0x52, 0x40, 0x7f,
+    0x8a, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x84, 0x00, 0x05, 0x1f,
+    0x10, 0x90, 0x80, 0xf8, 0x04, 0x82, 0x10, 0x03, 0x90, 0x80, 0xf8, 0x04, 0x82, 0x10, 0x03, 0x1f,
+    0x08, 0x04, 0x03, 0xd6, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x9f,
+    0x00, 0x00, 0x80, 0xd0, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0xcc, 0x81,
+    0x00, 0x25, 0x0f, 0x10, 0x0e, 0x10, 0x0f, 0x0a, 0x15, 0x15, 0x0e, 0x00, 0x1d, 0x00, 0x02, 0x1f,
+    0x12, 0x00, 0x1d, 0x00, 0x1e, 0x02, 0x02, 0x1c, 0x04, 0x0a, 0x2a, 0x1c, 0x00, 0x00, 0x02, 0x1f,
+    0x02, 0x00, 0x0e, 0x11, 0x0e, 0x00, 0x1c, 0x02, 0x82, 0x00, 0x03, 0x0a, 0x15, 0x15, 0x0e, 0x81,
+    0x00, 0x13, 0x16, 0x15, 0x08, 0x08, 0x16, 0x15, 0x06, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x1d, 0x00,
+    0x0a, 0x15, 0x15, 0x0e, 0x00, 0x1f, 0x81, 0x00, 0x25, 0x0c, 0x12, 0x12, 0x00, 0x0c, 0x12, 0x12,
+    0x0c, 0x1e, 0x02, 0x02, 0x1c, 0x1e, 0x02, 0x02, 0x1c, 0x0e, 0x15, 0x15, 0x02, 0x0c, 0x12, 0x12,
+    0x00, 0x02, 0x1f, 0x12, 0x00, 0x1d, 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x1e, 0x02, 0x02, 0x1c, 0x81,
+    0x00, 0x80, 0x33, 0x80, 0xcc, 0x82, 0x00, 0x80, 0x33, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80, 0x30, 0x80, 0x0c, 0x80,
+    0x33, 0x80, 0x0c, 0x80, 0x00};
@@ -0,0 +1,46 @@
+#include <string.h>
+#include "../include/bitmap_rle.h"
+
+/**
+ * @brief Decompresses a run-length encoded asset stored in PROGMEM.
+ *
+ * The stream is a sequence of tokens: a control byte c < 0x80 is followed by
+ * c + 1 literal bytes, a control byte c >= 0x80 is followed by one byte that
+ * is repeated c - 0x80 + 2 times. Assets are stored in SSD1306 page order, so
+ * the output can be written straight into the display framebuffer.
+ *
+ * @param src The compressed asset.
+ * @param dst The destination buffer, at least size bytes long.
+ * @param size The number of bytes to produce.
+ * @return The number of compressed bytes consumed.
+ */
+size_t rleDecode(const unsigned char *src, uint8_t *dst, size_t size)
+{
+    const unsigned char *in = src;
+    uint8_t *end = dst + size;
+
+    while (dst < end)
+    {
+        uint8_t token = pgm_read_byte(in++);
+        size_t count;
+
+        if (token < 0x80)
+        {
+            count = token + 1;
+            if (count > (size_t)(end - dst))
+                count = end - dst;
+            memcpy_P(dst, in, count);
+            in += token + 1;
+        }
+        else
+        {
+            count = token - 0x80 + 2;
+            if (count > (size_t)(end - dst))
+                count = end - dst;
+            memset(dst, pgm_read_byte(in++), count);
+        }
+        dst += count;
+    }
+
+    return in - src;
+}
@@ -0,0 +1,144 @@
+#include <stddef.h>
+#include <string.h>
+#include "../include/blocks.h"
+#include "../include/crc32.h"
+
+BlockWriter::BlockWriter(BlockSink sink)
+{
+    this->sink = sink;
+    count = 0;
+    session = 0;
+    sequence = 0;
+    first = 0;
+    startTime = 0;
+    blockTime = 0;
+}
+
+/**
+ * @brief Starts a new acquisition, numbering records, samples and times from zero.
+ *
+ * @param now The current time in milliseconds.
+ * @param session The number of the session file the records go to, 0 if none.
+ */
+void BlockWriter::reset(uint32_t now, uint16_t session)
+{
+    this->session = session;
+    count = 0;
+    sequence = 0;
+    first = 0;
+    startTime = now;
+    blockTime = now;
+}
+
+/**
+ * @brief Changes the session number stamped on the next records, when the session file is rotated.
+ *
+ * Record, sample and time numbering carry on across files.
+ */
+void BlockWriter::setSession(uint16_t session)
+{
+    this->session = session;
+}
+
+/**
+ * @brief Adds a sample, emitting a record when the block is full.
+ *
+ * @param now The current time in milliseconds.
+ */
+void BlockWriter::insert(int16_t sample, uint32_t now)
+{
+    if (count == 0)
+        blockTime = now;
+
+    samples[count++] = sample;
+
+    if (count == CODEC_BLOCK_SAMPLES)
+        flush();
+}
+
+/**
+ * @brief Compresses the samples collected so far and hands the record to the sink.
+ *
+ * Called when the block is full and at the end of every window, so that at most one
+ * window of data is pending.
+ */
+void BlockWriter::flush()
+{
+    static uint8_t record[BLOCK_MAX_SIZE];
+
+    if (count == 0)
+        return;
+
+    BlockHeader header;
+    header.magic = BLOCK_MAGIC;
+    header.flags = 0;
+    header.length = (uint16_t)encodeBlock(samples, count, record + sizeof(BlockHeader));
+    header.session = session;
+    header.sequence = sequence;
+    header.first = first;
+    header.time = blockTime - startTime;
+    header.crc = crc32(0, (const uint8_t *)&header, offsetof(BlockHeader, crc));
+    header.crc = crc32(header.crc, record + sizeof(BlockHeader), header.length);
+    memcpy(record, &header, sizeof(header));
+
+    BlockSummary summary;
+    summarizeBlock(samples, count, &summary);
+    sink(record, sizeof(BlockHeader) + header.length, &summary);
+
+    sequence++;
+    first += count;
+    count = 0;
+}
+
+/**
+ * @brief Returns the number of samples inserted since the session started.
+ */
+uint32_t BlockWriter::getSampleCount()
+{
+    return first + count;
+}
+
+/**
+ * @brief Computes the range and sum of a block of samples.
+ */
+void summarizeBlock(const int16_t *samples, uint16_t count, BlockSummary *summary)
+{
+    summary->count = count;
+    summary->minimum = INT16_MAX;
+    summary->maximum = INT16_MIN;
+    summary->sum = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (samples[i] < summary->minimum)
+            summary->minimum = samples[i];
+        if (samples[i] > summary->maximum)
+            summary->maximum = samples[i];
+        summary->sum += samples[i];
+    }
+}
+
+/**
+ * @brief Checks whether a complete, intact record starts at the given position.
+ *
+ * @param data The bytes to check.
+ * @param length The number of bytes available from data.
+ * @param session The session the record must belong to, or BLOCK_ANY_SESSION.
+ * @return The size of the record, or -1 if there is none.
+ */
+int checkRecord(const uint8_t *data, size_t length, uint16_t session)
+{
+    BlockHeader header;
+
+    if (length < sizeof(header) || data[0] != BLOCK_MAGIC)
+        return -1;
+    memcpy(&header, data, sizeof(header));
+    if (header.flags != 0 || header.length > CODEC_MAX_SIZE || sizeof(header) + header.length > length)
+        return -1;
+    if (session != BLOCK_ANY_SESSION && header.session != session)
+        return -1;
+
+    uint32_t crc = crc32(0, data, offsetof(BlockHeader, crc));
+    if (crc32(crc, data + sizeof(header), header.length) != header.crc)
+        return -1;
+    return sizeof(header) + header.length;
+}
@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include "../include/boot.h"
+
+static const char *stageNames[BOOT_STAGES] = {"serial", "pins", "screen", "adc", "rtc",
+                                              "settings", "config", "card", "wifi", "sample"};
+static const char *resultNames[] = {"not run", "running", "ok", "failed", "timeout"};
+
+BootTimeline::BootTimeline()
+{
+    for (int i = 0; i < BOOT_STAGES; i++)
+        stages[i] = {0, 0, BOOT_NOT_RUN};
+}
+
+void BootTimeline::begin(BOOT_STAGE stage, uint32_t now)
+{
+    stages[stage].start = now;
+    stages[stage].end = now;
+    stages[stage].result = BOOT_RUNNING;
+}
+
+/**
+ * @brief Ends a stage, unless it was given up on.
+ */
+void BootTimeline::end(BOOT_STAGE stage, bool succeeded, uint32_t now)
+{
+    if (stages[stage].result != BOOT_RUNNING)
+        return;
+    stages[stage].end = now;
+    stages[stage].result = succeeded ? BOOT_OK : BOOT_FAILED;
+}
+
+/**
+ * @brief Marks a stage that is still running as timed out.
+ */
+void BootTimeline::giveUp(BOOT_STAGE stage, uint32_t now)
+{
+    if (stages[stage].result != BOOT_RUNNING)
+        return;
+    stages[stage].end = now;
+    stages[stage].result = BOOT_TIMEOUT;
+}
+
+/**
+ * @brief Writes the timeline as text, one line per stage that ran:
+ *   "card          12840 us  +   183214 us  ok"
+ * with the start of the stage and its duration.
+ *
+ * @return The length of the text, which is cut at size - 1 bytes.
+ */
+size_t BootTimeline::format(char *text, size_t size) const
+{
+    size_t length = 0;
+    for (int i = 0; i < BOOT_STAGES && length < size; i++)
+    {
+        const BootStage &stage = stages[i];
+        if (stage.result == BOOT_NOT_RUN)
+            continue;
+        int written = snprintf(text + length, size - length, "%-8s %10lu us  +%9lu us  %s\n", stageNames[i],
+                               (unsigned long)stage.start, (unsigned long)(stage.end - stage.start),
+                               resultNames[stage.result]);
+        if (written < 0)
+            break;
+        length += written;
+    }
+    return length < size ? length : size - 1;
+}
@@ -0,0 +1,397 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/calibration.h"
+
+#define CALIBRATION_LINE_SIZE 256
+
+static const char *channelNames[CALIBRATION_CHANNELS] = {"voltage", "current", "resistance"};
+
+/**
+ * @brief Computes the value of a curve at a number of counts.
+ */
+float evaluateCurve(const CalibrationCurve &curve, float counts)
+{
+    switch (curve.kind)
+    {
+    case CURVE_POLYNOMIAL:
+    {
+        float value = 0;
+        for (int i = curve.count - 1; i >= 0; i--)
+            value = value * counts + curve.values[i];
+        return value;
+    }
+    case CURVE_INVERSE:
+        // Half a count stands for 0, where the curve has no value
+        return curve.values[0] + curve.values[1] / (counts != 0 ? counts : 0.5f);
+    case CURVE_TABLE:
+    {
+        // The first and last segments go on beyond the points
+        uint8_t i = 1;
+        while (i < curve.count - 1 && counts > curve.counts[i])
+            i++;
+        float position = (counts - curve.counts[i - 1]) / (curve.counts[i] - curve.counts[i - 1]);
+        return curve.values[i - 1] + (curve.values[i] - curve.values[i - 1]) * position;
+    }
+    default:
+        return counts;
+    }
+}
+
+/**
+ * @brief Tells whether a curve has the number of values of its kind, and a table increasing counts.
+ */
+bool isValidCurve(const CalibrationCurve &curve)
+{
+    if (curve.kind == CURVE_POLYNOMIAL)
+        return curve.count >= 1 && curve.count <= 4;
+    if (curve.kind == CURVE_INVERSE)
+        return curve.count == 2;
+    if (curve.kind != CURVE_TABLE)
+        return false;
+    for (uint8_t i = 1; i < curve.count; i++)
+    {
+        if (!(curve.counts[i] > curve.counts[i - 1]))
+            return false;
+    }
+    return curve.count >= 2;
+}
+
+/**
+ * @brief Reads a line of the calibration file, see calibration.h.
+ *
+ * @return true if it describes a valid curve.
+ */
+bool parseCalibrationLine(const char *line, uint8_t *channel, uint8_t *gain, CalibrationCurve *curve)
+{
+    char name[16], gainText[16];
+    int consumed = 0;
+    if (sscanf(line, "%15s %15s%n", name, gainText, &consumed) != 2)
+        return false;
+
+    *channel = CALIBRATION_CHANNELS;
+    for (uint8_t i = 0; i < CALIBRATION_CHANNELS; i++)
+    {
+        if (strcmp(name, channelNames[i]) == 0)
+            *channel = i;
+    }
+    char *end;
+    long index = strtol(gainText, &end, 10);
+    if (strcmp(gainText, "default") == 0)
+        *gain = CALIBRATION_DEFAULT_GAIN;
+    else if (*end == '\0' && end != gainText && index >= 0 && index < CALIBRATION_DEFAULT_GAIN)
+        *gain = (uint8_t)index;
+    else
+        return false;
+
+    return parseCurve(line + consumed, curve) && *channel != CALIBRATION_CHANNELS;
+}
+
+/**
+ * @brief Reads the kind and values of a curve, as they follow the gain on a line of the
+ * calibration file: "poly -0.0025 0.000812659".
+ *
+ * @return true if they describe a valid curve.
+ */
+bool parseCurve(const char *text, CalibrationCurve *curve)
+{
+    char kind[16];
+    int consumed = 0;
+    if (sscanf(text, "%15s%n", kind, &consumed) != 1)
+        return false;
+
+    if (strcmp(kind, "poly") == 0)
+        curve->kind = CURVE_POLYNOMIAL;
+    else if (strcmp(kind, "inverse") == 0)
+        curve->kind = CURVE_INVERSE;
+    else if (strcmp(kind, "table") == 0)
+        curve->kind = CURVE_TABLE;
+    else
+        return false;
+
+    text += consumed;
+    char *end;
+    curve->count = 0;
+    for (;;)
+    {
+        while (*text == ' ' || *text == '\t')
+            text++;
+        if (*text == '\0')
+            break;
+        if (curve->count == CALIBRATION_MAX_POINTS)
+            return false;
+        if (curve->kind == CURVE_TABLE)
+        {
+            curve->counts[curve->count] = strtof(text, &end);
+            if (end == text || *end != ':')
+                return false;
+            text = end + 1;
+        }
+        curve->values[curve->count] = strtof(text, &end);
+        if (end == text || !isfinite(curve->values[curve->count]) || (*end != '\0' && *end != ' ' && *end != '\t'))
+            return false;
+        text = end;
+        curve->count++;
+    }
+
+    return isValidCurve(*curve);
+}
+
+/**
+ * @brief Writes the kind and values of a curve the way parseCurve() reads them.
+ *
+ * @param buffer At least CALIBRATION_CURVE_TEXT_SIZE bytes long.
+ * @return A pointer to the terminator.
+ */
+char *formatCurve(char *buffer, const CalibrationCurve &curve)
+{
+    static const char *kindNames[] = {"none", "poly", "inverse", "table"};
+    char *end = buffer + sprintf(buffer, "%s", kindNames[curve.kind <= CURVE_TABLE ? curve.kind : 0]);
+    for (uint8_t i = 0; i < curve.count && i < CALIBRATION_MAX_POINTS; i++)
+    {
+        if (curve.kind == CURVE_TABLE)
+            end += sprintf(end, " %.9g:%.9g", curve.counts[i], curve.values[i]);
+        else
+            end += sprintf(end, " %.9g", curve.values[i]);
+    }
+    return end;
+}
+
+/**
+ * @brief Reads the curves of a calibration file, each into curves[channel][gain].
+ *
+ * @param errorLine Set to the number of the first line that is not a valid curve, 0 if there is none;
+ *                  the other lines are still read.
+ * @return The number of curves read.
+ */
+int parseCalibration(const char *text, CalibrationCurve curves[CALIBRATION_CHANNELS][CALIBRATION_GAINS], int *errorLine)
+{
+    int found = 0, number = 0;
+    *errorLine = 0;
+    while (*text)
+    {
+        number++;
+        const char *end = strchr(text, '\n');
+        size_t length = end ? (size_t)(end - text) : strlen(text);
+        char line[CALIBRATION_LINE_SIZE];
+        size_t copied = length < sizeof(line) - 1 ? length : sizeof(line) - 1;
+        memcpy(line, text, copied);
+        line[copied] = '\0';
+        if (copied > 0 && line[copied - 1] == '\r')
+            line[--copied] = '\0';
+        text += end ? length + 1 : length;
+
+        const char *start = line + strspn(line, " \t");
+        if (*start == '\0' || *start == '#')
+            continue;
+        uint8_t channel, gain;
+        CalibrationCurve curve;
+        if (length < sizeof(line) - 1 && parseCalibrationLine(start, &channel, &gain, &curve))
+        {
+            curves[channel][gain] = curve;
+            found++;
+        }
+        else if (*errorLine == 0)
+            *errorLine = number;
+    }
+    return found;
+}
+
+/**
+ * @brief Fits a polynomial of a degree from 1 to 3 to points by least squares.
+ *
+ * The counts are centred and scaled to [-1, 1], and the fit is solved by Householder QR rather
+ * than the normal equations, so that a cubic over the whole range of the ADC stays well
+ * conditioned; the coefficients are then expanded to powers of the counts.
+ *
+ * @param residual Set to the RMS of the differences between the fitted curve and the points.
+ * @return false if there are not more points than the degree, or not enough different counts.
+ */
+bool fitCurve(const float *counts, const float *values, uint8_t points, uint8_t degree, CalibrationCurve *curve, float *residual)
+{
+    if (degree < 1 || degree > 3 || points <= degree || points > CALIBRATION_MAX_POINTS)
+        return false;
+    uint8_t columns = degree + 1;
+
+    double low = counts[0], high = counts[0];
+    for (uint8_t i = 1; i < points; i++)
+    {
+        low = fmin(low, counts[i]);
+        high = fmax(high, counts[i]);
+    }
+    double centre = (low + high) / 2, scale = (high - low) / 2;
+    if (!(scale > 0))
+        return false;
+
+    double a[CALIBRATION_MAX_POINTS][4], b[CALIBRATION_MAX_POINTS], v[CALIBRATION_MAX_POINTS];
+    for (uint8_t i = 0; i < points; i++)
+    {
+        double t = (counts[i] - centre) / scale, power = 1;
+        for (uint8_t j = 0; j < columns; j++, power *= t)
+            a[i][j] = power;
+        b[i] = values[i];
+    }
+
+    // a becomes R and b becomes Q^T b, one reflection per column
+    for (uint8_t k = 0; k < columns; k++)
+    {
+        double norm = 0;
+        for (uint8_t i = k; i < points; i++)
+            norm += a[i][k] * a[i][k];
+        norm = sqrt(norm);
+        double alpha = a[k][k] > 0 ? -norm : norm;
+        double length = 0;
+        for (uint8_t i = k; i < points; i++)
+        {
+            v[i] = a[i][k] - (i == k ? alpha : 0);
+            length += v[i] * v[i];
+        }
+        // The same counts repeated, or too few of them for the degree
+        if (!(fabs(alpha) > 1e-9 * points) || length == 0)
+            return false;
+        for (uint8_t j = k + 1; j <= columns; j++)
+        {
+            double dot = 0;
+            for (uint8_t i = k; i < points; i++)
+                dot += v[i] * (j < columns ? a[i][j] : b[i]);
+            double factor = 2 * dot / length;
+            for (uint8_t i = k; i < points; i++)
+            {
+                if (j < columns)
+                    a[i][j] -= factor * v[i];
+                else
+                    b[i] -= factor * v[i];
+            }
+        }
+        a[k][k] = alpha;
+    }
+
+    double fitted[4];
+    for (int j = columns - 1; j >= 0; j--)
+    {
+        double sum = b[j];
+        for (uint8_t m = j + 1; m < columns; m++)
+            sum -= a[j][m] * fitted[m];
+        fitted[j] = sum / a[j][j];
+    }
+
+    // Horner in the variable (x - centre) / scale, with polynomials in x
+    double expanded[4] = {0, 0, 0, 0};
+    for (int j = columns - 1; j >= 0; j--)
+    {
+        for (int m = columns - 1; m >= 0; m--)
+            expanded[m] = ((m > 0 ? expanded[m - 1] : 0) - centre * expanded[m]) / scale;
+        expanded[0] += fitted[j];
+    }
+
+    curve->kind = CURVE_POLYNOMIAL;
+    curve->count = columns;
+    for (uint8_t j = 0; j < columns; j++)
+        curve->values[j] = (float)expanded[j];
+    double squares = 0;
+    for (uint8_t i = 0; i < points; i++)
+    {
+        double difference = evaluateCurve(*curve, counts[i]) - values[i];
+        squares += difference * difference;
+    }
+    *residual = (float)sqrt(squares / points);
+    return true;
+}
+
+CalibrationTable::CalibrationTable()
+{
+    CalibrationCurve identity;
+    identity.kind = CURVE_NONE;
+    identity.count = 0;
+    compile(identity);
+}
+
+/**
+ * @brief Returns the counts of a node of the table, see calibration.h.
+ */
+float CalibrationTable::nodeCounts(uint16_t node)
+{
+    if (node < CALIBRATION_LINEAR)
+        return node;
+    uint16_t octave = (node - CALIBRATION_LINEAR) / CALIBRATION_OCTAVE_NODES;
+    uint16_t step = (node - CALIBRATION_LINEAR) % CALIBRATION_OCTAVE_NODES;
+    return ldexpf(CALIBRATION_LINEAR + step, octave);
+}
+
+/**
+ * @brief Computes the table of a curve.
+ *
+ * The unit of the table is the power of two that keeps its largest value below 2^30, so that
+ * the interpolation cannot overflow. Values that are not finite are stored as 0.
+ */
+void CalibrationTable::compile(const CalibrationCurve &curve)
+{
+    float largest = 0;
+    for (uint16_t node = 0; node < CALIBRATION_NODES; node++)
+    {
+        float counts = nodeCounts(node);
+        float values[2] = {evaluateCurve(curve, counts), evaluateCurve(curve, -counts)};
+        for (float value : values)
+        {
+            if (isfinite(value) && fabsf(value) > largest)
+                largest = fabsf(value);
+        }
+    }
+
+    int exponent;
+    frexpf(largest, &exponent);
+    unit = ldexpf(1, exponent - 30);
+    for (uint16_t node = 0; node < CALIBRATION_NODES; node++)
+    {
+        float counts = nodeCounts(node);
+        float high = evaluateCurve(curve, counts), low = evaluateCurve(curve, -counts);
+        positive[node] = isfinite(high) ? (int32_t)lroundf(high / unit) : 0;
+        negative[node] = isfinite(low) ? (int32_t)lroundf(low / unit) : 0;
+    }
+}
+
+/**
+ * @brief Converts a number of counts that need not be whole, such as the mean of a window.
+ */
+float CalibrationTable::convert(float counts) const
+{
+    const int32_t *nodes = counts < 0 ? negative : positive;
+    float magnitude = fabsf(counts);
+    if (!(magnitude < 32768))
+        magnitude = 32768;
+    uint32_t whole = (uint32_t)magnitude;
+
+    uint16_t node = whole;
+    float position = magnitude - whole;
+    if (whole >= CALIBRATION_LINEAR)
+    {
+        uint8_t octave = 31 - __builtin_clz(whole);
+        uint8_t shift = octave - CALIBRATION_OCTAVE_BITS;
+        node = (octave - CALIBRATION_OCTAVE_BITS) * CALIBRATION_OCTAVE_NODES + (whole >> shift);
+        position = (magnitude - ((whole >> shift) << shift)) / (1U << shift);
+    }
+    return (nodes[node] + (nodes[node + 1] - nodes[node]) * position) * unit;
+}
+
+/**
+ * @brief Returns the largest difference between the table and its curve, in the units of the
+ * curve, for the samples halfway between two nodes. Below CALIBRATION_LINEAR every sample is a
+ * node.
+ */
+float CalibrationTable::getError(const CalibrationCurve &curve) const
+{
+    float largest = 0;
+    for (uint16_t node = CALIBRATION_LINEAR; node + 2 < CALIBRATION_NODES; node++)
+    {
+        int32_t counts = (int32_t)(nodeCounts(node) + nodeCounts(node + 1)) / 2;
+        int32_t samples[2] = {counts, -counts};
+        for (int32_t sample : samples)
+        {
+            float error = fabsf(convert((int16_t)sample) * unit - evaluateCurve(curve, sample));
+            if (isfinite(error) && error > largest)
+                largest = error;
+        }
+    }
+    return largest;
+}
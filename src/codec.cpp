@@ -0,0 +1,314 @@
+#include "../include/codec.h"
+
+// Bits are appended MSB first to a 32-bit accumulator and emitted a byte at a time
+struct BitWriter
+{
+    uint8_t *out;
+    uint32_t accumulator;
+    uint8_t pending; // Bits in the accumulator
+};
+
+// Bits are read MSB first through a 64-bit accumulator refilled a byte at a time
+struct BitReader
+{
+    const uint8_t *in;
+    const uint8_t *end;
+    uint64_t accumulator;
+    uint8_t available; // Bits in the accumulator, at most 56
+};
+
+static inline void putBits(BitWriter *writer, uint32_t value, uint8_t bits)
+{
+    // Never more than 24 bits at a time, so the accumulator cannot overflow
+    writer->accumulator = (writer->accumulator << bits) | (value & ((1UL << bits) - 1));
+    writer->pending += bits;
+    while (writer->pending >= 8)
+    {
+        writer->pending -= 8;
+        *writer->out++ = (uint8_t)(writer->accumulator >> writer->pending);
+    }
+}
+
+static inline void putOnes(BitWriter *writer, uint8_t count)
+{
+    while (count > 16)
+    {
+        putBits(writer, 0xFFFF, 16);
+        count -= 16;
+    }
+    putBits(writer, 0xFFFF, count);
+}
+
+static inline void refill(BitReader *reader)
+{
+    while (reader->available <= 48 && reader->in != reader->end)
+    {
+        reader->accumulator = (reader->accumulator << 8) | *reader->in++;
+        reader->available += 8;
+    }
+}
+
+static inline bool getBits(BitReader *reader, uint8_t bits, uint32_t *value)
+{
+    if (reader->available < bits)
+    {
+        refill(reader);
+        if (reader->available < bits)
+            return false;
+    }
+    reader->available -= bits;
+    *value = (uint32_t)(reader->accumulator >> reader->available) & ((1UL << bits) - 1);
+    return true;
+}
+
+/**
+ * @brief Reads the unary quotient of a residual: ones up to a zero, or CODEC_ESCAPE ones.
+ *
+ * The ones are counted with a count-leading-zeros instruction, as many at a time as the
+ * accumulator holds, instead of one bit per call.
+ */
+static inline bool getUnary(BitReader *reader, uint32_t *quotient)
+{
+    *quotient = 0;
+    for (;;)
+    {
+        if (reader->available == 0)
+        {
+            refill(reader);
+            if (reader->available == 0)
+                return false;
+        }
+
+        // Align the unread bits to the top; the bits below them become ones in ~top, so the
+        // count stops at the end of the unread bits
+        uint64_t top = reader->accumulator << (64 - reader->available);
+        uint32_t ones = __builtin_clzll(~top);
+        if (ones > CODEC_ESCAPE - *quotient)
+            ones = CODEC_ESCAPE - *quotient;
+        *quotient += ones;
+        reader->available -= ones;
+
+        if (*quotient == CODEC_ESCAPE)
+            return true;
+        if (reader->available > 0)
+        {
+            reader->available--; // The terminating zero
+            return true;
+        }
+    }
+}
+
+static inline uint32_t zigzag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static inline int32_t predict(const int16_t *samples, uint16_t i, uint8_t order)
+{
+    if (order == 0 || i == 0)
+        return 0;
+    if (order == 1 || i == 1)
+        return samples[i - 1];
+    return 2 * (int32_t)samples[i - 1] - samples[i - 2];
+}
+
+static inline uint8_t bitLength(uint32_t value)
+{
+    uint8_t length = 0;
+    while (value)
+    {
+        length++;
+        value >>= 1;
+    }
+    return length;
+}
+
+/**
+ * @brief Computes the exact size in bits of the residuals coded with a given k.
+ */
+static uint32_t riceCost(const uint32_t *residuals, uint16_t count, uint8_t k)
+{
+    uint32_t bits = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint32_t quotient = residuals[i] >> k;
+        bits += quotient < CODEC_ESCAPE ? quotient + 1 + k : CODEC_ESCAPE + CODEC_ESCAPE_BITS;
+    }
+    return bits;
+}
+
+/**
+ * @brief Picks the Rice parameter for a block of residuals.
+ *
+ * The optimum is close to log2 of the mean residual, so only that value and its two
+ * neighbours are costed exactly.
+ *
+ * @param bits Receives the size in bits of the residuals coded with the returned k.
+ */
+static uint8_t chooseK(const uint32_t *residuals, uint16_t count, uint32_t *bits)
+{
+    uint32_t sum = 0;
+    for (uint16_t i = 0; i < count; i++)
+        sum += residuals[i];
+
+    uint8_t estimate = bitLength(sum / count);
+    uint8_t best = 0;
+    *bits = UINT32_MAX;
+    for (int8_t k = (int8_t)estimate - 1; k <= (int8_t)estimate + 1; k++)
+    {
+        if (k < 0 || k > CODEC_MAX_K)
+            continue;
+        uint32_t cost = riceCost(residuals, count, (uint8_t)k);
+        if (cost < *bits)
+        {
+            *bits = cost;
+            best = (uint8_t)k;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Compresses a block of samples.
+ *
+ * Both predictor orders are tried and the smaller result is kept; the block is stored
+ * verbatim when neither is smaller than the raw samples.
+ *
+ * @param samples The samples to compress.
+ * @param count The number of samples, 1 to CODEC_BLOCK_SAMPLES.
+ * @param out The destination, at least CODEC_MAX_SIZE bytes long.
+ * @return The size of the compressed block, 0 if count is out of range.
+ */
+size_t encodeBlock(const int16_t *samples, uint16_t count, uint8_t *out)
+{
+    static uint32_t residuals[2][CODEC_BLOCK_SAMPLES];
+
+    if (count == 0 || count > CODEC_BLOCK_SAMPLES)
+        return 0;
+
+    uint8_t bestOrder = CODEC_VERBATIM;
+    uint8_t bestK = 0;
+    uint32_t bestBits = 16UL * count;
+    for (uint8_t order = CODEC_DELTA1; order <= CODEC_DELTA2; order++)
+    {
+        uint32_t *residual = residuals[order - 1];
+        for (uint16_t i = 0; i < count; i++)
+            residual[i] = zigzag(samples[i] - predict(samples, i, order));
+
+        uint32_t bits;
+        uint8_t k = chooseK(residual, count, &bits);
+        if (bits < bestBits)
+        {
+            bestBits = bits;
+            bestOrder = order;
+            bestK = k;
+        }
+    }
+
+    out[0] = (uint8_t)(bestK << 4 | bestOrder);
+    out[1] = (uint8_t)count;
+    out[2] = (uint8_t)(count >> 8);
+
+    if (bestOrder == CODEC_VERBATIM)
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            out[CODEC_HEADER_SIZE + 2 * i] = (uint8_t)samples[i];
+            out[CODEC_HEADER_SIZE + 2 * i + 1] = (uint8_t)((uint16_t)samples[i] >> 8);
+        }
+        return CODEC_HEADER_SIZE + 2 * count;
+    }
+
+    BitWriter writer = {out + CODEC_HEADER_SIZE, 0, 0};
+    const uint32_t *residual = residuals[bestOrder - 1];
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint32_t quotient = residual[i] >> bestK;
+        if (quotient < CODEC_ESCAPE)
+        {
+            putOnes(&writer, (uint8_t)quotient);
+            putBits(&writer, 0, 1);
+            if (bestK > 0)
+                putBits(&writer, residual[i], bestK);
+        }
+        else
+        {
+            putOnes(&writer, CODEC_ESCAPE);
+            putBits(&writer, residual[i], CODEC_ESCAPE_BITS);
+        }
+    }
+    if (writer.pending > 0)
+        putBits(&writer, 0, 8 - writer.pending);
+
+    return writer.out - out;
+}
+
+/**
+ * @brief Decompresses a block produced by encodeBlock().
+ *
+ * Every field is checked against the input length and the capacity of the destination,
+ * so corrupted or truncated data is rejected instead of being read past its end.
+ *
+ * @param in The compressed block.
+ * @param length The size of the compressed block.
+ * @param samples The destination.
+ * @param capacity The number of samples the destination can hold.
+ * @return The number of samples decoded, or -1 if the block is malformed.
+ */
+int decodeBlock(const uint8_t *in, size_t length, int16_t *samples, uint16_t capacity)
+{
+    if (length < CODEC_HEADER_SIZE)
+        return -1;
+
+    uint8_t order = in[0] & 0x0F;
+    uint8_t k = in[0] >> 4;
+    uint16_t count = in[1] | (uint16_t)in[2] << 8;
+    if (order > CODEC_DELTA2 || count == 0 || count > CODEC_BLOCK_SAMPLES || count > capacity)
+        return -1;
+
+    if (order == CODEC_VERBATIM)
+    {
+        if (length != CODEC_HEADER_SIZE + 2 * (size_t)count || k != 0)
+            return -1;
+        for (uint16_t i = 0; i < count; i++)
+            samples[i] = (int16_t)(in[CODEC_HEADER_SIZE + 2 * i] | in[CODEC_HEADER_SIZE + 2 * i + 1] << 8);
+        return count;
+    }
+
+    BitReader reader = {in + CODEC_HEADER_SIZE, in + length, 0, 0};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint32_t quotient;
+        if (!getUnary(&reader, &quotient))
+            return -1;
+
+        uint32_t residual;
+        if (quotient == CODEC_ESCAPE)
+        {
+            if (!getBits(&reader, CODEC_ESCAPE_BITS, &residual))
+                return -1;
+        }
+        else
+        {
+            uint32_t remainder = 0;
+            if (k > 0 && !getBits(&reader, k, &remainder))
+                return -1;
+            residual = quotient << k | remainder;
+        }
+
+        int32_t value = unzigzag(residual) + predict(samples, i, order);
+        if (value < INT16_MIN || value > INT16_MAX)
+            return -1;
+        samples[i] = (int16_t)value;
+    }
+
+    // Only the padding of the last byte may be left
+    if (reader.in != reader.end || reader.available >= 8)
+        return -1;
+    return count;
+}
@@ -0,0 +1,105 @@
+#include <string.h>
+#include "../include/command.h"
+#include "../include/crc32.h"
+
+/**
+ * @brief Creates a parser for the frames starting with the given byte.
+ *
+ * @param start COMMAND_REQUEST on the logger, COMMAND_REPLY on the PC.
+ */
+CommandParser::CommandParser(uint8_t start)
+{
+    this->start = start;
+    received = 0;
+    lastByte = 0;
+}
+
+/**
+ * @brief Takes the next byte received, without ever waiting for the following ones.
+ *
+ * Outside a frame every byte other than the start byte is returned to the caller as
+ * COMMAND_NONE, so single-character commands keep working on the same port. A frame that
+ * stops arriving for COMMAND_TIMEOUT milliseconds is dropped.
+ *
+ * @param now The current time in milliseconds.
+ * @return What the byte was, see COMMAND_PARSE.
+ */
+COMMAND_PARSE CommandParser::feed(uint8_t byte, uint32_t now)
+{
+    if (received > 0 && now - lastByte > COMMAND_TIMEOUT)
+        received = 0;
+
+    if (received == 0)
+    {
+        if (byte != start)
+            return COMMAND_NONE;
+        frame[received++] = byte;
+        lastByte = now;
+        return COMMAND_PENDING;
+    }
+
+    frame[received++] = byte;
+    lastByte = now;
+    if (received < 3)
+        return COMMAND_PENDING;
+
+    uint8_t length = frame[2];
+    if (length > COMMAND_MAX_PAYLOAD)
+    {
+        received = 0;
+        return COMMAND_REJECTED;
+    }
+    if (received < COMMAND_OVERHEAD + length)
+        return COMMAND_PENDING;
+
+    received = 0;
+    const uint8_t *crc = frame + 3 + length;
+    uint32_t expected = crc[0] | (uint32_t)crc[1] << 8 | (uint32_t)crc[2] << 16 | (uint32_t)crc[3] << 24;
+    if (crc32(0, frame + 1, 2 + length) != expected)
+        return COMMAND_REJECTED;
+    return COMMAND_READY;
+}
+
+/**
+ * @brief Returns the code of the last complete frame.
+ */
+uint8_t CommandParser::getCommand() const
+{
+    return frame[1];
+}
+
+uint8_t CommandParser::getLength() const
+{
+    return frame[2];
+}
+
+const uint8_t *CommandParser::getPayload() const
+{
+    return frame + 3;
+}
+
+/**
+ * @brief Builds a frame.
+ *
+ * @param out The destination, at least COMMAND_OVERHEAD + length bytes long.
+ * @return The size of the frame, 0 if the payload is too long.
+ */
+size_t encodeCommand(uint8_t start, uint8_t command, const uint8_t *payload, uint8_t length, uint8_t *out)
+{
+    if (length > COMMAND_MAX_PAYLOAD)
+        return 0;
+
+    out[0] = start;
+    out[1] = command;
+    out[2] = length;
+    if (length > 0)
+        memcpy(out + 3, payload, length);
+
+    uint32_t crc = crc32(0, out + 1, 2 + length);
+    uint8_t *end = out + 3 + length;
+    end[0] = (uint8_t)crc;
+    end[1] = (uint8_t)(crc >> 8);
+    end[2] = (uint8_t)(crc >> 16);
+    end[3] = (uint8_t)(crc >> 24);
+    return COMMAND_OVERHEAD + length;
+}
@@ -0,0 +1,372 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <ArduinoJson.h>
+#include "../include/config.h"
+#include "../include/ads1115.h"
+#include "../include/command.h"
+
+#define CONFIG_PATH_SIZE 32
+#define CONFIG_MAX_MINUTES 1440 // Of a session file
+
+static const char *channelNames[CALIBRATION_CHANNELS] = {"voltage", "current", "resistance"};
+static const char *outputNames[] = {"display", "serial", "sd"}; // By MODE of the controller
+#define CONFIG_OUTPUTS 3
+
+// Where the checks below write the first error found
+static char *errorText;
+static size_t errorLimit;
+
+ConfigSource::ConfigSource() : length(0), position(0), total(0)
+{
+}
+
+/**
+ * @brief Returns the next byte of the file, or -1 at its end.
+ */
+int ConfigSource::read()
+{
+    if (position == length)
+    {
+        position = 0;
+        length = fill(buffer, sizeof(buffer));
+        if (length == 0)
+            return -1;
+    }
+    total++;
+    return (uint8_t)buffer[position++];
+}
+
+size_t ConfigSource::readBytes(char *data, size_t size)
+{
+    size_t count = 0;
+    for (int byte; count < size && (byte = read()) >= 0;)
+        data[count++] = (char)byte;
+    return count;
+}
+
+/**
+ * @brief Writes the error of a member, or of the whole file if path is empty.
+ */
+static bool reject(const char *path, const char *message)
+{
+    snprintf(errorText, errorLimit, "%s%s%s", path, path[0] ? ": " : "", message);
+    return false;
+}
+
+/**
+ * @brief Writes the path of a member (key) or of an item of an array (index, with a null key).
+ *
+ * A path longer than CONFIG_PATH_SIZE - 1 characters is cut, which only shortens the message.
+ */
+static void childPath(char *child, const char *path, const char *key, unsigned index)
+{
+    char item[16];
+    snprintf(item, sizeof(item), "[%u]", index);
+    const char *parts[] = {path, key ? "." : item, key ? key : ""};
+    size_t length = 0;
+    for (const char *part : parts)
+    {
+        while (*part && length < CONFIG_PATH_SIZE - 1)
+            child[length++] = *part++;
+    }
+    child[length] = '\0';
+}
+
+static bool readFlag(JsonVariantConst value, const char *path, uint8_t *flag)
+{
+    if (!value.is<bool>())
+        return reject(path, "not true or false");
+    *flag = value.as<bool>();
+    return true;
+}
+
+static bool readInteger(JsonVariantConst value, const char *path, long low, long high, long *integer)
+{
+    if (!value.is<long>())
+        return reject(path, "not an integer");
+    *integer = value.as<long>();
+    if (*integer < low || *integer > high)
+        return reject(path, "out of range");
+    return true;
+}
+
+/**
+ * @brief Reads a string that must be one of names, as its index.
+ */
+static bool readName(JsonVariantConst value, const char *path, const char *const *names, uint8_t count, uint8_t *index)
+{
+    if (value.is<const char *>())
+    {
+        const char *text = value.as<const char *>();
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (strcmp(text, names[i]) == 0)
+            {
+                *index = i;
+                return true;
+            }
+        }
+    }
+    return reject(path, "not a known name");
+}
+
+/**
+ * @brief Reads a gain: an index in the gains of SET_CONFIG, or "default" as COMMAND_GAIN_DEFAULT.
+ */
+static bool readGain(JsonVariantConst value, const char *path, uint8_t *gain)
+{
+    if (value.is<const char *>() && strcmp(value.as<const char *>(), "default") == 0)
+    {
+        *gain = COMMAND_GAIN_DEFAULT;
+        return true;
+    }
+    if (!value.is<long>())
+        return reject(path, "not an index or \"default\"");
+    long index;
+    if (!readInteger(value, path, 0, ADC_GAIN_COUNT - 1, &index))
+        return false;
+    *gain = (uint8_t)index;
+    return true;
+}
+
+static bool readRate(JsonVariantConst value, const char *path, Settings *settings)
+{
+    long samples;
+    if (!readInteger(value, path, 1, 65535, &samples))
+        return false;
+    if (adcRateIndex(samples) < 0)
+        return reject(path, "not a rate of the ADC");
+    settings->rate = (uint16_t)samples;
+    return true;
+}
+
+static bool readNumber(JsonVariantConst value, const char *path, float *number)
+{
+    if (!value.is<float>())
+        return reject(path, "not a number");
+    *number = value.as<float>();
+    if (!isfinite(*number))
+        return reject(path, "out of range");
+    return true;
+}
+
+static bool readRotation(JsonVariantConst value, const char *path, const ConfigLimits &limits, LoggerConfig *config)
+{
+    if (!value.is<JsonObjectConst>())
+        return reject(path, "not an object");
+    for (JsonPairConst member : value.as<JsonObjectConst>())
+    {
+        char memberPath[CONFIG_PATH_SIZE];
+        childPath(memberPath, path, member.key().c_str(), 0);
+        long amount;
+        if (strcmp(member.key().c_str(), "megabytes") == 0)
+        {
+            if (!readInteger(member.value(), memberPath, 1, limits.maxRotateSize >> 20, &amount))
+                return false;
+            config->rotateSize = (uint32_t)amount << 20;
+        }
+        else if (strcmp(member.key().c_str(), "minutes") == 0)
+        {
+            if (!readInteger(member.value(), memberPath, 1, CONFIG_MAX_MINUTES, &amount))
+                return false;
+            config->rotateDuration = (uint32_t)amount * 60000;
+        }
+        else
+            return reject(memberPath, "unknown member");
+    }
+    return true;
+}
+
+static bool readSinks(JsonVariantConst value, const char *path, LoggerConfig *config)
+{
+    if (!value.is<JsonObjectConst>())
+        return reject(path, "not an object");
+    for (JsonPairConst member : value.as<JsonObjectConst>())
+    {
+        char memberPath[CONFIG_PATH_SIZE];
+        childPath(memberPath, path, member.key().c_str(), 0);
+        uint8_t flag;
+        if (strcmp(member.key().c_str(), "output") == 0)
+        {
+            if (!readName(member.value(), memberPath, outputNames, CONFIG_OUTPUTS, &config->settings.mode))
+                return false;
+        }
+        else if (strcmp(member.key().c_str(), "compressed") == 0)
+        {
+            if (!readFlag(member.value(), memberPath, &config->settings.compressed))
+                return false;
+        }
+        else if (strcmp(member.key().c_str(), "mqtt_raw") == 0)
+        {
+            if (!readFlag(member.value(), memberPath, &flag))
+                return false;
+            config->mqttRaw = flag;
+        }
+        else
+            return reject(memberPath, "unknown member");
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the values of a curve: numbers, or [counts, value] pairs for a table.
+ */
+static bool readCurve(JsonVariantConst value, const char *path, uint8_t kind, CalibrationCurve *curve)
+{
+    if (!value.is<JsonArrayConst>())
+        return reject(path, "not an array");
+    JsonArrayConst values = value.as<JsonArrayConst>();
+    if (values.size() > CALIBRATION_MAX_POINTS)
+        return reject(path, "too many values");
+    curve->kind = kind;
+    curve->count = 0;
+    for (JsonVariantConst item : values)
+    {
+        char itemPath[CONFIG_PATH_SIZE];
+        childPath(itemPath, path, NULL, curve->count);
+        if (kind == CURVE_TABLE)
+        {
+            JsonArrayConst point = item.as<JsonArrayConst>();
+            if (!item.is<JsonArrayConst>() || point.size() != 2)
+                return reject(itemPath, "not a [counts, value] pair");
+            if (!readNumber(point[0], itemPath, &curve->counts[curve->count]) ||
+                !readNumber(point[1], itemPath, &curve->values[curve->count]))
+                return false;
+        }
+        else if (!readNumber(item, itemPath, &curve->values[curve->count]))
+            return false;
+        curve->count++;
+    }
+    if (!isValidCurve(*curve))
+        return reject(path, kind == CURVE_TABLE ? "not 2 or more points in increasing counts" : "wrong number of values");
+    return true;
+}
+
+/**
+ * @brief Reads {"channel": ..., "gain": ..., and one of "poly", "inverse" or "table"} into the curves.
+ */
+static bool readCalibrationEntry(JsonVariantConst value, const char *path, LoggerConfig *config)
+{
+    static const char *kindNames[] = {"poly", "inverse", "table"};
+    static const uint8_t kinds[] = {CURVE_POLYNOMIAL, CURVE_INVERSE, CURVE_TABLE};
+    if (!value.is<JsonObjectConst>())
+        return reject(path, "not an object");
+
+    uint8_t channel = CALIBRATION_CHANNELS, gain = CALIBRATION_GAINS;
+    CalibrationCurve curve;
+    curve.kind = CURVE_NONE;
+    for (JsonPairConst member : value.as<JsonObjectConst>())
+    {
+        const char *key = member.key().c_str();
+        char memberPath[CONFIG_PATH_SIZE];
+        childPath(memberPath, path, key, 0);
+        uint8_t kind = 0;
+        while (kind < 3 && strcmp(key, kindNames[kind]) != 0)
+            kind++;
+
+        if (strcmp(key, "channel") == 0)
+        {
+            if (!readName(member.value(), memberPath, channelNames, CALIBRATION_CHANNELS, &channel))
+                return false;
+        }
+        else if (strcmp(key, "gain") == 0)
+        {
+            if (!readGain(member.value(), memberPath, &gain))
+                return false;
+            if (gain == COMMAND_GAIN_DEFAULT)
+                gain = CALIBRATION_DEFAULT_GAIN;
+        }
+        else if (kind < 3)
+        {
+            if (curve.kind != CURVE_NONE)
+                return reject(memberPath, "second curve of the entry");
+            if (!readCurve(member.value(), memberPath, kinds[kind], &curve))
+                return false;
+        }
+        else
+            return reject(memberPath, "unknown member");
+    }
+
+    if (channel == CALIBRATION_CHANNELS || gain == CALIBRATION_GAINS || curve.kind == CURVE_NONE)
+        return reject(path, "needs a channel, a gain and a curve");
+    config->curves[channel][gain] = curve;
+    return true;
+}
+
+static bool readCalibration(JsonVariantConst value, const char *path, LoggerConfig *config)
+{
+    if (!value.is<JsonArrayConst>())
+        return reject(path, "not an array");
+    unsigned index = 0;
+    for (JsonVariantConst entry : value.as<JsonArrayConst>())
+    {
+        char entryPath[CONFIG_PATH_SIZE];
+        childPath(entryPath, path, NULL, index++);
+        if (!readCalibrationEntry(entry, entryPath, config))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a configuration file, see config.h.
+ *
+ * @param config     Holds the configuration the file starts from, and receives that of the file
+ *                   only if the file is valid.
+ * @param poolUsed   Set to the bytes of the JSON document taken by the file, its peak as the pool
+ *                   only grows while it is parsed.
+ * @param error      Set to a message naming the member at fault, such as
+ *                   "calibration[1].table[2]: not a number", if the file is not valid.
+ * @return true if the file is valid.
+ */
+bool parseConfig(ConfigSource &source, const ConfigLimits &limits, LoggerConfig *config, size_t *poolUsed,
+                 char *error, size_t errorSize)
+{
+    static StaticJsonDocument<CONFIG_POOL_SIZE> document;
+    static LoggerConfig parsed;
+    errorText = error;
+    errorLimit = errorSize;
+    error[0] = '\0';
+
+    document.clear();
+    DeserializationError result = deserializeJson(document, source, DeserializationOption::NestingLimit(CONFIG_NESTING));
+    *poolUsed = document.memoryUsage();
+    if (result == DeserializationError::NoMemory)
+        return reject("", "too large for CONFIG_POOL_SIZE");
+    if (result)
+        return reject("", result.c_str());
+    if (!document.is<JsonObjectConst>())
+        return reject("", "not an object");
+
+    parsed = *config;
+    for (JsonPairConst member : document.as<JsonObjectConst>())
+    {
+        const char *key = member.key().c_str();
+        JsonVariantConst value = member.value();
+        long version;
+        bool valid;
+        if (strcmp(key, "version") == 0)
+            valid = readInteger(value, key, CONFIG_VERSION, CONFIG_VERSION, &version);
+        else if (strcmp(key, "channel") == 0)
+            valid = readName(value, key, channelNames, CALIBRATION_CHANNELS, &parsed.settings.channel);
+        else if (strcmp(key, "rate") == 0)
+            valid = readRate(value, key, &parsed.settings);
+        else if (strcmp(key, "gain") == 0)
+            valid = readGain(value, key, &parsed.settings.gain);
+        else if (strcmp(key, "autostart") == 0)
+            valid = readFlag(value, key, &parsed.settings.autostart);
+        else if (strcmp(key, "rotation") == 0)
+            valid = readRotation(value, key, limits, &parsed);
+        else if (strcmp(key, "sinks") == 0)
+            valid = readSinks(value, key, &parsed);
+        else if (strcmp(key, "calibration") == 0)
+            valid = readCalibration(value, key, &parsed);
+        else
+            valid = reject(key, "unknown member");
+        if (!valid)
+            return false;
+    }
+    *config = parsed;
+    return true;
+}
@@ -2,11 +2,26 @@
 #include "../include/controller.h"
 #include "../include/model.h"
 #include "../include/view.h"
+#include "../include/storage.h"
+#include "../include/blocks.h"
+#include "../include/command.h"
+#include "../include/webserver.h"
+#include "../include/live.h"
+#include "../include/web_assets.h"
+#include "../include/downloads.h"
+#include "../include/metrics.h"
+#include "../include/mqtt.h"
+#include "../include/calibration.h"
+#include "../include/settings.h"
+#include "../include/boot.h"
+#include "../include/config.h"
+#include "../include/ads1115.h"
+#include "../include/spectrum.h"
 #include "FS.h"
 #include "SD.h"
 #include "SPI.h"
 #include <WiFi.h>
-#include <WebServer.h>
+#include <Preferences.h>
 #include <Adafruit_ADS1X15.h>
 #include <Adafruit_BusIO_Register.h>
 #include <Ds1302.h>
@@ -29,23 +44,47 @@
 
 int16_t adcValue;
 
-// Variables current measurement
-const float FACTOR_I = 30;             // 30A/1V from teh current transformer
-const float multiplier_I = 0.00003125; // for current measurement and gain four (1.024V / 2^16 * 2)
-// const float multiplier_I = 0.000015625; // for current measurement and gain eight (0.512 / 2^16 * 2)
-
-// Variables voltage measurement
-const float FACTOR_V = 4.334335237;   // FACTOR_V = (R1 + R2) / R2    R1 resistor beetween Vin and A0 [ohm] and R2 resistor beetween A0 and GND [ohm]
-const float multiplier_V = 0.0001875; // for voltage measurement and gain twothirds (6.144V / 2^16 * 2)
-// const float multiplier_V = 0.000125;
-
-// Variables resistance measurement
-const float FACTOR_R = 999;          // FACTOR_R = R3 resistor beetween A1 and GND [ohm]
-const float multiplier_R = 0.000125; // for voltage measurement and unit gain (4.096 / 2^16 * 2)
-
+// The factors, gains and inputs of the channels are in ADC_CHANNELS (ads1115.h)
 float K_value;
 float O_value;
 
+// Curves of the calibration file, by channel and gain (calibration.h), and the table of the
+// acquisition compiled from one of them by adcSetup()
+CalibrationCurve calibrationCurves[CALIBRATION_CHANNELS][CALIBRATION_GAINS];
+CalibrationTable calibration;
+uint8_t calibrationKind = CURVE_NONE; // Of the file for the table, CURVE_NONE if nominal
+CalibrationCurve calibrationCurve;    // Of the table, written in the header of a session
+float calibrationError = 0;           // Largest difference between the table and its curve
+float (*nominalConversion)(float counts) = ADC_CONVERSIONS[VOLTAGE][0].convert; // Of the acquisition
+boolean calibrationLinear = true;     // The curve is a straight line, see conversionMeasurement()
+int64_t calibratedSum = 0;            // Of the samples of the window, converted by the table
+uint32_t calibratedCount = 0;
+
+// DECLARING THE GUIDED CALIBRATION (COMMAND_CALIBRATE), whose curves are kept in NVS
+#define CALIBRATION_NAMESPACE "calibration"
+boolean commandCalibrate = false;   // CALIBRATE_BEGIN received, the routine starts from the main loop
+boolean calibrating = false;
+uint8_t calibrationWindows = 4;     // Averaged at each reference point
+uint8_t calibrationDegree = 1;
+uint8_t calibrationPoints = 0;
+uint8_t calibrationCollected = 0;   // Windows of the point being measured
+boolean calibrationCollecting = false;
+boolean calibrationSettling = false; // The window under way began before the reference was applied
+float calibrationSum = 0;
+float calibrationCounts[CALIBRATION_MAX_POINTS];
+float calibrationReferences[CALIBRATION_MAX_POINTS];
+
+// DECLARING THE SPECTRUM MODE (COMMAND_SPECTRUM), whose blocks are read from the ring of the live stream
+#define SPECTRUM_FRAME_INTERVAL 500 // Milliseconds between two bar plots: the screen takes longer than a sample
+SpectrumAnalyzer spectrum;
+boolean commandSpectrum = false; // SPECTRUM received, the mode starts from the main loop
+boolean analyzing = false;
+uint16_t spectrumSize = SPECTRUM_MAX_SIZE;
+uint8_t spectrumWindow = SPECTRUM_HANN;
+uint32_t spectrumSequence = 0; // Spectra sent since the mode started
+uint32_t spectrumDue = 0;      // Samples in the ring when the next spectrum is due
+uint32_t spectrumFrame = 0;    // millis() of the last bar plot
+
 const static char *WeekDays[] =
     {
         "Monday",
@@ -68,28 +107,105 @@ int selectDuration = 200;
 // DECLARING VARIABLES FOR ADS
 #define ALERT_PIN 32
 
-int dataRateValues[] = {8, 16, 32, 64, 128, 250, 475, 860};
+// The rates, gains and inputs are those of ads1115.h, whose codes must be the library's
+static_assert(ADC_RATES[0].code == RATE_ADS1115_8SPS && ADC_RATES[1].code == RATE_ADS1115_16SPS &&
+                  ADC_RATES[2].code == RATE_ADS1115_32SPS && ADC_RATES[3].code == RATE_ADS1115_64SPS &&
+                  ADC_RATES[4].code == RATE_ADS1115_128SPS && ADC_RATES[5].code == RATE_ADS1115_250SPS &&
+                  ADC_RATES[6].code == RATE_ADS1115_475SPS && ADC_RATES[7].code == RATE_ADS1115_860SPS,
+              "DR codes of ADC_RATES");
+static_assert(ADC_GAINS[0].code == GAIN_TWOTHIRDS && ADC_GAINS[1].code == GAIN_ONE && ADC_GAINS[2].code == GAIN_TWO &&
+                  ADC_GAINS[3].code == GAIN_FOUR && ADC_GAINS[4].code == GAIN_EIGHT && ADC_GAINS[5].code == GAIN_SIXTEEN,
+              "PGA codes of ADC_GAINS");
+static_assert(ADC_CHANNELS[VOLTAGE].mux == ADS1X15_REG_CONFIG_MUX_SINGLE_0 && ADC_CHANNELS[CURRENT].mux == ADS1X15_REG_CONFIG_MUX_DIFF_2_3 &&
+                  ADC_CHANNELS[RESISTANCE].mux == ADS1X15_REG_CONFIG_MUX_SINGLE_1,
+              "MUX codes of ADC_CHANNELS");
+uint8_t currentGain = COMMAND_GAIN_DEFAULT; // Index in ADC_GAINS, or the default gain of the channel
 
 // DECLARING VARIABLES FOR MODE AND CHANNEL DEFAULT CONTIONS
 MODE currentMode = SERIAL_ONLY;
 CHANNEL currentChannel = VOLTAGE;
-String currentChannelString = "Voltage"; // Used to communicate the current channel to the user through the serial
+const char *currentChannelString = "Voltage"; // Used to communicate the current channel to the user through the serial
 
 int currentSampleRate = 860;
 
 // DECLARING VARIABLES FOR EMPHIRICALLY EVALUATE PERFORMANCES
 unsigned long serialWaitingTime = 0;
 unsigned long time_now = 0;
-String currentTime;
+char currentTime[TIMESTAMP_SIZE];
 
 // DECLARING TIMEOUT RESPONSE SERIAL
 #define TIMEOUT 10000
 
+// DECLARING THE SERIAL LINK
+#ifndef SERIAL_BAUD
+#define SERIAL_BAUD 115200 // Can be raised at build time (-D SERIAL_BAUD=921600) or with the SET_BAUD command
+#endif
+#define SERIAL_MAX_BAUD 5000000      // Limit of the ESP32 UART
+#define SERIAL_TX_BUFFER 16384       // Driver transmit ring, filled without blocking while acquiring
+#define SERIAL_BATCH_SAMPLES 32      // 0xCC frames sent, or dropped when the ring is full, together
+#define SERIAL_BENCHMARK_CHUNK 256   // Bytes written at a time by the BENCHMARK command
+// Define SERIAL_RTS_PIN and SERIAL_CTS_PIN when the port is wired to an adapter with hardware flow control
+uint8_t serialBatch[SERIAL_BATCH_SAMPLES * 3];
+size_t serialBatchLength = 0;
+uint32_t droppedBatches = 0; // Batches of frames or records not sent because the ring was full
+uint32_t droppedSamples = 0;
+
 // DECLARING THE OBJECT OF MEASUREMENTS
 Measurement measurement(8);
 
-// DECLARING VARIABLES FOR SD CARD
-File file;
+// DECLARING THE COMPRESSED STREAMS
+void writeBlockSD(const uint8_t *record, size_t length, const BlockSummary *summary);
+void writeBlockSerial(const uint8_t *record, size_t length, const BlockSummary *summary);
+BlockWriter sdBlocks(writeBlockSD);
+BlockWriter serialBlocks(writeBlockSerial);
+boolean serialCompression = false; // Send compressed blocks instead of 0xCC frames
+
+// DECLARING THE SETTINGS KEPT IN NVS (settings.h)
+boolean autostart = false; // Start logging at boot
+Settings savedSettings;    // Last read or written, so that unchanged settings are not written again
+
+// DECLARING THE CONFIGURATION FILE (config.h), read at boot
+CalibrationCurve configCurves[CALIBRATION_CHANNELS][CALIBRATION_GAINS]; // Take the place of the calibration file's
+char configMessage[CONFIG_ERROR_SIZE] = "";                             // Outcome, shown with the boot timeline
+
+// DECLARING THE COMMAND CHANNEL
+CommandParser commandParser(COMMAND_REQUEST);
+char pendingKey = 0;            // Last single-character command received and not used yet
+boolean commandStart = false;   // START received, the acquisition begins from the main loop
+boolean commandStop = false;    // STOP received, the acquisition loop ends at the next select()
+boolean acquiring = false;
+uint32_t acquiredSamples = 0;   // Since the acquisition started
+uint32_t sentRecords = 0;       // Compressed records written to the card or the serial port
+uint32_t receivedCommands = 0;
+uint32_t rejectedCommands = 0;  // Frames with a wrong CRC or length
+uint64_t commandTime = 0;       // deviceMicros() when the last command frame was complete
+volatile uint32_t missedSamples = 0; // Conversions overwritten before the loop read them, since the acquisition started
+uint32_t longestWebPoll = 0;         // Longest pollWebClients() in microseconds, since the acquisition started
+uint32_t lastSelect = 0;             // micros() of the last select() of the acquisition loop, 0 before the first
+
+// DECLARING THE METRICS (metrics.h), never reset unlike the counters of the acquisition above
+static const uint32_t sdWriteBounds[] = {50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000};
+static const uint32_t sdSyncBounds[] = {1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000};
+static const uint32_t frameBounds[] = {1000, 2500, 5000, 10000, 20000, 40000, 80000, 160000};
+static const uint32_t loopBounds[] = {10, 25, 50, 100, 250, 500, 1000, 2500, 10000, 100000};
+static int32_t readFreeHeap() { return ESP.getFreeHeap(); }
+static int32_t readLargestBlock() { return ESP.getMaxAllocHeap(); }
+Counter samplesMetric("ds32_samples_acquired", "Samples read from the ADC.");
+Counter missedMetric("ds32_samples_missed", "Conversions overwritten before the loop read them.");
+Counter droppedMetric("ds32_serial_dropped_samples", "Samples not sent because the serial ring was full.");
+Counter serialBytesMetric("ds32_serial_sent_bytes", "Bytes queued on the serial port.");
+Gauge serialRingMetric("ds32_serial_ring_high_water_bytes", "Most bytes waiting in the serial transmit ring.");
+Histogram sdWriteMetric("ds32_sd_write_seconds", "Time to write a compressed record to the card.", sdWriteBounds, 10);
+Histogram sdSyncMetric("ds32_sd_sync_seconds", "Time to flush the records of a second and sync the session.", sdSyncBounds, 10);
+Histogram frameMetric("ds32_display_frame_seconds", "Time to draw the screen of the acquisition.", frameBounds, 8);
+Histogram loopMetric("ds32_loop_seconds", "Time between two turns of the acquisition loop.", loopBounds, 10);
+Gauge heapFreeMetric("ds32_heap_free_bytes", "Free heap.", readFreeHeap);
+Gauge heapBlockMetric("ds32_heap_largest_block_bytes", "Largest block that can be allocated from the heap.", readLargestBlock);
+Gauge settingsLoadMetric("ds32_settings_load_microseconds", "Time taken to read the settings from NVS at boot.");
+Gauge configParseMetric("ds32_config_parse_microseconds", "Time taken to read and check the configuration file at boot.");
+Gauge configPoolMetric("ds32_config_pool_bytes", "Bytes of the JSON document taken by the configuration file, of CONFIG_POOL_SIZE.");
+Gauge spectrumCyclesMetric("ds32_spectrum_fft_cycles", "Processor cycles taken by the last transform of the spectrum mode.");
+Gauge firstSampleMetric("ds32_boot_first_sample_microseconds", "Time from the start of the firmware to the first sample read from the ADC.");
 
 #ifndef IRAM_ATTR
 #define IRAM_ATTR
@@ -99,6 +215,10 @@ File file;
  * @brief Indicates whether new data is available.
  */
 volatile bool new_data = false;
+/**
+ * @brief Time of the last data ready interrupt (micros()), the time stamp of the sample.
+ */
+volatile uint32_t sampleMicros = 0;
 /**
  * @brief Interrupt service routine for handling new data ready event.
  *
@@ -107,12 +227,32 @@ volatile bool new_data = false;
  */
 void IRAM_ATTR NewDataReadyISR()
 {
+    if (new_data)
+    {
+        missedSamples++;
+        missedMetric.add();
+    }
+    sampleMicros = micros();
     new_data = true;
 }
 
 // DECLARING VARIABLES FOR WIFI
 const char *ssid = "Logger-Access-Point";
 const char *password = "logger1234";
+HttpServer webServer;
+LiveStream liveStream(webServer); // Samples and window statistics pushed to the browsers
+volatile boolean wifiStarted = false; // Set last by the Wi-Fi task, once the server listens
+
+// DECLARING THE MQTT PUBLISHER
+// Enabled by building with -D MQTT_BROKER=\"192.168.0.10\" -D MQTT_WIFI_SSID=\"...\" -D MQTT_WIFI_PASSWORD=\"...\":
+// the logger then joins that network too, and publishes the window statistics (and the samples
+// with -D MQTT_PUBLISH_RAW=1) to the broker, spooling them on the card while it is unreachable.
+#ifndef MQTT_PUBLISH_RAW
+#define MQTT_PUBLISH_RAW 0
+#endif
+boolean mqttPublishRaw = MQTT_PUBLISH_RAW; // Can be set by the configuration file
+const MqttSpool mqttSpool = {spoolAppend, spoolRead, spoolSize, spoolClear};
+MqttPublisher mqttPublisher(mqttSpool);
 
 bool isExecuted = false;
 
@@ -121,25 +261,38 @@ Ds1302 rtc(PIN_ENA, PIN_CLK, PIN_DAT);
 
 // DECLARING ADC
 Adafruit_ADS1115 ads;
+boolean adcReady = false; // Found on the I2C bus, tried again when an acquisition starts
+
+// DECLARING THE BOOT SEQUENCE (boot.h)
+#define SERIAL_WAIT 100      // Milliseconds to wait for a native USB port to be opened
+#define I2C_TIMEOUT 50       // Milliseconds before an I2C transfer to a missing device fails
+#define CARD_TIMEOUT 3000    // Milliseconds setup() waits for the card before going on without it
+#define BOOT_TASK_STACK 8192
+BootTimeline bootTimeline;
+volatile boolean cardMounting = false; // The card task has not finished, the card must not be used
+SemaphoreHandle_t cardDone = NULL;
 
 const char *creditString = "-------------------------------\nLogger\n-------------------------------\nContributors:\n- Vincenzo Pio Florio\n- Francesco Stasi\n- Davide Tonti\n-------------------------------\n";
 
 /**
  * @brief Initializes the serial monitor.
  *
- * This function initializes the serial monitor with a baud rate of 115200.
- * It waits for the serial port to connect before proceeding.
- * It also prints an "Initializing..." message to the serial monitor.
+ * This function initializes the serial monitor at SERIAL_BAUD, with a SERIAL_TX_BUFFER transmit ring.
+ * A native USB port is given SERIAL_WAIT ms to be opened; the UART of the ESP32 is ready at once.
  */
 void initializeSerial()
 {
     // INITIALIZING SERIAL MONITOR
-    Serial.begin(115200);
+    Serial.setTxBufferSize(SERIAL_TX_BUFFER);
+    Serial.begin(SERIAL_BAUD);
+#if defined(SERIAL_RTS_PIN) && defined(SERIAL_CTS_PIN)
+    Serial.setPins(-1, -1, SERIAL_CTS_PIN, SERIAL_RTS_PIN);
+    Serial.setHwFlowCtrlMode(UART_HW_FLOWCTRL_CTS_RTS, 64);
+#endif
 
-    while (!Serial)
-    {
-        ; // wait for serial port to connect. Needed for native USB port only
-    }
+    uint32_t start = millis();
+    while (!Serial && millis() - start < SERIAL_WAIT)
+        delay(1);
     // Print contributors
     // Serial.println(creditString);
 }
@@ -204,17 +357,47 @@ boolean initializeSDcard()
     return true;
 }
 
+/**
+ * @brief Prepares the card for logging.
+ *
+ * Previous acquisitions are kept: every session is written to its own file in SESSION_DIR
+ * (see storage.h), so nothing is removed here, and a session interrupted by a power loss
+ * is repaired. The credits file is only written once.
+ */
 void logfileSDcard()
 {
+    if (!SD.exists(SESSION_DIR))
+        SD.mkdir(SESSION_DIR);
+    recoverSessions();
 
-    if (SD.exists("/dataStorage.ds32")) // if the file exists it'll be removed
+    if (!SD.exists("/creditsFile.txt"))
+        writeFile(SD, "/creditsFile.txt", creditString);
+    loadCalibration();
+}
+
+/**
+ * @brief Reads the curves of CALIBRATION_FILE, if the card has one.
+ *
+ * The channels and gains that are not in the file keep their nominal conversion; the lines that
+ * cannot be read are skipped.
+ */
+void loadCalibration()
+{
+    for (uint8_t channel = 0; channel < CALIBRATION_CHANNELS; channel++)
     {
-        SD.remove("/dataStorage.ds32");
+        for (uint8_t gain = 0; gain < CALIBRATION_GAINS; gain++)
+            calibrationCurves[channel][gain].kind = CURVE_NONE;
     }
 
-    // Serial.println("Creating dataStorage.ds32..."); // create and open the file ready to be written
-    writeFile(SD, "/dataStorage.ds32", "");
-    writeFile(SD, "/creditsFile.txt", creditString);
+    File file = SD.open(CALIBRATION_FILE, FILE_READ);
+    if (!file)
+        return;
+    static char text[CALIBRATION_FILE_SIZE + 1];
+    size_t length = file.read((uint8_t *)text, CALIBRATION_FILE_SIZE);
+    file.close();
+    text[length] = '\0';
+    int errorLine;
+    parseCalibration(text, calibrationCurves, &errorLine);
 }
 
 void writeFile(fs::FS &fs, const char *path, const char *message)
@@ -260,121 +443,1131 @@ void appendFile(fs::FS &fs, const char *path, const char *message)
     file.close();
 }
 
+/**
+ * @brief Initializes the RTC.
+ *
+ * @return false if its clock is halted, so that the time stamps are wrong.
+ */
 boolean initializeRTC()
 {
     rtc.init();
-    return true;
+    return !rtc.isHalted();
+}
+
+/**
+ * @brief Answers a request for one of the pages of include/website/.
+ */
+static void serveAsset(HttpServer &server, int client, const HttpRequest &request)
+{
+    server.sendAsset(client, request, *findWebAsset(request.path));
+}
+
+/**
+ * @brief Answers the chart of the page with the last samples reduced to a few points, see live.h.
+ */
+static void serveChart(HttpServer &server, int client, const HttpRequest &request)
+{
+    liveStream.sendChart(client, request);
+}
+
+/**
+ * @brief Describes the acquisition to a browser that connects, and takes its "start" and "stop" messages.
+ *
+ * They act like the START and STOP commands of the serial port.
+ */
+static void handleWebSocket(HttpServer &server, int client, WS_EVENT event, const uint8_t *data, size_t length)
+{
+    if (event == WS_OPEN)
+        liveStream.greet(client);
+    else if (event == WS_MESSAGE && length == 5 && memcmp(data, "start", 5) == 0)
+        commandStart = !acquiring;
+    else if (event == WS_MESSAGE && length == 4 && memcmp(data, "stop", 4) == 0)
+        commandStop = acquiring;
 }
 
+/**
+ * @brief Starts the access point and the web server, which serves the pages and streams the samples.
+ *
+ * @return true if the server is listening.
+ */
 boolean initializeWifi()
 {
 
-    // Serial.println("Initializing Wifi...");
+    // Serial.println("Initializing Wifi...");
+
+    // IP Address details
+    IPAddress local_ip(192, 168, 1, 1);
+    IPAddress gateway(192, 168, 1, 1);
+    IPAddress subnet(255, 255, 255, 0);
+
+#ifdef MQTT_BROKER
+    WiFi.mode(WIFI_AP_STA);
+#endif
+    WiFi.softAP(ssid, password);
+    WiFi.softAPConfig(local_ip, gateway, subnet);
+#ifdef MQTT_BROKER
+    // Joining the network goes on in the background, the publisher retries until it is done
+    WiFi.begin(MQTT_WIFI_SSID, MQTT_WIFI_PASSWORD);
+    char clientId[MQTT_CLIENT_ID_SIZE];
+    snprintf(clientId, sizeof(clientId), "ds32-%06lx", (unsigned long)(ESP.getEfuseMac() & 0xFFFFFF));
+    mqttPublisher.begin(MQTT_BROKER, MQTT_PORT, clientId);
+#endif
+
+    // Serial.print("Connect to My access point: ");
+    // Serial.println(ssid);
+
+    webServer.on("/", serveAsset);
+    for (size_t i = 0; i < webAssetCount; i++)
+        webServer.on(webAssets[i].path, serveAsset);
+    webServer.on("/chart", serveChart);
+    webServer.on("/sessions", serveSessionList);
+    webServer.on("/session", serveSession);
+    webServer.on("/metrics", serveMetrics);
+    webServer.onWebSocket("/ws", handleWebSocket);
+    wifiStarted = webServer.begin(HTTP_PORT);
+    // Serial.println("HTTP server started");
+
+    // Serial.println("Wifi initialized\n");
+    return wifiStarted;
+}
+
+/**
+ * @brief Serves the web clients and the MQTT broker without waiting, see HttpServer::handleClients()
+ * and MqttPublisher::poll().
+ *
+ * The longest call is kept: compared with the sample period, it tells whether serving the
+ * browsers (and reading the card for a download) can make the loop miss a sample.
+ */
+void pollWebClients()
+{
+    if (!wifiStarted)
+        return;
+    uint32_t start = micros();
+    uint32_t now = millis();
+    webServer.handleClients(now);
+    mqttPublisher.poll(now);
+    uint32_t elapsed = micros() - start;
+    if (elapsed > longestWebPoll)
+        longestWebPoll = elapsed;
+}
+
+/**
+ * @brief Looks for the ADS1115 on the I2C bus.
+ *
+ * @return false if it does not answer; the logger then runs without it until an acquisition
+ *         finds it.
+ */
+boolean initializeADC()
+{
+    adcReady = ads.begin();
+    return adcReady;
+}
+
+/**
+ * @brief Mounts the card in a task of its own, see initializeDevices().
+ */
+static void cardTask(void *)
+{
+    bootTimeline.begin(BOOT_CARD, micros());
+    boolean mounted = initializeSDcard();
+    bootTimeline.end(BOOT_CARD, mounted, micros());
+    cardMounting = false;
+    xSemaphoreGive(cardDone);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Starts the access point and the web server in a task of its own, see initializeDevices().
+ */
+static void wifiTask(void *)
+{
+    bootTimeline.begin(BOOT_WIFI, micros());
+    bootTimeline.end(BOOT_WIFI, initializeWifi(), micros());
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Initializes the devices, the independent ones at the same time, and records how long each took.
+ *
+ * The card (SPI) and the Wi-Fi start in tasks of their own while the display and the ADC (which
+ * share the I2C bus) and the RTC are brought up here, I2C transfers failing after I2C_TIMEOUT ms.
+ * A device that fails is left out instead of holding up the boot: the logger runs without the
+ * ADC until an acquisition finds it, and with wrong time stamps if the RTC is halted. The card
+ * is waited for at most CARD_TIMEOUT ms, as the calibration file and the recovery of the last
+ * session must be done before the first acquisition; the Wi-Fi is not waited for.
+ *
+ * @return true if the ADC was found.
+ */
+boolean initializeDevices()
+{
+    bootTimeline.begin(BOOT_SERIAL, micros());
+    initializeSerial();
+    bootTimeline.end(BOOT_SERIAL, true, micros());
+
+    cardDone = xSemaphoreCreateBinary();
+    cardMounting = true;
+    if (xTaskCreatePinnedToCore(cardTask, "card", BOOT_TASK_STACK, NULL, 1, NULL, 0) != pdPASS)
+    {
+        cardMounting = false;
+        bootTimeline.begin(BOOT_CARD, micros());
+        bootTimeline.end(BOOT_CARD, false, micros());
+    }
+    if (xTaskCreatePinnedToCore(wifiTask, "wifi", BOOT_TASK_STACK, NULL, 1, NULL, 0) != pdPASS)
+    {
+        bootTimeline.begin(BOOT_WIFI, micros());
+        bootTimeline.end(BOOT_WIFI, false, micros());
+    }
+
+    bootTimeline.begin(BOOT_PINS, micros());
+    bootTimeline.end(BOOT_PINS, initializeOutputDevices() && initializeInputDevices(), micros());
+
+    Wire.setTimeOut(I2C_TIMEOUT);
+    bootTimeline.begin(BOOT_SCREEN, micros());
+    while (!initializeScreen()) // Only fails if its buffer cannot be allocated, and the menu needs it
+        delay(100);
+    bootTimeline.end(BOOT_SCREEN, true, micros());
+    bootTimeline.begin(BOOT_ADC, micros());
+    bootTimeline.end(BOOT_ADC, initializeADC(), micros());
+    bootTimeline.begin(BOOT_RTC, micros());
+    bootTimeline.end(BOOT_RTC, initializeRTC(), micros());
+
+    if (cardMounting && xSemaphoreTake(cardDone, pdMS_TO_TICKS(CARD_TIMEOUT)) != pdTRUE)
+        bootTimeline.giveUp(BOOT_CARD, micros());
+    return adcReady;
+}
+
+/**
+ * @brief Tells whether the ADC was found on the I2C bus.
+ */
+boolean isAdcReady()
+{
+    return adcReady;
+}
+
+/**
+ * @brief Tells whether the card task has finished and mounted the card.
+ */
+boolean isCardReady()
+{
+    return !cardMounting && bootTimeline.getResult(BOOT_CARD) == BOOT_OK;
+}
+
+/**
+ * @brief Writes the boot timeline (boot.h) as text, followed by the outcome of the configuration file.
+ *
+ * @return The length of the text, which is cut at size - 1 bytes.
+ */
+static size_t formatBoot(char *text, size_t size)
+{
+    size_t length = bootTimeline.format(text, size);
+    if (configMessage[0] == '\0')
+        return length;
+    int written = snprintf(text + length, size - length, "%s: %s\n", CONFIG_FILE, configMessage);
+    if (written > 0)
+        length += written;
+    return length < size ? length : size - 1;
+}
+
+/**
+ * @brief Writes the boot timeline (boot.h) to the serial port, for builds with -D BOOT_PROFILE.
+ */
+void printBootTimeline()
+{
+    char text[BOOT_TIMELINE_TEXT];
+    Serial.write((const uint8_t *)text, formatBoot(text, sizeof(text)));
+}
+
+/**
+ * @brief Reads everything waiting on the serial port without blocking.
+ *
+ * Bytes belonging to command frames go to the command parser and complete commands are
+ * carried out at once; any other byte is kept as a single-character command ('u', 'd',
+ * 's', 'F') for the functions below.
+ */
+void pollSerialInput()
+{
+    while (Serial.available() > 0)
+    {
+        uint8_t byte = Serial.read();
+        switch (commandParser.feed(byte, millis()))
+        {
+        case COMMAND_NONE:
+            if (byte > ' ') // Line endings sent after a character are ignored
+                pendingKey = byte;
+            break;
+        case COMMAND_READY:
+            commandTime = deviceMicros();
+            receivedCommands++;
+            executeCommand();
+            break;
+        case COMMAND_REJECTED:
+            rejectedCommands++;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Uses up the pending single-character command if it is the given one.
+ *
+ * @return true if it was.
+ */
+boolean takeKey(char key)
+{
+    pollSerialInput();
+    if (pendingKey != key)
+        return false;
+    pendingKey = 0;
+    return true;
+}
+
+/**
+ * @brief Function to check if the device should go up.
+ *
+ * This function checks if the UP_BUTTON is pressed or if the character 'u' is received from Serial.
+ *
+ * @return true if the device should go up, false otherwise.
+ */
+boolean goUp()
+{
+    return takeKey('u') || digitalRead(UP_BUTTON);
+}
+
+/**
+ * @brief Function to check if the device should go down.
+ *
+ * This function checks if there is data available on the Serial port. If there is, it reads the data and checks if it is equal to 'd'.
+ * If the DOWN_BUTTON is pressed or the data is equal to 'd', it returns true. Otherwise, it returns false.
+ *
+ * @return true if the device should go down, false otherwise.
+ */
+boolean goDown()
+{
+    return takeKey('d') || digitalRead(DOWN_BUTTON);
+}
+
+/**
+ * @brief Checks if the select button is pressed or if 's' was received on the Serial port.
+ *
+ * A START or STOP command also counts as a selection, so that it leaves the current submenu
+ * or acquisition loop. As every menu and acquisition loop calls it, the web clients are
+ * served from here too, and deviceMicros() sees every wrap of micros().
+ *
+ * @return true if the current menu or acquisition should be left, false otherwise.
+ */
+boolean select()
+{
+    deviceMicros();
+    if (acquiring)
+    {
+        uint32_t now = micros();
+        if (lastSelect != 0)
+            loopMetric.observe(now - lastSelect);
+        lastSelect = now;
+    }
+    pollWebClients();
+    if (takeKey('s') || commandStop)
+    {
+        commandStop = false;
+        return true;
+    }
+    return digitalRead(SELECT_BUTTON) || (commandStart && !acquiring);
+}
+
+/**
+ * @brief Tells whether a START command is waiting to be carried out by the main loop.
+ */
+boolean isStartRequested()
+{
+    pollSerialInput();
+    return commandStart;
+}
+
+/**
+ * @brief Marks the end of an acquisition, sending the samples still waiting in a compressed block.
+ */
+void endAcquisition()
+{
+    if (currentMode == SERIAL_ONLY && serialCompression)
+        serialBlocks.flush();
+    flushSerialBatch();
+    liveStream.end();
+    mqttPublisher.end();
+    acquiring = false;
+}
+
+/**
+ * @brief Queues bytes in the transmit ring if they all fit, without ever waiting.
+ *
+ * @return true if they were queued, false if the ring is too full (the host is not keeping up).
+ */
+boolean serialSend(const uint8_t *data, size_t length)
+{
+    if ((size_t)Serial.availableForWrite() < length)
+        return false;
+    Serial.write(data, length);
+    serialBytesMetric.add(length);
+    serialRingMetric.raise(SERIAL_TX_BUFFER - Serial.availableForWrite());
+    return true;
+}
+
+/**
+ * @brief Sends the 0xCC frames collected so far as one write, or drops them all.
+ */
+void flushSerialBatch()
+{
+    if (serialBatchLength == 0)
+        return;
+    if (!serialSend(serialBatch, serialBatchLength))
+    {
+        droppedBatches++;
+        droppedSamples += serialBatchLength / 3;
+        droppedMetric.add(serialBatchLength / 3);
+    }
+    serialBatchLength = 0;
+}
+
+static uint8_t *put16(uint8_t *out, uint16_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    return out + 2;
+}
+
+static uint8_t *put32(uint8_t *out, uint32_t value)
+{
+    out = put16(out, (uint16_t)value);
+    return put16(out, (uint16_t)(value >> 16));
+}
+
+static uint8_t *put64(uint8_t *out, uint64_t value)
+{
+    out = put32(out, (uint32_t)value);
+    return put32(out, (uint32_t)(value >> 32));
+}
+
+static uint8_t *putFloat(uint8_t *out, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return put32(out, bits);
+}
+
+/**
+ * @brief Returns micros() extended to 64 bits, so device times do not wrap after 71 minutes.
+ *
+ * Must be called at least once per wrap of micros(): select() calls it, and every menu and
+ * acquisition loop calls select().
+ */
+uint64_t deviceMicros()
+{
+    static uint32_t last = 0;
+    static uint32_t wraps = 0;
+    uint32_t now = micros();
+    if (now < last)
+        wraps++;
+    last = now;
+    return (uint64_t)wraps << 32 | now;
+}
+
+/**
+ * @brief Sends the device time of a sample, so the PC can time stamp the stream.
+ *
+ * @param sample The index of the sample since the acquisition started.
+ * @param time The micros() value taken by the interrupt of that sample.
+ */
+void sendTimeMark(uint32_t sample, uint32_t time)
+{
+    uint64_t now = deviceMicros();
+    uint8_t payload[13];
+    payload[0] = COMMAND_OK;
+    uint8_t *end = put32(payload + 1, sample);
+    put64(end, now - (uint32_t)((uint32_t)now - time));
+
+    uint8_t frame[COMMAND_OVERHEAD + sizeof(payload)];
+    size_t size = encodeCommand(COMMAND_REPLY, COMMAND_TIME_MARK | COMMAND_REPLY_FLAG, payload, sizeof(payload), frame);
+    serialSend(frame, size); // A mark lost with its samples is recovered from the next one
+}
+
+/**
+ * @brief Reads CONFIG_FILE a buffer at a time, for parseConfig().
+ */
+class FileConfigSource : public ConfigSource
+{
+private:
+    File &file;
+
+protected:
+    size_t fill(char *data, size_t size) override { return file.read((uint8_t *)data, size); }
+
+public:
+    FileConfigSource(File &file) : file(file) {}
+};
+
+/**
+ * @brief Reads CONFIG_FILE, if the card has one, over the configuration of the logger (config.h).
+ *
+ * A valid file sets the configuration, which is then saved in NVS so that it holds without the
+ * card; a file that is not valid changes nothing. Either way the outcome is kept in
+ * configMessage, and the time taken and the memory used in the metrics.
+ *
+ * @return true if a valid file was read.
+ */
+boolean loadConfig()
+{
+    for (uint8_t channel = 0; channel < CALIBRATION_CHANNELS; channel++)
+    {
+        for (uint8_t gain = 0; gain < CALIBRATION_GAINS; gain++)
+            configCurves[channel][gain].kind = CURVE_NONE;
+    }
+    if (!isCardReady())
+        return false;
+    File file = SD.open(CONFIG_FILE, FILE_READ);
+    if (!file)
+        return false;
+
+    uint32_t start = micros();
+    bootTimeline.begin(BOOT_CONFIG, start);
+    static LoggerConfig config;
+    config.settings.mode = currentMode;
+    config.settings.channel = currentChannel;
+    config.settings.rate = currentSampleRate;
+    config.settings.gain = currentGain;
+    config.settings.compressed = serialCompression;
+    config.settings.autostart = autostart;
+    config.rotateSize = SESSION_ROTATE_SIZE;
+    config.rotateDuration = SESSION_ROTATE_DURATION;
+    config.mqttRaw = mqttPublishRaw;
+    memcpy(config.curves, configCurves, sizeof(configCurves));
+
+    const ConfigLimits limits = {SESSION_ROTATE_SIZE};
+    FileConfigSource source(file);
+    size_t poolUsed = 0;
+    boolean valid = parseConfig(source, limits, &config, &poolUsed, configMessage, sizeof(configMessage));
+    uint32_t length = source.getTotal();
+    file.close();
+    configParseMetric.set(micros() - start);
+    configPoolMetric.set(poolUsed);
+    bootTimeline.end(BOOT_CONFIG, valid, micros());
+    if (!valid)
+        return false;
+
+    currentMode = (MODE)config.settings.mode;
+    currentChannel = (CHANNEL)config.settings.channel;
+    currentSampleRate = config.settings.rate;
+    currentGain = config.settings.gain;
+    serialCompression = config.settings.compressed;
+    autostart = config.settings.autostart;
+    mqttPublishRaw = config.mqttRaw;
+    setSessionRotation(config.rotateSize, config.rotateDuration);
+    memcpy(configCurves, config.curves, sizeof(configCurves));
+    saveSettings();
+    snprintf(configMessage, sizeof(configMessage), "%lu bytes read, %u of %u bytes of the pool",
+             (unsigned long)length, (unsigned)poolUsed, (unsigned)CONFIG_POOL_SIZE);
+    return true;
+}
+
+/**
+ * @brief Reads the settings saved in NVS (settings.h) into the configuration of the logger, then
+ * those of the configuration file on the card (loadConfig()).
+ *
+ * With autostart, the START flag is raised, so the main loop begins logging without the menu,
+ * as for a START command; holding SELECT at boot skips it.
+ *
+ * @return true if valid settings were found in NVS.
+ */
+boolean loadSettings()
+{
+    uint32_t start = micros();
+    bootTimeline.begin(BOOT_SETTINGS, start);
+    uint8_t blob[SETTINGS_SIZE + 8];
+    size_t length = 0;
+    Preferences preferences;
+    if (preferences.begin(SETTINGS_NAMESPACE, true))
+    {
+        length = preferences.getBytes(SETTINGS_KEY, blob, sizeof(blob));
+        preferences.end();
+    }
+    Settings settings;
+    defaultSettings(&settings);
+    boolean valid = decodeSettings(blob, length, &settings) && settings.mode <= SD_ONLY &&
+                    settings.channel <= RESISTANCE && adcRateIndex(settings.rate) >= 0 &&
+                    (settings.gain < ADC_GAIN_COUNT || settings.gain == COMMAND_GAIN_DEFAULT);
+    if (valid)
+    {
+        currentMode = (MODE)settings.mode;
+        currentChannel = (CHANNEL)settings.channel;
+        currentSampleRate = settings.rate;
+        currentGain = settings.gain;
+        serialCompression = settings.compressed;
+        autostart = settings.autostart;
+        savedSettings = settings;
+    }
+    settingsLoadMetric.set(micros() - start);
+    bootTimeline.end(BOOT_SETTINGS, valid || length == 0, micros()); // Nothing saved yet is not a failure
+    loadConfig();
+
+    if (autostart && !digitalRead(SELECT_BUTTON))
+        commandStart = true;
+    return valid;
+}
+
+/**
+ * @brief Saves the configuration of the logger in NVS, if it changed since it was last saved.
+ */
+void saveSettings()
+{
+    Settings settings;
+    settings.mode = currentMode;
+    settings.channel = currentChannel;
+    settings.rate = currentSampleRate;
+    settings.gain = currentGain;
+    settings.compressed = serialCompression;
+    settings.autostart = autostart;
+    if (memcmp(&settings, &savedSettings, sizeof(settings)) == 0)
+        return;
+
+    uint8_t blob[SETTINGS_SIZE];
+    Preferences preferences;
+    if (!preferences.begin(SETTINGS_NAMESPACE, false))
+        return;
+    if (preferences.putBytes(SETTINGS_KEY, blob, encodeSettings(settings, blob)) == SETTINGS_SIZE)
+        savedSettings = settings;
+    preferences.end();
+}
+
+/**
+ * @brief Counts a sample read from the ADC, and times the first one since the boot.
+ */
+static void countSample()
+{
+    acquiredSamples++;
+    samplesMetric.add();
+    if (firstSampleMetric.get() == 0)
+    {
+        uint32_t now = micros();
+        firstSampleMetric.set(now);
+        bootTimeline.begin(BOOT_SAMPLE, now);
+        bootTimeline.end(BOOT_SAMPLE, true, now);
+    }
+}
+
+/**
+ * @brief Returns the NVS key of the curve fitted for the current channel and gain.
+ */
+static const char *fittedCurveKey(char *key)
+{
+    uint8_t gain = currentGain < ADC_GAIN_COUNT ? currentGain : CALIBRATION_DEFAULT_GAIN;
+    snprintf(key, 8, "c%u_%u", (unsigned)currentChannel, (unsigned)gain);
+    return key;
+}
+
+/**
+ * @brief Reads the curve fitted on the logger for the current channel and gain, if there is one.
+ *
+ * @return true if curve was replaced.
+ */
+boolean readFittedCurve(CalibrationCurve *curve)
+{
+    char key[8];
+    CalibrationCurve fitted;
+    Preferences preferences;
+    if (!preferences.begin(CALIBRATION_NAMESPACE, true))
+        return false;
+    size_t length = preferences.getBytes(fittedCurveKey(key), &fitted, sizeof(fitted));
+    preferences.end();
+    if (length != sizeof(fitted) || fitted.kind != CURVE_POLYNOMIAL || fitted.count < 2 || fitted.count > 4)
+        return false;
+    *curve = fitted;
+    return true;
+}
+
+/**
+ * @brief Keeps a curve in NVS for the current channel and gain, or removes it if curve is NULL.
+ */
+boolean writeFittedCurve(const CalibrationCurve *curve)
+{
+    char key[8];
+    Preferences preferences;
+    if (!preferences.begin(CALIBRATION_NAMESPACE, false))
+        return false;
+    boolean written = curve ? preferences.putBytes(fittedCurveKey(key), curve, sizeof(*curve)) == sizeof(*curve)
+                            : preferences.remove(fittedCurveKey(key));
+    preferences.end();
+    return written;
+}
+
+/**
+ * @brief Tells whether CALIBRATE_BEGIN is waiting to be carried out by the main loop.
+ */
+boolean isCalibrationRequested()
+{
+    pollSerialInput();
+    return commandCalibrate;
+}
+
+/**
+ * @brief Starts the guided calibration of the current channel and gain, once adcSetup() ran.
+ */
+void beginCalibration()
+{
+    commandCalibrate = false;
+    calibrating = true;
+    calibrationPoints = 0;
+    calibrationCollecting = false;
+    calibrationGraphic(currentChannelString, 0, false, 0, calibrationWindows);
+}
+
+/**
+ * @brief Reads the samples during the calibration and averages the windows of a reference point.
+ *
+ * The window under way when CALIBRATE_POINT arrives is dropped, as it began before the input
+ * was applied.
+ */
+void calibrationAct()
+{
+    if (!new_data)
+        return;
+    new_data = false;
+
+    measurement.insertMeasurement(ads.getLastConversionResults());
+    if (!measurement.isArrayFull())
+        return;
+    measurement.setArrayFull(false);
+    if (!calibrationCollecting)
+        return;
+    if (calibrationSettling)
+    {
+        calibrationSettling = false;
+        return;
+    }
+
+    calibrationSum += currentChannel == CURRENT ? sqrtf(measurement.getMean()) : measurement.getMean();
+    if (++calibrationCollected == calibrationWindows)
+    {
+        calibrationCounts[calibrationPoints++] = calibrationSum / calibrationWindows;
+        calibrationCollecting = false;
+        soundBuzzer(selectFrequency, selectDuration);
+    }
+    calibrationGraphic(currentChannelString, calibrationPoints, calibrationCollecting, calibrationCollected, calibrationWindows);
+}
+
+/**
+ * @brief Tells whether the calibration routine is still running.
+ */
+boolean isCalibrating()
+{
+    return calibrating;
+}
+
+/**
+ * @brief Leaves the calibration routine, also when SELECT was pressed before the fit.
+ */
+void endCalibration()
+{
+    calibrating = calibrationCollecting = false;
+}
+
+/**
+ * @brief Tells whether SPECTRUM is waiting to be carried out by the main loop.
+ */
+boolean isSpectrumRequested()
+{
+    pollSerialInput();
+    return commandSpectrum;
+}
+
+/**
+ * @brief Starts the spectrum mode on the current channel, once adcSetup() ran.
+ *
+ * The samples go through the live stream, so the browsers see them, and into its ring.
+ */
+void beginSpectrum()
+{
+    commandSpectrum = false;
+    analyzing = spectrum.begin(spectrumSize, spectrumWindow);
+    spectrumSequence = 0;
+    spectrumDue = spectrumSize;
+    spectrumFrame = millis();
+    missedSamples = 0;
+    liveStream.begin(currentChannel, currentSampleRate, K_value, O_value, currentFactor());
+    spectrumGraphic(currentChannelString, NULL, 0, NULL);
+}
+
+/**
+ * @brief Reads the samples of the spectrum mode and, every half block, transforms the last
+ * block, sends its record on the serial port and, at most every SPECTRUM_FRAME_INTERVAL, draws it.
+ *
+ * The blocks overlap by half, where the windows weight them down. A record that does not fit
+ * in the transmit ring is dropped and counted like a batch of samples. The conversions lost
+ * while the screen is drawn are counted in missedSamples.
+ */
+void spectrumAct()
+{
+    if (!new_data)
+        return;
+    new_data = false;
+
+    liveStream.insert(ads.getLastConversionResults());
+    const SampleHistory &history = liveStream.getHistory();
+    if (history.getNext() != spectrumDue)
+        return;
+    spectrumDue += spectrumSize / 2;
+
+    uint32_t first = history.getNext() - spectrumSize;
+    uint32_t start = ESP.getCycleCount();
+    spectrum.transform(history, first, currentSampleRate);
+    uint32_t cycles = ESP.getCycleCount() - start;
+    spectrumCyclesMetric.set(cycles);
+
+    static uint8_t record[SPECTRUM_MAX_RECORD];
+    size_t length = spectrum.encode(currentSampleRate, spectrumSequence++, first, cycles, record);
+    if (!serialSend(record, length))
+        droppedBatches++;
+
+    if (millis() - spectrumFrame >= SPECTRUM_FRAME_INTERVAL || spectrumSequence == 1)
+    {
+        spectrumFrame = millis();
+        uint32_t frameStart = micros();
+        spectrumGraphic(currentChannelString, spectrum.getAmplitudes(), spectrum.getBins(), spectrum.getPeaks());
+        frameMetric.observe(micros() - frameStart);
+    }
+}
+
+/**
+ * @brief Tells whether the spectrum mode is still running.
+ */
+boolean isAnalyzing()
+{
+    return analyzing;
+}
+
+/**
+ * @brief Leaves the spectrum mode, also when SELECT was pressed.
+ */
+void endSpectrum()
+{
+    analyzing = false;
+    liveStream.end();
+}
+
+/**
+ * @brief Carries out a step of COMMAND_CALIBRATE, see command.h.
+ *
+ * @return The end of the reply.
+ */
+static uint8_t *calibrationStep(const uint8_t *payload, uint8_t length, uint8_t *reply, uint8_t *end)
+{
+    uint8_t step = length > 0 ? payload[0] : 0xFF;
+    if (acquiring && step != CALIBRATE_CLEAR && step != CALIBRATE_STATUS)
+    {
+        reply[0] = COMMAND_BUSY;
+        return end;
+    }
+
+    switch (step)
+    {
+    case CALIBRATE_BEGIN:
+        if (length != 3 || payload[1] == 0 || payload[2] < 1 || payload[2] > 3 || calibrating)
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            calibrationWindows = payload[1];
+            calibrationDegree = payload[2];
+            commandCalibrate = true;
+        }
+        break;
+
+    case CALIBRATE_POINT:
+    {
+        float reference;
+        if (length == 5)
+            memcpy(&reference, payload + 1, sizeof(reference));
+        if (length != 5 || !calibrating || calibrationCollecting || calibrationPoints == CALIBRATION_MAX_POINTS ||
+            !isfinite(reference))
+        {
+            reply[0] = COMMAND_INVALID;
+            break;
+        }
+        calibrationReferences[calibrationPoints] = reference;
+        calibrationSum = 0;
+        calibrationCollected = 0;
+        calibrationCollecting = calibrationSettling = true;
+        calibrationGraphic(currentChannelString, calibrationPoints, true, 0, calibrationWindows);
+        break;
+    }
+
+    case CALIBRATE_STATUS:
+        *end++ = calibrating;
+        *end++ = calibrationPoints;
+        *end++ = calibrationCollecting;
+        *end++ = calibrationCollected;
+        end = putFloat(end, calibrationPoints > 0 ? calibrationCounts[calibrationPoints - 1] : 0);
+        break;
+
+    case CALIBRATE_FIT:
+    {
+        CalibrationCurve curve;
+        float residual;
+        if (!calibrating || calibrationCollecting ||
+            !fitCurve(calibrationCounts, calibrationReferences, calibrationPoints, calibrationDegree, &curve, &residual) ||
+            !writeFittedCurve(&curve))
+        {
+            reply[0] = COMMAND_INVALID;
+            break;
+        }
+        *end++ = curve.count;
+        for (uint8_t i = 0; i < curve.count; i++)
+            end = putFloat(end, curve.values[i]);
+        end = putFloat(end, residual);
+        calibrating = false;
+        break;
+    }
+
+    case CALIBRATE_CANCEL:
+        calibrating = commandCalibrate = false;
+        break;
+
+    case CALIBRATE_CLEAR:
+        if (!writeFittedCurve(NULL))
+            reply[0] = COMMAND_INVALID;
+        break;
+
+    default:
+        reply[0] = COMMAND_INVALID;
+        break;
+    }
+    return end;
+}
+
+/**
+ * @brief Carries out the command frame just received and answers it.
+ *
+ * Nothing here waits: START and STOP only raise a flag that the main loop and select() act on.
+ */
+void executeCommand()
+{
+    uint8_t command = commandParser.getCommand();
+    uint8_t length = commandParser.getLength();
+    const uint8_t *payload = commandParser.getPayload();
+    uint8_t reply[COMMAND_MAX_PAYLOAD];
+    uint8_t *end = reply + 1;
+    uint32_t baud = 0; // New line speed, applied once the reply has been sent
+    reply[0] = COMMAND_OK;
+
+    switch (command)
+    {
+    case COMMAND_PING:
+        *end++ = COMMAND_VERSION;
+        break;
 
-    // IP Address details
-    IPAddress local_ip(192, 168, 1, 1);
-    IPAddress gateway(192, 168, 1, 1);
-    IPAddress subnet(255, 255, 255, 0);
+    case COMMAND_GET_STATUS:
+        *end++ = currentMode;
+        *end++ = currentChannel;
+        end = put16(end, currentSampleRate);
+        *end++ = currentGain;
+        *end++ = acquiring;
+        end = put16(end, isSessionOpen() ? getSessionNumber() : 0);
+        end = put32(end, acquiredSamples);
+        end = put32(end, millis());
+        break;
 
-    WebServer server(80);
+    case COMMAND_SET_CONFIG:
+        if (acquiring)
+            reply[0] = COMMAND_BUSY;
+        else if (length != 5 || payload[0] > SD_ONLY || payload[1] > RESISTANCE ||
+                 adcRateIndex(payload[2] | payload[3] << 8) < 0 ||
+                 (payload[4] >= ADC_GAIN_COUNT && payload[4] != COMMAND_GAIN_DEFAULT))
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            currentMode = (MODE)payload[0];
+            currentChannel = (CHANNEL)payload[1];
+            currentSampleRate = payload[2] | payload[3] << 8;
+            currentGain = payload[4];
+            saveSettings();
+        }
+        break;
 
-    WiFi.softAP(ssid, password);
-    WiFi.softAPConfig(local_ip, gateway, subnet);
+    case COMMAND_START:
+        if (acquiring)
+            reply[0] = COMMAND_BUSY;
+        else if (length > 1)
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            if (length == 1)
+                serialCompression = payload[0] != 0;
+            commandStart = true;
+            saveSettings();
+        }
+        break;
 
-    // Serial.print("Connect to My access point: ");
-    // Serial.println(ssid);
+    case COMMAND_STOP:
+        commandStop = acquiring;
+        end = put32(end, acquiredSamples);
+        break;
 
-    // server.on("/", server.send(200, "text/html", HTML));
+    case COMMAND_GET_COUNTERS:
+        end = put32(end, acquiredSamples);
+        end = put32(end, sentRecords);
+        end = put32(end, receivedCommands);
+        end = put32(end, rejectedCommands);
+        end = put32(end, droppedBatches);
+        end = put32(end, droppedSamples);
+        break;
 
-    server.begin();
-    // Serial.println("HTTP server started");
+    case COMMAND_SET_BAUD:
+        baud = length == 4 ? payload[0] | payload[1] << 8 | (uint32_t)payload[2] << 16 | (uint32_t)payload[3] << 24 : 0;
+        if (acquiring || baud < 9600 || baud > SERIAL_MAX_BAUD)
+        {
+            reply[0] = acquiring ? COMMAND_BUSY : COMMAND_INVALID;
+            baud = 0; // The line keeps its speed
+        }
+        break;
 
-    // Serial.println("Wifi initialized\n");
-    return true;
-}
+    case COMMAND_BENCHMARK:
+        if (acquiring)
+            reply[0] = COMMAND_BUSY;
+        else if (length != 4)
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            uint32_t bytes = payload[0] | payload[1] << 8 | (uint32_t)payload[2] << 16 | (uint32_t)payload[3] << 24;
+            end = put32(end, bytes);
+            end = put32(end, serialBenchmark(bytes));
+        }
+        break;
 
-boolean initializeADC() // TODO finish function
-{
-    // Serial.println("Initializing ADC...");
+    case COMMAND_TIME_SYNC:
+        // Answered like an NTP server: the host time is echoed next to the reception and reply times
+        if (length != 8)
+        {
+            reply[0] = COMMAND_INVALID;
+            break;
+        }
+        memcpy(end, payload, 8);
+        end = put64(end + 8, commandTime);
+        end = put64(end, deviceMicros());
+        break;
 
-    if (!ads.begin())
+    case COMMAND_GET_TRANSFERS:
     {
-        // Serial.println("Failed to initialize ADS.");
-        while (10)
-            ;
+        uint32_t started, completed, bytes, milliseconds;
+        getDownloadCounters(&started, &completed, &bytes, &milliseconds);
+        end = put32(end, missedSamples);
+        end = put32(end, longestWebPoll);
+        end = put32(end, started);
+        end = put32(end, completed);
+        end = put32(end, bytes);
+        end = put32(end, milliseconds);
+        break;
     }
 
-    // Serial.println("ADC initialized");
+    case COMMAND_GET_METRICS:
+    case COMMAND_GET_BOOT:
+    {
+        // The text is paged: offset 0 takes a snapshot, which the next requests read on
+        static char text[COMMAND_METRICS_TEXT];
+        static uint16_t textLength = 0;
+        uint16_t offset = length == 2 ? payload[0] | payload[1] << 8 : 0xFFFF;
+        if (offset == 0)
+            textLength = command == COMMAND_GET_METRICS ? writeMetrics(text, sizeof(text))
+                                                        : formatBoot(text, sizeof(text));
+        if (length != 2 || offset > textLength)
+        {
+            reply[0] = COMMAND_INVALID;
+            break;
+        }
+        uint16_t part = textLength - offset;
+        if (part > COMMAND_MAX_PAYLOAD - 3)
+            part = COMMAND_MAX_PAYLOAD - 3;
+        end = put16(end, textLength);
+        memcpy(end, text + offset, part);
+        end += part;
+        break;
+    }
 
-    return true;
-}
+    case COMMAND_GET_CALIBRATION:
+        if (!acquiring)
+            selectCalibration();
+        end = putFloat(end, K_value);
+        end = putFloat(end, O_value);
+        end = putFloat(end, currentFactor());
+        *end++ = calibrationKind;
+        end = putFloat(end, calibrationError);
+        break;
 
-/**
- * @brief Initializes the devices required for the correct operation of the logger.
- *
- * @return true if all essential devices are successfully initialized, false otherwise.
- */
-boolean initializeDevices()
-{
-    // Serial.println("Initializing devices...");
+    case COMMAND_CALIBRATE:
+        end = calibrationStep(payload, length, reply, end);
+        break;
 
-    initializeSerial();
+    case COMMAND_SPECTRUM:
+    {
+        uint16_t size = length == 3 ? payload[0] | payload[1] << 8 : 0;
+        if (acquiring || calibrating)
+            reply[0] = COMMAND_BUSY;
+        else if (length == 3 && size == 0)
+            analyzing = commandSpectrum = false;
+        else if (length != 3 || !SpectrumAnalyzer::isValidSize(size) || payload[2] >= SPECTRUM_WINDOWS || analyzing)
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            spectrumSize = size;
+            spectrumWindow = payload[2];
+            commandSpectrum = true;
+        }
+        break;
+    }
 
-    // Serial.println("Initialized devices!\n");
-    //  Initialize only essential devices to correct work of logger
-    return initializeOutputDevices() &&
-           initializeInputDevices() &&
-           initializeScreen() && initializeADC() && initializeRTC();
-}
+    case COMMAND_SET_AUTOSTART:
+        if (length != 1 || payload[0] > 1)
+            reply[0] = COMMAND_INVALID;
+        else
+        {
+            autostart = payload[0];
+            saveSettings();
+        }
+        break;
 
-/**
- * @brief Function to check if the device should go up.
- *
- * This function checks if the UP_BUTTON is pressed or if the character 'u' is received from Serial.
- *
- * @return true if the device should go up, false otherwise.
- */
-boolean goUp()
-{
-    if (Serial.available() > 0)
-    {
-        char ch = Serial.read();
-        return (digitalRead(UP_BUTTON) || ch == 'u');
+    default:
+        reply[0] = COMMAND_UNKNOWN;
+        break;
     }
-    return digitalRead(UP_BUTTON);
-}
 
-/**
- * @brief Function to check if the device should go down.
- *
- * This function checks if there is data available on the Serial port. If there is, it reads the data and checks if it is equal to 'd'.
- * If the DOWN_BUTTON is pressed or the data is equal to 'd', it returns true. Otherwise, it returns false.
- *
- * @return true if the device should go down, false otherwise.
- */
-boolean goDown()
-{
-    if (Serial.available() > 0)
+    uint8_t frame[COMMAND_MAX_FRAME];
+    size_t size = encodeCommand(COMMAND_REPLY, command | COMMAND_REPLY_FLAG, reply, end - reply, frame);
+    Serial.write(frame, size);
+    serialBytesMetric.add(size);
+
+    if (baud)
     {
-        char ch = Serial.read();
-        return (digitalRead(DOWN_BUTTON) || ch == 'd');
+        Serial.flush();
+        Serial.updateBaudRate(baud);
     }
-    return digitalRead(DOWN_BUTTON);
 }
 
 /**
- * @brief Checks if the select button is pressed or if there is data available on the Serial port.
+ * @brief Sends a test pattern as fast as the link allows, for the BENCHMARK command.
+ *
+ * The bytes are '0' + (i % 64), which never start a command reply.
  *
- * @return true if the select button is pressed or if there is data available on the Serial port, false otherwise.
+ * @return The time taken until the last byte left the UART, in microseconds.
  */
-boolean select()
+uint32_t serialBenchmark(uint32_t bytes)
 {
-    if (Serial.available() > 0)
-    {
-        char ch = Serial.read();
-        return (digitalRead(SELECT_BUTTON) || ch == 's');
-    }
-    return digitalRead(SELECT_BUTTON);
+    uint8_t chunk[SERIAL_BENCHMARK_CHUNK];
+    for (size_t i = 0; i < sizeof(chunk); i++)
+        chunk[i] = '0' + (i % 64);
+
+    uint32_t start = micros();
+    for (uint32_t sent = 0; sent < bytes; sent += sizeof(chunk))
+        Serial.write(chunk, bytes - sent < sizeof(chunk) ? bytes - sent : sizeof(chunk));
+    Serial.flush();
+    serialBytesMetric.add(bytes);
+    return micros() - start;
 }
 
 /**
@@ -399,46 +1592,59 @@ void soundBuzzer(int frequency, int duration)
 }
 
 /**
- * @brief Get the current timestamp as a string.
+ * @brief Get the current timestamp as HH:MM:SS.
  *
- * @return String The current timestamp as a string.
+ * @param buffer The destination, at least TIMESTAMP_SIZE bytes long.
+ * @return The buffer, so the call can be used as an argument.
  */
-String getTimeStamp()
+char *getTimeStamp(char *buffer)
 {
-
     Ds1302::DateTime now;
     rtc.getDateTime(&now);
 
-    String currentTime = "";
-    if (now.hour < 10)
-        currentTime = currentTime + "0";
-    currentTime = currentTime + now.hour + ":"; // 00-23
-    if (now.minute < 10)
-        currentTime = currentTime + "0";
-    currentTime = currentTime + now.minute + ":"; // 00-59
-    if (now.second < 10)
-        currentTime = currentTime + "0";
-    currentTime = currentTime + now.second; // 00-59
-
-    return currentTime;
+    formatTime(buffer, now.hour, now.minute, now.second);
+    return buffer;
 }
 
-String getDateStamp()
+/**
+ * @brief Get the current date as MM/DD/YYYY.
+ *
+ * @param buffer The destination, at least DATESTAMP_SIZE bytes long.
+ * @return The buffer, so the call can be used as an argument.
+ */
+char *getDateStamp(char *buffer)
 {
     Ds1302::DateTime now;
     rtc.getDateTime(&now);
 
-    String currentDate = "";
+    formatDate(buffer, now.month, now.day, now.year);
+    return buffer;
+}
+
+/**
+ * @brief Get the current RTC time as seconds since 1970.
+ */
+uint32_t getUnixTime()
+{
+    Ds1302::DateTime now;
+    rtc.getDateTime(&now);
 
-    if (now.month < 10)
-        currentDate = currentDate + "0";
-    currentDate = currentDate + now.month + "/"; // 01-12
-    if (now.day < 10)
-        currentDate = currentDate + "0";
-    currentDate = currentDate + now.day;        // 01-3
-    currentDate = currentDate + "/" + now.year; // 2021
+    // Days since 1970 of the civil date, counted from March so the leap day comes last;
+    // 719468 days separate 1 March of year 0 from 1 January 1970
+    uint32_t year = 2000 + now.year - (now.month <= 2);
+    uint32_t month = now.month <= 2 ? now.month + 9 : now.month - 3;
+    uint32_t days = 365 * year + year / 4 - year / 100 + year / 400 + (153 * month + 2) / 5 + now.day - 1 - 719468;
+    return days * 86400UL + now.hour * 3600UL + now.minute * 60UL + now.second;
+}
 
-    return currentDate;
+/**
+ * @brief Ends the measurement window, sending its statistics to the browsers and the broker.
+ */
+void endWindow(float value)
+{
+    const LiveStats *statistics = liveStream.endWindow(value);
+    if (statistics)
+        mqttPublisher.addWindow(*statistics);
 }
 
 /**
@@ -577,52 +1783,31 @@ void inputModeAct()
     delay(10);
 }
 
+/**
+ * @brief Returns the gain chosen over the command channel, or the default gain of the channel,
+ * as an index in ADC_GAINS.
+ */
+uint8_t channelGain()
+{
+    return currentGain < ADC_GAIN_COUNT ? currentGain : ADC_CHANNELS[currentChannel].gain;
+}
+
 /**
  * Sets the channel for ADC readings.
  *
- * The function starts ADC reading based on the current channel value.
- * If the current channel is VOLTAGE, it starts ADC reading for single-ended channel 0.
- * If the current channel is CURRENT, it starts ADC reading for differential channel 2-3.
- * If the current channel is RESISTANCE, it starts ADC reading for single-ended channel 1.
- * If the current channel is none of the above, it prints an error message.
+ * The function sets the gain of the current channel and starts continuous conversions of its
+ * input, as described by ADC_CHANNELS: single-ended AIN0 for VOLTAGE, differential AIN2 - AIN3
+ * for CURRENT and single-ended AIN1 for RESISTANCE.
  *
  * @return void
  */
 void setChannel()
 {
-    if (currentChannel == VOLTAGE)
-    {
-        ads.setGain(GAIN_TWOTHIRDS); // 2/3x gain +/- 6.144V  1 bit = 3mV      0.1875mV (default)
-        ads.startADCReading(ADS1X15_REG_CONFIG_MUX_SINGLE_0, true);
-        measurement.setMode(1);
-        // Serial.println("Reading channel A0\n");
-        currentChannelString = "Voltage";
-    }
-
-    else if (currentChannel == CURRENT)
-    {
-        ads.setGain(GAIN_FOUR);
-        ads.startADCReading(ADS1X15_REG_CONFIG_MUX_DIFF_2_3, true);
-        measurement.setMode(2);
-        // Serial.println("Reading channel A2-A3\n");
-        currentChannelString = "Current";
-    }
-
-    else if (currentChannel == RESISTANCE)
-    {
-        ads.setGain(GAIN_ONE);
-        ads.startADCReading(ADS1X15_REG_CONFIG_MUX_SINGLE_1, true);
-        measurement.setMode(1);
-        // Serial.println("Reading channel A1\n");
-        currentChannelString = "Resistance";
-    }
-
-    else
-    {
-        // Serial.println("\n\n\n\n-----------------------------");
-        // Serial.println("Error selecting channel");
-        // Serial.println("\n\n\n\n-----------------------------");
-    }
+    const AdcChannel &channel = ADC_CHANNELS[currentChannel];
+    ads.setGain((adsGain_t)ADC_GAINS[channelGain()].code);
+    ads.startADCReading(channel.mux, true);
+    measurement.setMode(channel.mode);
+    currentChannelString = channel.name;
 }
 
 /**
@@ -636,90 +1821,47 @@ void setChannel()
  */
 void infoAct(boolean subSetup)
 {
-    infoGraphic(getTimeStamp(), getDateStamp());
+    char dateStamp[DATESTAMP_SIZE];
+    infoGraphic(getTimeStamp(currentTime), getDateStamp(dateStamp));
 }
 
 /**
  * @brief Sets the rate value.
  *
- * This function sets the rate value to the specified value.
+ * This function sets the data rate of the ADC to the specified value, if it is one of ADC_RATES.
  *
  * @param value The rate value to be set.
  */
 
 void setRate(int value)
 {
-    switch (value)
-    {
-    case 860:
-        ads.setDataRate(RATE_ADS1115_860SPS);
-        break;
-    case 475:
-        ads.setDataRate(RATE_ADS1115_475SPS);
-        break;
-    case 250:
-        ads.setDataRate(RATE_ADS1115_250SPS);
-        break;
-    case 128:
-        ads.setDataRate(RATE_ADS1115_128SPS);
-        break;
-    case 64:
-        ads.setDataRate(RATE_ADS1115_64SPS);
-        break;
-    case 32:
-        ads.setDataRate(RATE_ADS1115_32SPS);
-        break;
-    case 16:
-        ads.setDataRate(RATE_ADS1115_16SPS);
-        break;
-    case 8:
-        ads.setDataRate(RATE_ADS1115_8SPS);
-        break;
-    default:
-        // Serial.println("ErrorSetDataRate");
-        break;
-    }
+    int index = adcRateIndex(value);
+    if (index >= 0)
+        ads.setDataRate(ADC_RATES[index].code);
 }
 
 /**
  * Function to perform the sample set action.
- * This function updates the sample rate based on user input and displays the selected sample rate.
+ * This function steps the sample rate through ADC_RATES based on user input and displays the selected sample rate.
  */
 void sampleSetAct()
 {
     sampleSetGraphic(currentSampleRate);
 
+    int index = adcRateIndex(currentSampleRate);
     if (goDown())
     {
-        int i = 0;
         soundBuzzer(scrollFrequency, scrollDuration);
-        for (int j = 0; j < 8; j++)
-        {
-            if (dataRateValues[j] == currentSampleRate)
-                i = j;
-        }
-        if (i > 0)
-        {
-            i--;
-            currentSampleRate = dataRateValues[i];
-        }
+        if (index > 0)
+            currentSampleRate = ADC_RATES[index - 1].samples;
         sampleSetSelectorGraphic(0);
         // Serial.println("Selected sample rate: " + String(currentSampleRate) + "\n");
     }
     if (goUp())
     {
-        int i = 0;
         soundBuzzer(scrollFrequency, scrollDuration);
-        for (int j = 0; j < 8; j++)
-        {
-            if (dataRateValues[j] == currentSampleRate)
-                i = j;
-        }
-        if (i < 7)
-        {
-            i++;
-            currentSampleRate = dataRateValues[i];
-        }
+        if (index < ADC_RATE_COUNT - 1)
+            currentSampleRate = ADC_RATES[index + 1].samples;
         sampleSetSelectorGraphic(1);
         // Serial.println("Selected sample rate: " + String(currentSampleRate) + "\n");
     }
@@ -732,43 +1874,70 @@ void sampleSetAct()
  * @return true if the preliminary control checks pass, false otherwise.
  */
 
-float currentFactor()
+/**
+ * @brief Sends the description of the acquisition that precedes the samples on the serial port.
+ */
+void sendSerialHeader()
 {
-    float factor;
-    switch (currentChannel)
-    {
-    case VOLTAGE:
-        factor = FACTOR_V;
-        break;
-
-    case CURRENT:
-        factor = FACTOR_I;
-        break;
+    Serial.println("START");
+    Serial.println(currentChannelString);
+    Serial.println(K_value, 35);
+    Serial.println(O_value, 35);
+    Serial.println(currentSampleRate);
+    Serial.println(currentFactor());
+    serialBlocks.reset(millis(), 0);
+}
 
-    case RESISTANCE:
-        factor = FACTOR_R;
-        break;
-    }
-    return factor;
+float currentFactor()
+{
+    return ADC_CHANNELS[currentChannel].factor;
 }
 
 boolean preliminaryControl()
 {
     boolean controlResult = false;
-    String message = "Current measure: " + currentChannelString + "\n" + "Gain: " + String(K_value, 30) + "\n" + "Offset: " + String(O_value) + "\n" + "Array length (Sample rate): " + String(measurement.getLength()) + "\n";
+    boolean remote = commandStart; // Started by a command: the PC is already listening
+    commandStart = false;
+    if (!adcReady)
+    {
+        soundBuzzer(1000, 2000); // No ADC on the bus: nothing to log
+        return false;
+    }
+    char message[192 + CALIBRATION_CURVE_TEXT_SIZE];
+    char *end = formatString(message, "Current measure: ");
+    end = formatString(end, currentChannelString);
+    end = formatString(end, "\nGain: ");
+    end = formatFixed(end, K_value, 9);
+    end = formatString(end, "\nOffset: ");
+    end = formatFixed(end, O_value, 2);
+    end = formatString(end, "\nArray length (Sample rate): ");
+    end = formatInt(end, measurement.getLength());
+    end = formatString(end, "\n");
 
     switch (currentMode)
     {
     case SD_ONLY:
-        controlResult = initializeSDcard();
-        message = message + "Factor: " + String(currentFactor()) + "\n";
-        file = SD.open("/dataStorage.ds32", FILE_APPEND);
-        file.print(message);
-        file.print(getTimeStamp() + " ");
+        end = formatString(end, "Factor: ");
+        end = formatFixed(end, currentFactor(), 2);
+        end = formatString(end, "\n");
+        if (calibrationKind != CURVE_NONE)
+        {
+            // Gain and offset only describe a straight line; ds32conv converts with the curve
+            end = formatCurve(formatString(end, "Curve: "), calibrationCurve);
+            end = formatString(end, "\n");
+        }
+        controlResult = !cardMounting && initializeSDcard() && openSession(message, end - message);
+        sdBlocks.reset(millis(), getSessionNumber());
         break;
 
     case SERIAL_ONLY:
-        char serial;
+        if (remote)
+        {
+            controlResult = true;
+            sendSerialHeader();
+            break;
+        }
+
         // Serial.println("Write 'F' and send to start the serial acquisition: ");
         waitSerialGraphic();
         serialWaitingTime = time_now = millis();
@@ -778,29 +1947,19 @@ boolean preliminaryControl()
             if (Serial.available() > 0)
             {
                 delay(1500);
-                byte serial = Serial.read();
-                // Serial.println(serial, HEX);
 
-                if (serial == 'F')
+                if (takeKey('F'))
                 {
-
                     controlResult = true;
-                    Serial.println("START");
-                    Serial.println(currentChannelString);
-                    Serial.println(K_value, 35);
-                    Serial.println(O_value, 35);
-                    Serial.println(currentSampleRate);
-                    Serial.println(currentFactor());
+                    sendSerialHeader();
                     delay(350);
                     break;
                 }
             }
             time_now = millis();
         }
-
-        if (serial != 'F')
-            // Serial.println("Expired time: no valid response received");
-            break;
+        // Serial.println("Expired time: no valid response received");
+        break;
 
     case DISPLAY_ONLY:
         controlResult = true;
@@ -820,7 +1979,14 @@ boolean preliminaryControl()
     }
     else
     {
-        loggerGraphic(getTimeStamp(), 0);
+        acquiring = true;
+        acquiredSamples = 0;
+        missedSamples = 0;
+        longestWebPoll = 0;
+        lastSelect = 0;
+        liveStream.begin(currentChannel, currentSampleRate, K_value, O_value, currentFactor());
+        mqttPublisher.start(currentChannel, currentSampleRate, K_value * currentFactor(), getUnixTime(), mqttPublishRaw);
+        loggerGraphic(getTimeStamp(currentTime), 0);
     }
 
     return controlResult;
@@ -829,75 +1995,95 @@ boolean preliminaryControl()
 /**
  * @brief Calculates the coefficient.
  *
- * This function calculates the coefficient based on certain criteria.
+ * This function returns the volts of a count at the gain of the acquisition.
  *
  * @return The calculated coefficient.
  */
 float calculateCoefficient()
 {
-    float gain;
-    switch (currentChannel)
-    {
-    case VOLTAGE:
-        gain = multiplier_V;
-        break;
-    case CURRENT:
-        gain = multiplier_I;
-        break;
-    case RESISTANCE:
-        gain = multiplier_R;
-        break;
-    default:
-        gain = 1;
-        break;
-    }
-    return gain;
+    return adcLsb(channelGain());
 }
 
 /**
  * Calculates the offset.
  *
- * @return The calculated offset as a float value. It is used to calculate the voltage, current, and resistance values.
+ * @return The offset of the current channel, in its units. It is used to calculate the voltage, current, and resistance values.
  */
 float calculateOffset()
 {
-    float offset;
-    switch (currentChannel)
+    return ADC_CHANNELS[currentChannel].offset;
+}
+
+/**
+ * @brief Compiles the table of the current channel and gain, and sets K_value and O_value.
+ *
+ * The curve is the one fitted on the logger, else that of the configuration file, else that of
+ * the calibration file, else the nominal conversion (ADC_CONVERSIONS). A straight line for
+ * voltage or current also gives the gain and offset of the headers and of the live chart; the
+ * other curves leave them nominal, so the samples on the chart are then approximate, while the
+ * values of the windows use the curve.
+ */
+void selectCalibration()
+{
+    K_value = calculateCoefficient();
+    O_value = calculateOffset();
+
+    uint8_t gain = currentGain < ADC_GAIN_COUNT ? currentGain : CALIBRATION_DEFAULT_GAIN;
+    CalibrationCurve curve = calibrationCurves[currentChannel][gain];
+    if (configCurves[currentChannel][gain].kind != CURVE_NONE)
+        curve = configCurves[currentChannel][gain];
+    readFittedCurve(&curve);
+    calibrationKind = curve.kind;
+    const AdcConversionEntry &nominal = ADC_CONVERSIONS[currentChannel][channelGain()];
+    nominalConversion = nominal.convert;
+    if (curve.kind == CURVE_NONE)
+        curve = nominal.curve();
+    else if (curve.kind == CURVE_POLYNOMIAL && curve.count <= 2 && currentChannel != RESISTANCE)
     {
-    case VOLTAGE:
-        offset = 0;
-        break;
-    case CURRENT:
-        offset = 0;
-        break;
-    case RESISTANCE:
-        offset = 0;
-        break;
-    default:
-        offset = 0;
-        break;
+        K_value = (curve.count == 2 ? curve.values[1] : 0) / currentFactor();
+        O_value = -curve.values[0];
     }
-    return offset;
+    calibrationLinear = curve.kind == CURVE_POLYNOMIAL && curve.count <= 2;
+    calibrationCurve = curve;
+    calibration.compile(curve);
+    calibrationError = calibration.getError(curve);
+}
+
+/**
+ * @brief Converts a sample with the table and adds it to the window, for a straight line.
+ */
+void calibrateSample(int16_t value)
+{
+    if (!calibrationLinear)
+        return;
+    calibratedSum += calibration.convert(value);
+    calibratedCount++;
 }
 
+/**
+ * @brief Returns the value of the window and starts the next one.
+ *
+ * For a straight line, it is the mean of the converted samples. For the current, and for any
+ * other curve, it is the mean of the counts of the window (their RMS for the current)
+ * converted, by the curve if there is one and else exactly by the nominal conversion: the mean
+ * of 1/x over noisy samples near 0 counts would swing between huge and negative values. A
+ * resistance whose mean is 0 counts or less is an open circuit, returned as infinity.
+ */
 float conversionMeasurement()
 {
-    float measure;
-    switch (currentChannel)
+    float measure = 0;
+    if (currentChannel == CURRENT || !calibrationLinear)
     {
-    case VOLTAGE:
-        measure = (measurement.getMean() * K_value * FACTOR_V) - O_value;
-        break;
-    case CURRENT:
-        measure = (sqrt(measurement.getMean()) * K_value * FACTOR_I) - O_value;
-        break;
-    case RESISTANCE:
-        measure = FACTOR_R * 3.3 / (measurement.getMean() * K_value) - FACTOR_R;
-        break;
-    default:
-        measure = 0;
-        break;
+        float counts = currentChannel == CURRENT ? sqrtf(measurement.getMean()) : measurement.getMean();
+        if (currentChannel == RESISTANCE && !(counts > 0))
+            measure = INFINITY;
+        else
+            measure = calibrationKind == CURVE_NONE ? nominalConversion(counts) : calibration.convert(counts);
     }
+    else if (calibratedCount > 0)
+        measure = (float)calibratedSum / calibratedCount * calibration.getUnit();
+    calibratedSum = 0;
+    calibratedCount = 0;
     return measure;
 }
 
@@ -916,6 +2102,8 @@ void adcSetup()
     // Serial.println("\n\n\n\n-----------------------------");
     // Serial.println("ENTERED IN ADC SETUP\n\n\n\n");
     //  We get a falling edge every time a new sample is ready.
+    if (!adcReady)
+        initializeADC();
     attachInterrupt(digitalPinToInterrupt(ALERT_PIN), NewDataReadyISR, FALLING);
     // Serial.println("Interrupt attached (falling edge for new data ready)))");
     setRate(currentSampleRate);
@@ -923,38 +2111,68 @@ void adcSetup()
 
     measurement.setLength(currentSampleRate);
 
-    K_value = calculateCoefficient();
-    O_value = calculateOffset();
+    selectCalibration();
+    calibratedSum = 0;
+    calibratedCount = 0;
 
     Measurement measurement(currentSampleRate);
 }
 
-void loggerActSD()
-
+/**
+ * @brief Writes a record of compressed samples to the session file and its block index.
+ */
+void writeBlockSD(const uint8_t *record, size_t length, const BlockSummary *summary)
 {
+    uint32_t start = micros();
+    sessionWriteRecord(record, length, summary);
+    sdWriteMetric.observe(micros() - start);
+    sentRecords++;
+}
 
-    if (!new_data)
+/**
+ * @brief Sends a record of compressed samples over the serial port.
+ */
+void writeBlockSerial(const uint8_t *record, size_t length, const BlockSummary *summary)
+{
+    // A dropped record leaves a gap in the sequence numbers, which the host counts
+    if (!serialSend(record, length))
     {
+        droppedBatches++;
+        droppedSamples += summary->count;
+        droppedMetric.add(summary->count);
         return;
     }
+    sentRecords++;
+}
 
-    if (!measurement.isArrayFull())
+void loggerActSD()
+{
+    if (!new_data)
     {
-        measurement.insertMeasurement(ads.getLastConversionResults());
-        file.print(measurement.getLastMeasurement());
-        file.print(" ");
+        return;
     }
-    else
+    new_data = false;
+
+    int16_t value = ads.getLastConversionResults();
+    measurement.insertMeasurement(value);
+    calibrateSample(value);
+    countSample();
+    sdBlocks.insert(value, millis());
+    liveStream.insert(value);
+    mqttPublisher.insert(value);
+
+    if (measurement.isArrayFull())
     {
-        currentTime = getTimeStamp();
-        digitalWrite(LED2, !digitalRead(LED2));
-        file.print("\n" + currentTime + " ");
-        file.close();
+        // Once per second the pending samples are compressed and committed to the card
         measurement.setArrayFull(false);
-        // appendFile(SD, "/dataStorage.ds32", "\n" + currentTime + "\n");
-        file = SD.open("/dataStorage.ds32", FILE_APPEND);
+        endWindow(conversionMeasurement());
+        uint32_t start = micros();
+        sdBlocks.flush();
+        if (sessionSync())
+            sdBlocks.setSession(getSessionNumber());
+        sdSyncMetric.observe(micros() - start);
+        digitalWrite(LED2, !digitalRead(LED2));
     }
-    new_data = false;
 }
 
 void loggerActSerial()
@@ -964,24 +2182,38 @@ void loggerActSerial()
         // //Serial.println("No new data ready!");
         return;
     }
+    new_data = false;
 
-    // //Serial.println("New data ready!");
+    uint32_t time = sampleMicros;
+    int16_t value = ads.getLastConversionResults();
+    measurement.insertMeasurement(value);
+    calibrateSample(value);
+    countSample();
+    liveStream.insert(value);
+    mqttPublisher.insert(value);
 
-    if (!measurement.isArrayFull())
+    if (serialCompression)
     {
-        // //Serial.println(ads.getLastConversionResults());
-        measurement.insertMeasurement(ads.getLastConversionResults());
-        // //Serial.println(measurement.getLastMeasurement());
-        Serial.write(0xCC);                                           // Start byte
-        Serial.write((measurement.getLastMeasurement() >> 8) & 0xFF); // High byte
-        Serial.write(measurement.getLastMeasurement() & 0xFF);        // Low byte
+        serialBlocks.insert(value, millis());
     }
     else
+    {
+        serialBatch[serialBatchLength++] = 0xCC;                // Start byte
+        serialBatch[serialBatchLength++] = (value >> 8) & 0xFF; // High byte
+        serialBatch[serialBatchLength++] = value & 0xFF;        // Low byte
+        if (serialBatchLength == sizeof(serialBatch))
+            flushSerialBatch();
+    }
+
+    if (measurement.isArrayFull())
     {
         measurement.setArrayFull(false);
-        // digitalWrite(LED2, !digitalRead(LED2));
+        if (serialCompression)
+            serialBlocks.flush();
+        flushSerialBatch();
+        sendTimeMark(acquiredSamples - 1, time);
+        endWindow(conversionMeasurement());
     }
-    new_data = false;
 }
 
 void loggerActDisplay()
@@ -996,12 +2228,21 @@ void loggerActDisplay()
 
     if (!measurement.isArrayFull())
     {
-        measurement.insertMeasurement(ads.getLastConversionResults());
+        int16_t value = ads.getLastConversionResults();
+        measurement.insertMeasurement(value);
+        calibrateSample(value);
+        countSample();
+        liveStream.insert(value);
+        mqttPublisher.insert(value);
     }
     else
     {
         measurement.setArrayFull(false);
-        loggerGraphic(getTimeStamp(), conversionMeasurement());
+        float measure = conversionMeasurement();
+        endWindow(measure);
+        uint32_t start = micros();
+        loggerGraphic(getTimeStamp(currentTime), measure);
+        frameMetric.observe(micros() - start);
         digitalWrite(LED2, !digitalRead(LED2));
     }
 
@@ -0,0 +1,435 @@
+#include "../include/downloads.h"
+#include "../include/format.h"
+#include "../include/storage.h"
+
+// What is sent to each client, the body being the bytes [header, ...) of the data followed by
+// those from start: an extract is its text header and a span of records, a whole file has no header
+struct SessionTransfer
+{
+    File file;
+    boolean data;      // Read through the sector footers, for an extract of a raw session
+    boolean patch;     // Whether the mode in the first line must read SESSION_MODE_FILE
+    uint32_t header;   // Bytes of the body taken from the start of the data
+    uint32_t start;    // Where the rest of the body starts
+    uint32_t position; // Next byte of the body to send; for /sessions, the lines listed
+    uint32_t end;      // End of the body, or of the range asked for; for /sessions, 1 once the list is closed
+    uint32_t lines;    // Lines of the index still to list, for /sessions
+    boolean listing;   // Whether the opening bracket of the list has been sent
+};
+static SessionTransfer transfers[HTTP_MAX_CLIENTS];
+
+// THROUGHPUT OF THE DOWNLOADS
+static uint32_t startedDownloads = 0;
+static uint32_t completedDownloads = 0;
+static uint32_t downloadedBytes = 0;
+static uint32_t downloadTime = 0;  // Milliseconds during which at least one file was being sent
+static uint32_t downloadSince = 0; // When the current stretch started
+static uint8_t activeDownloads = 0;
+
+// Longest JSON object of a line of the index
+#define LIST_ENTRY_SIZE 192
+
+/**
+ * @brief Checks that a name is the name of a session file, which keeps the path inside SESSION_DIR.
+ */
+static boolean isSessionName(const char *name)
+{
+    size_t length = strlen(name);
+    size_t extension = sizeof(SESSION_EXTENSION) - 1;
+    if (length <= extension || strcmp(name + length - extension, SESSION_EXTENSION) != 0)
+        return false;
+    for (size_t i = 0; i < length - extension; i++)
+    {
+        if (!isdigit(name[i]) && name[i] != '_')
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the line of a session in SESSION_INDEX, found from the number its name starts with.
+ *
+ * @param record Receives the SESSION_RECORD_SIZE bytes of the line.
+ * @return true if the line exists and names the same file.
+ */
+static boolean findSessionRecord(const char *name, char *record)
+{
+    uint32_t number = strtoul(name, NULL, 10);
+    File index = SD.open(SESSION_INDEX, FILE_READ);
+    if (!index)
+        return false;
+    boolean found = number > 0 && index.seek((number - 1) * SESSION_RECORD_SIZE) &&
+                    index.read((uint8_t *)record, SESSION_RECORD_SIZE) == SESSION_RECORD_SIZE;
+    index.close();
+
+    // 0001 R C 0001_241019_123000.ds32 ...
+    size_t length = strlen(name);
+    return found && strncmp(record + 9, name, length) == 0 && record[9 + length] == ' ';
+}
+
+/**
+ * @brief Reads an entry of a block index.
+ */
+static boolean readEntry(File &index, uint32_t number, BlockIndexEntry *entry)
+{
+    return index.seek(number * sizeof(*entry)) && index.read((uint8_t *)entry, sizeof(*entry)) == sizeof(*entry);
+}
+
+/**
+ * @brief Finds the first entry of a block index whose records start after a time, by bisection.
+ *
+ * @return Its number, or the number of entries if there is none.
+ */
+static uint32_t findEntryAfter(File &index, uint32_t count, uint32_t time)
+{
+    uint32_t low = 0, high = count;
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        BlockIndexEntry entry;
+        if (readEntry(index, middle, &entry) && entry.time <= time)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief Sets up the extract of a session between two times, from its block index.
+ *
+ * @return The length of the body.
+ */
+static uint32_t prepareExtract(SessionTransfer &transfer, const char *path, boolean raw, uint32_t from, uint32_t to)
+{
+    uint32_t size = getSessionDataSize(transfer.file, raw);
+    transfer.data = raw;
+    transfer.patch = raw;
+    transfer.header = size;
+    transfer.start = size;
+    uint32_t end = size;
+
+    char indexPath[sizeof(SESSION_DIR) + DOWNLOAD_NAME_SIZE];
+    strcpy(indexPath, path);
+    strcpy(indexPath + strlen(indexPath) - (sizeof(SESSION_EXTENSION) - 1), BLOCK_INDEX_EXTENSION);
+    File index = SD.open(indexPath, FILE_READ);
+    if (!index)
+        return size; // The text header alone
+    uint32_t count = index.size() / sizeof(BlockIndexEntry);
+
+    BlockIndexEntry entry;
+    if (count > 0 && readEntry(index, 0, &entry))
+    {
+        transfer.header = getSessionDataPosition(entry.offset, raw);
+        uint32_t first = findEntryAfter(index, count, from);
+        uint32_t last = findEntryAfter(index, count, to);
+        if (readEntry(index, first > 0 ? first - 1 : 0, &entry))
+            transfer.start = getSessionDataPosition(entry.offset, raw);
+        if (last < count && readEntry(index, last, &entry))
+            end = getSessionDataPosition(entry.offset, raw);
+    }
+    index.close();
+    if (transfer.start > end)
+        transfer.start = end;
+    if (transfer.header > transfer.start)
+        transfer.header = transfer.start;
+    return transfer.header + end - transfer.start;
+}
+
+/**
+ * @brief Reads the Range header of a request for a body of `length` bytes.
+ *
+ * Only a single range is taken; several ranges, or a range for another version of the file
+ * (If-Range), get the whole body, as RFC 9110 allows.
+ *
+ * @param first Receives the first byte asked for.
+ * @param end Receives the byte after the last one.
+ * @return 1 for a range, 0 for the whole body, -1 for a range that cannot be satisfied.
+ */
+static int parseRange(const HttpRequest &request, const char *etag, uint32_t length, uint32_t *first, uint32_t *end)
+{
+    size_t size;
+    const char *condition = findHeader(request, "If-Range", &size);
+    if (condition && (size != strlen(etag) || strncmp(condition, etag, size) != 0))
+        return 0;
+    const char *range = findHeader(request, "Range", &size);
+    if (!range || size < 7 || strncmp(range, "bytes=", 6) != 0 || memchr(range, ',', size))
+        return 0;
+
+    // bytes=A-B, bytes=A- or bytes=-N
+    char *next;
+    const char *text = range + 6;
+    if (*text == '-')
+    {
+        uint32_t suffix = strtoul(text + 1, &next, 10);
+        if (next == text + 1 || suffix == 0)
+            return -1;
+        *first = suffix < length ? length - suffix : 0;
+        *end = length;
+        return 1;
+    }
+    *first = strtoul(text, &next, 10);
+    if (next == text || *next != '-')
+        return 0;
+    text = next + 1;
+    *end = length;
+    if (isdigit(*text))
+    {
+        uint32_t last = strtoul(text, &next, 10);
+        if (last < *first)
+            return 0;
+        if (last < length)
+            *end = last + 1;
+    }
+    return *first < length ? 1 : -1;
+}
+
+/**
+ * @brief Counts a download from when its body starts until it is over.
+ */
+static void beginDownload()
+{
+    if (activeDownloads++ == 0)
+        downloadSince = millis();
+    startedDownloads++;
+}
+
+static void endDownload(boolean completed)
+{
+    if (--activeDownloads == 0)
+        downloadTime += millis() - downloadSince;
+    if (completed)
+        completedDownloads++;
+}
+
+/**
+ * @brief Reads the next chunk of a session file or extract, see HttpBodySource.
+ *
+ * Chunks end on multiples of their size in the body, so that the card is read in whole sectors.
+ */
+static size_t readSession(int client, uint8_t *buffer, size_t size)
+{
+    SessionTransfer &transfer = transfers[client];
+    if (!buffer)
+    {
+        transfer.file.close();
+        endDownload(transfer.position == transfer.end);
+        return 0;
+    }
+
+    size_t length = size - transfer.position % size;
+    if (length > transfer.end - transfer.position)
+        length = transfer.end - transfer.position;
+    size_t done = 0;
+    if (transfer.position < transfer.header)
+    {
+        done = transfer.header - transfer.position < length ? transfer.header - transfer.position : length;
+        done = readSessionData(transfer.file, transfer.data, transfer.position, buffer, done);
+    }
+    if (done < length && transfer.position + done >= transfer.header)
+    {
+        uint32_t position = transfer.start + transfer.position + done - transfer.header;
+        done += readSessionData(transfer.file, transfer.data, position, buffer + done, length - done);
+    }
+
+    // DS32 2 R becomes DS32 2 F: the extract has no sector footers
+    if (transfer.patch && transfer.position <= 7 && transfer.position + done > 7)
+        buffer[7 - transfer.position] = SESSION_MODE_FILE;
+    transfer.position += done;
+    downloadedBytes += done;
+    return done;
+}
+
+/**
+ * @brief Answers GET /session with a session file, a time range of it, or a byte range of either.
+ */
+void serveSession(HttpServer &server, int client, const HttpRequest &request)
+{
+    char name[DOWNLOAD_NAME_SIZE];
+    char record[SESSION_RECORD_SIZE];
+    if (!findParameter(request, "name", name, sizeof(name)) || !isSessionName(name))
+    {
+        server.sendText(client, 400, "text/plain", "Expected name=NNNN_YYMMDD_HHMMSS.ds32\n");
+        return;
+    }
+    if (!findSessionRecord(name, record))
+    {
+        server.sendText(client, 404, "text/plain", "No such session\n");
+        return;
+    }
+    if (record[7] == SESSION_STATE_WRITING)
+    {
+        server.sendText(client, 409, "text/plain", "The session is being written\n");
+        return;
+    }
+
+    char value[12];
+    boolean extract = false;
+    uint32_t from = 0, to = UINT32_MAX;
+    if (findParameter(request, "from", value, sizeof(value)))
+    {
+        from = strtoul(value, NULL, 10);
+        extract = true;
+    }
+    if (findParameter(request, "to", value, sizeof(value)))
+    {
+        to = strtoul(value, NULL, 10);
+        extract = true;
+    }
+    if (to < from)
+    {
+        server.sendText(client, 400, "text/plain", "from is after to\n");
+        return;
+    }
+
+    char path[sizeof(SESSION_DIR) + DOWNLOAD_NAME_SIZE];
+    formatString(formatString(path, SESSION_DIR "/"), name);
+    SessionTransfer &transfer = transfers[client];
+    transfer.file = SD.open(path, FILE_READ);
+    if (!transfer.file)
+    {
+        server.sendText(client, 404, "text/plain", "No such session\n");
+        return;
+    }
+    uint32_t length;
+    if (extract)
+        length = prepareExtract(transfer, path, record[5] == SESSION_MODE_RAW, from, to);
+    else
+    {
+        transfer.data = false;
+        transfer.patch = false;
+        transfer.header = 0;
+        transfer.start = 0;
+        length = transfer.file.size();
+    }
+
+    // The file of a closed session never changes, its number and size identify it
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%lu-%lu\"", strtoul(name, NULL, 10), (unsigned long)transfer.file.size());
+    char headers[256];
+    int used = snprintf(headers, sizeof(headers), "Accept-Ranges: bytes\r\nETag: %s\r\n", etag);
+    if (extract)
+        used += snprintf(headers + used, sizeof(headers) - used,
+                         "Content-Disposition: attachment; filename=\"%.*s_%lu-%lu%s\"\r\n",
+                         (int)(strlen(name) - (sizeof(SESSION_EXTENSION) - 1)), name, (unsigned long)from,
+                         (unsigned long)to, SESSION_EXTENSION);
+    else
+        used += snprintf(headers + used, sizeof(headers) - used,
+                         "Content-Disposition: attachment; filename=\"%s\"\r\n", name);
+
+    uint32_t first = 0, end = length;
+    int range = parseRange(request, etag, length, &first, &end);
+    if (range < 0)
+    {
+        transfer.file.close();
+        snprintf(headers + used, sizeof(headers) - used, "Content-Range: bytes */%lu\r\n", (unsigned long)length);
+        server.respond(client, 416, "text/plain", 0, headers);
+        return;
+    }
+    if (range > 0)
+        snprintf(headers + used, sizeof(headers) - used, "Content-Range: bytes %lu-%lu/%lu\r\n",
+                 (unsigned long)first, (unsigned long)end - 1, (unsigned long)length);
+
+    if (!server.respond(client, range > 0 ? 206 : 200, "application/octet-stream", end - first, headers) ||
+        end == first)
+    {
+        transfer.file.close();
+        return;
+    }
+    transfer.position = first;
+    transfer.end = end;
+    beginDownload();
+    server.attach(client, readSession, end - first);
+}
+
+/**
+ * @brief Writes the lines of the index that fit as JSON objects, see HttpBodySource.
+ */
+static size_t readSessionList(int client, uint8_t *buffer, size_t size)
+{
+    SessionTransfer &transfer = transfers[client];
+    if (!buffer)
+    {
+        transfer.file.close();
+        return 0;
+    }
+
+    char *text = (char *)buffer;
+    size_t used = 0;
+    if (!transfer.listing)
+    {
+        text[used++] = '[';
+        transfer.listing = true;
+    }
+    while (transfer.lines > 0 && size - used >= LIST_ENTRY_SIZE)
+    {
+        // 0001 R C 0001_241019_123000.ds32 10/19/2024 12:30:00 10/19/2024 13:30:00 12345678
+        char record[SESSION_RECORD_SIZE + 1];
+        if (transfer.file.read((uint8_t *)record, SESSION_RECORD_SIZE) != SESSION_RECORD_SIZE)
+        {
+            transfer.lines = 0;
+            break;
+        }
+        transfer.lines--;
+        record[SESSION_RECORD_SIZE] = '\0';
+        char *name = record + 9;
+        char *nameEnd = strchr(name, ' ');
+        if (!nameEnd || strlen(nameEnd) < 2 * (DATESTAMP_SIZE + TIMESTAMP_SIZE) + 1)
+            continue;
+        char *start = nameEnd + 1;
+        char *stop = start + DATESTAMP_SIZE + TIMESTAMP_SIZE;
+        *nameEnd = '\0';
+        start[DATESTAMP_SIZE + TIMESTAMP_SIZE - 1] = '\0';
+        stop[DATESTAMP_SIZE + TIMESTAMP_SIZE - 1] = '\0';
+        used += snprintf(text + used, size - used,
+                         "%s{\"number\":%lu,\"name\":\"%s\",\"mode\":\"%c\",\"state\":\"%c\","
+                         "\"start\":\"%s\",\"end\":\"%s\",\"size\":%lu}",
+                         transfer.position == 0 ? "" : ",\n", strtoul(record, NULL, 10),
+                         name, record[5], record[7], start, stop, strtoul(stop + DATESTAMP_SIZE + TIMESTAMP_SIZE, NULL, 10));
+        transfer.position++;
+    }
+    if (transfer.lines == 0 && size - used >= 2 && transfer.end == 0)
+    {
+        text[used++] = ']';
+        text[used++] = '\n';
+        transfer.end = 1;
+    }
+    return used;
+}
+
+/**
+ * @brief Answers GET /sessions with the lines of SESSION_INDEX, streamed in chunks whatever their number.
+ */
+void serveSessionList(HttpServer &server, int client, const HttpRequest &request)
+{
+    SessionTransfer &transfer = transfers[client];
+    transfer.file = SD.open(SESSION_INDEX, FILE_READ);
+    if (!transfer.file)
+    {
+        server.sendText(client, 200, "application/json", "[]\n");
+        return;
+    }
+    transfer.lines = transfer.file.size() / SESSION_RECORD_SIZE;
+    transfer.listing = false;
+    transfer.position = 0;
+    transfer.end = 0;
+    if (!server.respond(client, 200, "application/json", HTTP_CHUNKED, "Cache-Control: no-store\r\n"))
+    {
+        transfer.file.close();
+        return;
+    }
+    server.attach(client, readSessionList, HTTP_CHUNKED);
+}
+
+/**
+ * @brief Returns the counters of the session downloads, to measure their throughput.
+ *
+ * @param milliseconds Receives the time during which at least one download was running.
+ */
+void getDownloadCounters(uint32_t *started, uint32_t *completed, uint32_t *bytes, uint32_t *milliseconds)
+{
+    *started = startedDownloads;
+    *completed = completedDownloads;
+    *bytes = downloadedBytes;
+    *milliseconds = downloadTime + (activeDownloads > 0 ? millis() - downloadSince : 0);
+}
@@ -0,0 +1,225 @@
+#include <math.h>
+#include "../include/format.h"
+
+// Two ASCII digits for every value 0-99, so integers are converted two digits per division
+static const char digitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const float powersOfTen[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f};
+
+#define MAX_DECIMALS 9
+#define FLOAT_DECIMALS 3
+
+static char *formatUInt64(char *buffer, uint64_t value)
+{
+    char digits[20];
+    char *p = digits + sizeof(digits);
+
+    // Narrow to 32 bits as soon as possible, 64-bit divisions are done in software on the ESP32
+    while (value > 0xFFFFFFFFu)
+    {
+        uint32_t rest = (uint32_t)(value % 100);
+        value /= 100;
+        p -= 2;
+        p[0] = digitPairs[rest * 2];
+        p[1] = digitPairs[rest * 2 + 1];
+    }
+
+    uint32_t small = (uint32_t)value;
+    while (small >= 100)
+    {
+        uint32_t rest = small % 100;
+        small /= 100;
+        p -= 2;
+        p[0] = digitPairs[rest * 2];
+        p[1] = digitPairs[rest * 2 + 1];
+    }
+    if (small >= 10)
+    {
+        p -= 2;
+        p[0] = digitPairs[small * 2];
+        p[1] = digitPairs[small * 2 + 1];
+    }
+    else
+    {
+        *--p = (char)('0' + small);
+    }
+
+    while (p < digits + sizeof(digits))
+        *buffer++ = *p++;
+    *buffer = '\0';
+    return buffer;
+}
+
+/**
+ * @brief Copies a string.
+ *
+ * @return A pointer to the terminator of the copy.
+ */
+char *formatString(char *buffer, const char *text)
+{
+    while (*text)
+        *buffer++ = *text++;
+    *buffer = '\0';
+    return buffer;
+}
+
+/**
+ * @brief Writes an unsigned integer in decimal.
+ */
+char *formatUInt(char *buffer, uint32_t value)
+{
+    return formatUInt64(buffer, value);
+}
+
+/**
+ * @brief Writes a signed integer in decimal.
+ */
+char *formatInt(char *buffer, int32_t value)
+{
+    if (value < 0)
+    {
+        *buffer++ = '-';
+        return formatUInt64(buffer, (uint32_t)0 - (uint32_t)value);
+    }
+    return formatUInt64(buffer, (uint32_t)value);
+}
+
+/**
+ * @brief Writes a value in fixed-point notation.
+ *
+ * The value is scaled by 10^decimals and rounded half away from zero in single precision,
+ * so the same input gives the same characters on the ESP32 and on a host. A value that
+ * rounds to zero is written without a sign. Infinite and NaN values are written as "inf" and "nan".
+ *
+ * @param value The value to write, its magnitude must be below 1.8e19 / 10^decimals.
+ * @param decimals The number of decimal digits, at most 9.
+ */
+char *formatFixed(char *buffer, float value, uint8_t decimals)
+{
+    if (isnan(value))
+        return formatString(buffer, "nan");
+    if (isinf(value))
+        return formatString(buffer, value < 0 ? "-inf" : "inf");
+    if (decimals > MAX_DECIMALS)
+        decimals = MAX_DECIMALS;
+
+    // Single precision is enough for the display (up to FLOAT_DECIMALS digits) and avoids
+    // the software double routines; longer fractions would show the float rounding error
+    bool negative = value < 0;
+    uint64_t scaled;
+    if (decimals <= FLOAT_DECIMALS)
+        scaled = (uint64_t)llroundf(fabsf(value) * powersOfTen[decimals]);
+    else
+        scaled = (uint64_t)llround(fabs((double)value) * (double)powersOfTen[decimals]);
+
+    if (negative && scaled != 0)
+        *buffer++ = '-';
+
+    // Integer part, then the fraction padded with leading zeros
+    uint64_t divisor = (uint64_t)powersOfTen[decimals];
+    buffer = formatUInt64(buffer, scaled / divisor);
+    if (decimals == 0)
+        return buffer;
+
+    *buffer++ = '.';
+    char fraction[FORMAT_NUMBER_SIZE];
+    char *end = formatUInt64(fraction, (uint32_t)(scaled % divisor));
+    for (int padding = decimals - (int)(end - fraction); padding > 0; padding--)
+        *buffer++ = '0';
+    return formatString(buffer, fraction);
+}
+
+/**
+ * @brief Tells whether formatFixed() would write a magnitude as 1000 or more.
+ */
+static bool roundsToThousand(float magnitude, uint8_t decimals)
+{
+    if (decimals > MAX_DECIMALS)
+        decimals = MAX_DECIMALS;
+    // The same rounding as formatFixed()
+    if (decimals <= FLOAT_DECIMALS)
+        return (uint64_t)llroundf(magnitude * powersOfTen[decimals]) >= (uint64_t)(1e3f * powersOfTen[decimals]);
+    return (uint64_t)llround((double)magnitude * (double)powersOfTen[decimals]) >=
+           (uint64_t)(1e3 * (double)powersOfTen[decimals]);
+}
+
+/**
+ * @brief Writes a value scaled to an engineering prefix.
+ *
+ * Values of 1000 and above are divided by 10^3 (prefix 'k'), values of 10^6 and above by 10^6 (prefix 'M').
+ * A value that rounds up to 1000 at the given decimals takes the next prefix, so 999.999 with
+ * 2 decimals is written as 1.00 k, not 1000.00.
+ *
+ * @param prefix Receives 'k', 'M' or '\0' when the value is written unscaled.
+ */
+char *formatEngineering(char *buffer, float value, uint8_t decimals, char *prefix)
+{
+    float magnitude = fabsf(value);
+
+    if (magnitude >= 1e6f || (magnitude >= 1e3f && roundsToThousand(magnitude / 1e3f, decimals)))
+    {
+        *prefix = 'M';
+        value /= 1e6f;
+    }
+    else if (magnitude >= 1e3f || roundsToThousand(magnitude, decimals))
+    {
+        *prefix = 'k';
+        value /= 1e3f;
+    }
+    else
+    {
+        *prefix = '\0';
+    }
+    return formatFixed(buffer, value, decimals);
+}
+
+/**
+ * @brief Writes a time as HH:MM:SS.
+ */
+char *formatTime(char *buffer, uint8_t hour, uint8_t minute, uint8_t second)
+{
+    buffer[0] = digitPairs[hour % 100 * 2];
+    buffer[1] = digitPairs[hour % 100 * 2 + 1];
+    buffer[2] = ':';
+    buffer[3] = digitPairs[minute % 100 * 2];
+    buffer[4] = digitPairs[minute % 100 * 2 + 1];
+    buffer[5] = ':';
+    buffer[6] = digitPairs[second % 100 * 2];
+    buffer[7] = digitPairs[second % 100 * 2 + 1];
+    buffer[8] = '\0';
+    return buffer + 8;
+}
+
+/**
+ * @brief Writes a date as MM/DD/YYYY.
+ *
+ * @param year The year, either full (2024) or as stored by the RTC (24).
+ */
+char *formatDate(char *buffer, uint8_t month, uint8_t day, uint16_t year)
+{
+    if (year < 100)
+        year += 2000;
+
+    buffer[0] = digitPairs[month % 100 * 2];
+    buffer[1] = digitPairs[month % 100 * 2 + 1];
+    buffer[2] = '/';
+    buffer[3] = digitPairs[day % 100 * 2];
+    buffer[4] = digitPairs[day % 100 * 2 + 1];
+    buffer[5] = '/';
+    buffer[6] = digitPairs[year / 100 % 100 * 2];
+    buffer[7] = digitPairs[year / 100 % 100 * 2 + 1];
+    buffer[8] = digitPairs[year % 100 * 2];
+    buffer[9] = digitPairs[year % 100 * 2 + 1];
+    buffer[10] = '\0';
+    return buffer + 10;
+}
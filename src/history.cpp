@@ -0,0 +1,149 @@
+#include <math.h>
+#include "../include/history.h"
+
+SampleHistory::SampleHistory()
+{
+    next = 0;
+}
+
+/**
+ * @brief Forgets the samples, when a new acquisition starts.
+ */
+void SampleHistory::reset()
+{
+    next = 0;
+}
+
+/**
+ * @brief Returns the index of the next sample, that is the number of samples inserted.
+ */
+uint32_t SampleHistory::getNext() const
+{
+    return next;
+}
+
+/**
+ * @brief Returns the number of samples still in the ring, the last ones inserted.
+ */
+uint32_t SampleHistory::getRetained() const
+{
+    return next < HISTORY_SAMPLES ? next : HISTORY_SAMPLES;
+}
+
+/**
+ * @brief Returns a retained sample.
+ *
+ * @param index The index of the sample since the acquisition started.
+ */
+int16_t SampleHistory::at(uint32_t index) const
+{
+    return samples[index & (HISTORY_SAMPLES - 1)];
+}
+
+/**
+ * @brief Reduces a window of retained samples to `points` of them with Largest-Triangle-Three-Buckets.
+ *
+ * The first and last samples are always kept. This is the algorithm of Steinarsson's thesis,
+ * in one pass over the buckets, with the same bucket bounds; every sample is read twice: once
+ * for the average of its bucket, while the bucket before it is searched, and once as a
+ * candidate. It differs from the reference only in computing the areas in single precision,
+ * relative to the kept point, so of two candidates whose areas are equal to within float
+ * rounding it may keep the other one. `webhost -c` checks it against the reference.
+ *
+ * @param first The index of the first sample of the window, which must be retained.
+ * @param count The number of samples in the window.
+ * @param points At least 3, at most HISTORY_MAX_POINTS; all samples are kept if there are fewer.
+ * @param offsets Set to the position of each point in the window.
+ * @param values Set to the value of each point.
+ * @return The number of points written.
+ */
+uint16_t SampleHistory::downsampleLttb(uint32_t first, uint32_t count, uint16_t points, uint16_t *offsets, int16_t *values) const
+{
+    if (count <= points)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            offsets[i] = (uint16_t)i;
+            values[i] = at(first + i);
+        }
+        return (uint16_t)count;
+    }
+
+    // Buckets of the samples between the first and the last, bucket b being
+    // [b * inner / buckets + 1, (b + 1) * inner / buckets + 1), in integers so that no float
+    // rounding moves a bound (the products stay below 2^26)
+    uint32_t inner = count - 2;
+    uint32_t buckets = points - 2;
+    uint32_t kept = 0; // Offset of the point kept in the previous bucket
+    int16_t keptValue = at(first);
+    offsets[0] = 0;
+    values[0] = keptValue;
+
+    for (uint32_t bucket = 0; bucket < buckets; bucket++)
+    {
+        uint32_t start = bucket * inner / buckets + 1;
+        uint32_t end = (bucket + 1) * inner / buckets + 1;
+        uint32_t nextEnd = (bucket + 2) * inner / buckets + 1;
+        if (nextEnd > count)
+            nextEnd = count;
+
+        int32_t sum = 0;
+        for (uint32_t i = end; i < nextEnd; i++)
+            sum += at(first + i);
+        float averageX = (end + nextEnd - 1) * 0.5f - kept;
+        float averageY = (float)sum / (nextEnd - end) - keptValue;
+
+        // Twice the area of the triangle (kept, candidate, average), relative to the kept point
+        float largest = -1;
+        uint32_t chosen = start;
+        for (uint32_t i = start; i < end; i++)
+        {
+            float area = fabsf(averageX * (at(first + i) - keptValue) - (float)(i - kept) * averageY);
+            if (area > largest)
+            {
+                largest = area;
+                chosen = i;
+            }
+        }
+        kept = chosen;
+        keptValue = at(first + chosen);
+        offsets[bucket + 1] = (uint16_t)kept;
+        values[bucket + 1] = keptValue;
+    }
+
+    offsets[points - 1] = (uint16_t)(count - 1);
+    values[points - 1] = at(first + count - 1);
+    return points;
+}
+
+/**
+ * @brief Reduces a window of retained samples to the minimum and maximum of `buckets` equal buckets.
+ *
+ * Bucket b holds the samples from count * b / buckets to count * (b + 1) / buckets. The
+ * samples are read once.
+ *
+ * @return The number of buckets written, fewer if the window has fewer samples.
+ */
+uint16_t SampleHistory::downsampleMinMax(uint32_t first, uint32_t count, uint16_t buckets, int16_t *minima, int16_t *maxima) const
+{
+    if (count < buckets)
+        buckets = (uint16_t)count;
+    uint32_t i = 0;
+    for (uint16_t bucket = 0; bucket < buckets; bucket++)
+    {
+        uint32_t end = (uint32_t)((uint64_t)count * (bucket + 1) / buckets);
+        int16_t minimum = at(first + i);
+        int16_t maximum = minimum;
+        for (i++; i < end; i++)
+        {
+            int16_t sample = at(first + i);
+            if (sample < minimum)
+                minimum = sample;
+            if (sample > maximum)
+                maximum = sample;
+        }
+        minima[bucket] = minimum;
+        maxima[bucket] = maximum;
+    }
+    return buckets;
+}
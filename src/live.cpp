@@ -0,0 +1,161 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/live.h"
+
+LiveStream::LiveStream(HttpServer &server) : server(server)
+{
+    memset(&config, 0, sizeof(config));
+    config.type = LIVE_CONFIG;
+    memset(&batch, 0, sizeof(batch));
+    batch.type = LIVE_SAMPLES;
+    memset(&window, 0, sizeof(window));
+    window.type = LIVE_STATS;
+    ended = window;
+    next = 0;
+    sum = 0;
+    squares = 0;
+}
+
+/**
+ * @brief Starts a new acquisition, numbering samples from zero, and describes it to the browsers.
+ */
+void LiveStream::begin(uint8_t channel, uint16_t rate, float gain, float offset, float factor)
+{
+    config.channel = channel;
+    config.rate = rate;
+    config.gain = gain;
+    config.offset = offset;
+    config.factor = factor;
+    config.acquiring = 1;
+    server.broadcast((const uint8_t *)&config, sizeof(config));
+
+    next = 0;
+    history.reset();
+    batch.count = 0;
+    window.count = 0;
+    window.first = 0;
+    sum = 0;
+    squares = 0;
+}
+
+/**
+ * @brief Sends the samples still waiting and tells the browsers the acquisition is over.
+ */
+void LiveStream::end()
+{
+    flush();
+    config.acquiring = 0;
+    server.broadcast((const uint8_t *)&config, sizeof(config));
+}
+
+/**
+ * @brief Describes the current acquisition to a browser that has just connected.
+ */
+void LiveStream::greet(int client)
+{
+    server.sendMessage(client, (const uint8_t *)&config, sizeof(config));
+}
+
+/**
+ * @brief Adds a sample to the batch and to the window, sending the batch when it is full.
+ */
+void LiveStream::insert(int16_t sample)
+{
+    if (batch.count == 0)
+        batch.first = next;
+    batch.samples[batch.count++] = sample;
+    history.insert(sample);
+    next++;
+    if (batch.count == LIVE_BATCH_SAMPLES)
+        flush();
+
+    if (window.count == 0 || sample < window.minimum)
+        window.minimum = sample;
+    if (window.count == 0 || sample > window.maximum)
+        window.maximum = sample;
+    sum += sample;
+    squares += (int32_t)sample * sample;
+    window.count++;
+}
+
+/**
+ * @brief Sends the statistics of the samples inserted since the last window, and starts the next one.
+ *
+ * @param value The measurement computed by the controller for the window.
+ * @return The statistics sent, valid until the next window ends, or NULL if the window had no samples.
+ */
+const LiveStats *LiveStream::endWindow(float value)
+{
+    const LiveStats *statistics = NULL;
+    if (window.count > 0)
+    {
+        double mean = (double)sum / window.count;
+        double variance = (double)squares / window.count - mean * mean;
+        window.value = value;
+        window.mean = (float)mean;
+        window.deviation = (float)sqrt(variance > 0 ? variance : 0);
+        server.broadcast((const uint8_t *)&window, sizeof(window));
+        ended = window;
+        statistics = &ended;
+    }
+    window.first = next;
+    window.count = 0;
+    sum = 0;
+    squares = 0;
+    return statistics;
+}
+
+/**
+ * @brief Answers a request for the chart with the last samples reduced to a fixed number of points.
+ *
+ * The response always has the same size for the same number of points, however long the
+ * window. The points are computed into static arrays, then copied to the queue of the client.
+ */
+void LiveStream::sendChart(int client, const HttpRequest &request)
+{
+    static uint16_t offsets[HISTORY_MAX_POINTS];
+    static int16_t values[HISTORY_MAX_POINTS];
+    static int16_t maxima[HISTORY_MAX_POINTS];
+
+    char parameter[16];
+    uint32_t seconds = findParameter(request, "seconds", parameter, sizeof(parameter)) ? strtoul(parameter, NULL, 10) : 0;
+    uint32_t points = findParameter(request, "points", parameter, sizeof(parameter)) ? strtoul(parameter, NULL, 10) : CHART_DEFAULT_POINTS;
+    bool minmax = findParameter(request, "mode", parameter, sizeof(parameter)) && strcmp(parameter, "minmax") == 0;
+    if (points < 3)
+        points = 3;
+    if (points > HISTORY_MAX_POINTS)
+        points = HISTORY_MAX_POINTS;
+
+    ChartHeader header;
+    memset(&header, 0, sizeof(header));
+    header.mode = minmax ? CHART_MINMAX : CHART_LTTB;
+    header.channel = config.channel;
+    header.rate = config.rate;
+    header.scale = config.gain * config.factor;
+    header.count = history.getRetained();
+    if (seconds > 0 && (uint64_t)seconds * config.rate < header.count)
+        header.count = seconds * config.rate;
+    header.first = history.getNext() - header.count;
+    header.points = minmax ? history.downsampleMinMax(header.first, header.count, points, values, maxima)
+                           : history.downsampleLttb(header.first, header.count, points, offsets, values);
+
+    size_t length = sizeof(header) + header.points * 4;
+    if (!server.respond(client, 200, "application/octet-stream", length, "Cache-Control: no-store\r\n"))
+        return;
+    server.writeBody(client, &header, sizeof(header));
+    server.writeBody(client, minmax ? (const void *)values : (const void *)offsets, header.points * 2);
+    server.writeBody(client, minmax ? (const void *)maxima : (const void *)values, header.points * 2);
+}
+
+/**
+ * @brief Sends the batch of samples collected so far, even if it is not full.
+ */
+void LiveStream::flush()
+{
+    if (batch.count == 0)
+        return;
+    size_t length = sizeof(batch) - sizeof(batch.samples) + batch.count * sizeof(int16_t);
+    server.broadcast((const uint8_t *)&batch, length);
+    batch.count = 0;
+}
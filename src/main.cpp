@@ -11,11 +11,13 @@
 #include <Arduino.h>
 #include "../include/view.h"
 #include "../include/controller.h"
+#include "../include/storage.h"
 
 // STATE VARIABLES
 int menu = 1;
 boolean stateMenu = 1;
 boolean subSetup = 1;
+boolean remoteStart = 0; // The acquisition was started by autostart or a START command, not from the menu
 
 // Start submenu loops with controller actions
 /**
@@ -52,12 +54,16 @@ void executeAction()
         {
           loggerActSD();
         }
+        closeSession();
         break;
       }
+      endAcquisition();
     }
     else
     {
-      if (currentMode == SD_ONLY)
+      // Restarting mounts the card again; not after autostart, which would start and fail again
+      // at every boot, nor after a command, whose PC would lose the port
+      if (currentMode == SD_ONLY && isAdcReady() && !remoteStart)
         ESP.restart();
     }
     stateMenu = 1;
@@ -91,6 +97,7 @@ void executeAction()
     stateMenu = 1;
     break;
   }
+  saveSettings();
   soundBuzzer(selectFrequency, selectDuration);
   updateMenu(menu);
 }
@@ -101,16 +108,62 @@ void executeAction()
 void setup()
 {
 
-  while (!initializeDevices())
-  {
-    delay(1000);
-  }
+  // The card (mounting it repairs the last session if it was interrupted by a power loss) and
+  // the Wi-Fi come up in the background; a device that fails is left out
+  initializeDevices();
+#ifdef SD_BENCHMARK
+  // Once the card task has finished and the RTC, which names the benchmark sessions, is set up
+  if (isCardReady())
+    sdBenchmark(Serial);
+#endif
+
+  // With autostart, the acquisition begins from the first loop(), without the menu
+  loadSettings();
 
   updateMenu(menu);
+#ifdef BOOT_PROFILE
+  printBootTimeline();
+#endif
 }
 
 void loop()
 {
+  // A START command runs the acquisition as if it had been selected from the menu
+  if (isStartRequested())
+  {
+    menu = 1;
+    stateMenu = 0;
+    remoteStart = 1;
+    executeAction();
+    remoteStart = 0;
+  }
+
+  // A CALIBRATE command runs the guided calibration until the curve is fitted or it is cancelled
+  if (isCalibrationRequested())
+  {
+    adcSetup();
+    beginCalibration();
+    while (!select() && isCalibrating())
+    {
+      calibrationAct();
+    }
+    endCalibration();
+    updateMenu(menu);
+  }
+
+  // A SPECTRUM command runs the spectrum mode until SELECT, or another SPECTRUM of size 0
+  if (isSpectrumRequested())
+  {
+    adcSetup();
+    beginSpectrum();
+    while (!select() && isAnalyzing())
+    {
+      spectrumAct();
+    }
+    endSpectrum();
+    updateMenu(menu);
+  }
+
   if (stateMenu)
   {
     if (goDown())
@@ -0,0 +1,182 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "../include/metrics.h"
+
+// The registry, filled by the constructors; both are null before any of them runs
+static Metric *firstMetric;
+static Metric *lastMetric;
+
+static MetricsCursor cursors[HTTP_MAX_CLIENTS]; // Of the /metrics responses being sent
+
+/**
+ * @brief Appends formatted text, remembering if it did not fit.
+ */
+static void append(char *buffer, size_t size, size_t *used, const char *format, ...)
+{
+    if (*used >= size)
+        return;
+    va_list arguments;
+    va_start(arguments, format);
+    int length = vsnprintf(buffer + *used, size - *used, format, arguments);
+    va_end(arguments);
+    *used = length < 0 ? size : *used + length;
+}
+
+Metric::Metric(const char *name, const char *help, METRIC_TYPE type)
+{
+    this->name = name;
+    this->help = help;
+    this->type = type;
+    next = NULL;
+    if (lastMetric)
+        lastMetric->next = this;
+    else
+        firstMetric = this;
+    lastMetric = this;
+}
+
+/**
+ * @brief Writes the metric in the OpenMetrics text format: its TYPE and HELP lines, then its samples.
+ *
+ * @return The length of the text, or 0 if it does not fit.
+ */
+size_t Metric::format(char *buffer, size_t size) const
+{
+    static const char *typeNames[] = {"counter", "gauge", "histogram"};
+    size_t used = 0;
+    append(buffer, size, &used, "# TYPE %s %s\n# HELP %s %s\n", name, typeNames[type], name, help);
+    if (type == METRIC_COUNTER)
+        append(buffer, size, &used, "%s_total %lu\n", name, (unsigned long)((const Counter *)this)->get());
+    else if (type == METRIC_GAUGE)
+        append(buffer, size, &used, "%s %ld\n", name, (long)((const Gauge *)this)->get());
+    else
+    {
+        size_t samples = ((const Histogram *)this)->format(buffer + used, used < size ? size - used : 0);
+        used = samples > 0 ? used + samples : size;
+    }
+    return used < size ? used : 0;
+}
+
+Counter::Counter(const char *name, const char *help) : Metric(name, help, METRIC_COUNTER)
+{
+    value = 0;
+}
+
+Gauge::Gauge(const char *name, const char *help, int32_t (*read)()) : Metric(name, help, METRIC_GAUGE)
+{
+    value = 0;
+    this->read = read;
+}
+
+/**
+ * @param bounds At most METRIC_MAX_BUCKETS upper bounds in microseconds, which must stay valid: a constant.
+ */
+Histogram::Histogram(const char *name, const char *help, const uint32_t *bounds, uint8_t boundCount)
+    : Metric(name, help, METRIC_HISTOGRAM)
+{
+    this->bounds = bounds;
+    this->boundCount = boundCount < METRIC_MAX_BUCKETS ? boundCount : METRIC_MAX_BUCKETS;
+    for (uint8_t i = 0; i <= METRIC_MAX_BUCKETS; i++)
+        buckets[i] = 0;
+    sum = 0;
+}
+
+/**
+ * @brief Writes the cumulative buckets, the sum and the count of the observations.
+ *
+ * The buckets are copied first, so the counts are consistent with each other even if an
+ * interrupt observes a value meanwhile.
+ *
+ * @return The length of the text, or 0 if it does not fit.
+ */
+size_t Histogram::format(char *buffer, size_t size) const
+{
+    uint32_t counts[METRIC_MAX_BUCKETS + 1];
+    for (uint8_t i = 0; i <= boundCount; i++)
+        counts[i] = buckets[i];
+    uint64_t total = sum;
+
+    size_t used = 0;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < boundCount; i++)
+    {
+        cumulative += counts[i];
+        append(buffer, size, &used, "%s_bucket{le=\"%g\"} %lu\n", name, bounds[i] / 1e6, (unsigned long)cumulative);
+    }
+    cumulative += counts[boundCount];
+    append(buffer, size, &used, "%s_bucket{le=\"+Inf\"} %lu\n%s_sum %.6f\n%s_count %lu\n", name,
+           (unsigned long)cumulative, name, total / 1e6, name, (unsigned long)cumulative);
+    return used < size ? used : 0;
+}
+
+/**
+ * @brief Starts a text of the registry, written in pieces by formatMetrics().
+ */
+void beginMetrics(MetricsCursor &cursor)
+{
+    cursor.next = firstMetric;
+    cursor.ended = false;
+}
+
+/**
+ * @brief Writes the next metrics of the registry that fit whole, then "# EOF".
+ *
+ * A metric too long for METRICS_FAMILY_SIZE bytes is left out rather than cut.
+ *
+ * @return The length written, 0 once the text is complete.
+ */
+size_t formatMetrics(MetricsCursor &cursor, char *buffer, size_t size)
+{
+    size_t used = 0;
+    while (cursor.next)
+    {
+        size_t length = cursor.next->format(buffer + used, size - used);
+        if (length == 0 && used > 0)
+            return used; // Goes in the next piece
+        if (length == 0 && size < METRICS_FAMILY_SIZE)
+            return 0; // Buffer too short to go on
+        used += length;
+        cursor.next = cursor.next->next;
+    }
+    if (!cursor.ended && size - used >= 6)
+    {
+        memcpy(buffer + used, "# EOF\n", 6);
+        used += 6;
+        cursor.ended = true;
+    }
+    return used;
+}
+
+/**
+ * @brief Writes the whole registry, as far as it fits.
+ *
+ * @return The length of the text.
+ */
+size_t writeMetrics(char *buffer, size_t size)
+{
+    MetricsCursor cursor;
+    beginMetrics(cursor);
+    size_t used = 0, length;
+    while ((length = formatMetrics(cursor, buffer + used, size - used)) > 0)
+        used += length;
+    return used;
+}
+
+/**
+ * @brief Writes the next metrics of a /metrics response, see HttpBodySource.
+ */
+static size_t readMetrics(int client, uint8_t *buffer, size_t size)
+{
+    return buffer ? formatMetrics(cursors[client], (char *)buffer, size) : 0;
+}
+
+/**
+ * @brief Answers GET /metrics with the registry, streamed in chunks as it is written.
+ */
+void serveMetrics(HttpServer &server, int client, const HttpRequest &)
+{
+    beginMetrics(cursors[client]);
+    if (server.respond(client, 200, METRICS_CONTENT_TYPE, HTTP_CHUNKED, "Cache-Control: no-store\r\n"))
+        server.attach(client, readMetrics, HTTP_CHUNKED);
+}
@@ -0,0 +1,492 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/mqtt.h"
+#include "../include/metrics.h"
+#ifdef ESP32
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// Control packets (MQTT 3.1.1): the type in the high nibble of the first byte, then flags
+#define MQTT_CONNECT 0x10
+#define MQTT_CONNACK 0x20
+#define MQTT_PUBLISH_QOS1 0x32
+#define MQTT_PUBACK 0x40
+#define MQTT_PINGREQ 0xC0
+#define MQTT_PINGRESP 0xD0
+
+#define MQTT_PROTOCOL_LEVEL 4 // 3.1.1
+#define MQTT_CLEAN_SESSION 0x02
+
+static Counter publishedMetric("ds32_mqtt_published_messages", "Messages acknowledged by the MQTT broker.");
+static Counter spooledMetric("ds32_mqtt_spooled_messages", "Messages written to the spool while the broker could not be reached.");
+static Counter lostMetric("ds32_mqtt_lost_messages", "Messages lost because the spool could not be written or read.");
+static Counter connectionsMetric("ds32_mqtt_connections", "Connections accepted by the MQTT broker.");
+
+static void setNonBlocking(int socket)
+{
+    fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static uint8_t *putString(uint8_t *out, const char *text)
+{
+    size_t length = strlen(text);
+    *out++ = (uint8_t)(length >> 8);
+    *out++ = (uint8_t)length;
+    memcpy(out, text, length);
+    return out + length;
+}
+
+/**
+ * @brief Writes the remaining length of a packet, 7 bits per byte.
+ */
+static uint8_t *putRemaining(uint8_t *out, size_t length)
+{
+    do
+    {
+        uint8_t byte = length % 128;
+        length /= 128;
+        *out++ = length > 0 ? byte | 0x80 : byte;
+    } while (length > 0);
+    return out;
+}
+
+/**
+ * @param spool Where the messages go while the queue is full, usually a file on the card.
+ */
+MqttPublisher::MqttPublisher(const MqttSpool &spool) : spool(spool)
+{
+    host = NULL;
+    port = MQTT_PORT;
+    clientId[0] = 0;
+    connection = -1;
+    state = MQTT_DISCONNECTED;
+    stateTime = 0;
+    lastTransmit = 0;
+    lastReceive = 0;
+    packetLength = 0;
+    packetSent = 0;
+    inputLength = 0;
+    inflight = false;
+    inflightSpool = false;
+    inflightSize = 0;
+    packetId = 0;
+    queueHead = 0;
+    queueTail = 0;
+    spoolLength = 0;
+    spoolPosition = 0;
+    memset(&statsHeader, 0, sizeof(statsHeader));
+    memset(&rawHeader, 0, sizeof(rawHeader));
+    raw = false;
+    next = 0;
+}
+
+/**
+ * @brief Enables the publisher, which connects at the next poll(), and replays what the spool
+ * kept from before the reboot.
+ *
+ * @param host The IPv4 address of the broker, which must stay valid: a constant.
+ */
+void MqttPublisher::begin(const char *host, uint16_t port, const char *clientId)
+{
+    this->host = host;
+    this->port = port;
+    snprintf(this->clientId, sizeof(this->clientId), "%s", clientId);
+    snprintf(topics[MQTT_STATS], sizeof(topics[MQTT_STATS]), "ds32/%s/stats", this->clientId);
+    snprintf(topics[MQTT_RAW], sizeof(topics[MQTT_RAW]), "ds32/%s/raw", this->clientId);
+    spoolLength = spool.size();
+    spoolPosition = 0;
+}
+
+/**
+ * @brief Starts the messages of a new acquisition, numbering them and the samples from zero.
+ *
+ * @param startTime Seconds since 1970 when the acquisition started.
+ * @param raw Whether the samples are published too, or only the statistics of the windows.
+ */
+void MqttPublisher::start(uint8_t channel, uint16_t rate, float scale, uint32_t startTime, bool raw)
+{
+    memset(&statsHeader, 0, sizeof(statsHeader));
+    statsHeader.topic = MQTT_STATS;
+    statsHeader.channel = channel;
+    statsHeader.start = startTime;
+    statsHeader.rate = rate;
+    statsHeader.scale = scale;
+    rawHeader = statsHeader;
+    rawHeader.topic = MQTT_RAW;
+    this->raw = raw && host;
+    next = 0;
+}
+
+/**
+ * @brief Adds the statistics of a window to the batch, which is queued once it is full.
+ */
+void MqttPublisher::addWindow(const LiveStats &window)
+{
+    if (!host)
+        return;
+    if (statsHeader.count == 0)
+        statsHeader.first = window.first;
+    windows[statsHeader.count++] = window;
+    if (statsHeader.count == MQTT_BATCH_WINDOWS)
+        enqueue(statsHeader, windows, sizeof(windows));
+}
+
+/**
+ * @brief Queues the samples inserted so far, even if they do not fill a message.
+ */
+void MqttPublisher::flushRaw()
+{
+    if (rawHeader.count > 0)
+        enqueue(rawHeader, samples, rawHeader.count * sizeof(int16_t));
+}
+
+/**
+ * @brief Queues the last windows and samples of the acquisition.
+ */
+void MqttPublisher::end()
+{
+    flushRaw();
+    if (statsHeader.count > 0)
+        enqueue(statsHeader, windows, statsHeader.count * sizeof(LiveStats));
+}
+
+/**
+ * @brief Puts a message behind the others, in the queue or in the spool, and starts the next
+ * message of its topic.
+ *
+ * A message goes to the spool when the queue is full, and as long as the spool is not empty,
+ * so that it is never sent before an older one.
+ */
+void MqttPublisher::enqueue(MqttHeader &header, const void *body, size_t bodyLength)
+{
+    static uint8_t record[MQTT_RECORD_HEADER + MQTT_MAX_MESSAGE];
+    size_t length = sizeof(header) + bodyLength;
+    size_t size = MQTT_RECORD_HEADER + length;
+    record[0] = header.topic;
+    record[1] = (uint8_t)length;
+    record[2] = (uint8_t)(length >> 8);
+    memcpy(record + MQTT_RECORD_HEADER, &header, sizeof(header));
+    memcpy(record + MQTT_RECORD_HEADER + sizeof(header), body, bodyLength);
+    header.sequence++;
+    header.count = 0;
+
+    if (spoolLength == 0 && queueTail + size > MQTT_QUEUE_SIZE && queueHead > 0)
+    {
+        memmove(queue, queue + queueHead, queueTail - queueHead);
+        queueTail -= queueHead;
+        queueHead = 0;
+    }
+    if (spoolLength == 0 && queueTail + size <= MQTT_QUEUE_SIZE)
+    {
+        memcpy(queue + queueTail, record, size);
+        queueTail += size;
+    }
+    else if (spool.append(record, size))
+    {
+        spoolLength += size;
+        spooledMetric.add();
+    }
+    else
+        lostMetric.add();
+}
+
+/**
+ * @brief Connects, publishes the next message and keeps the connection alive, without waiting.
+ *
+ * @param now millis()
+ */
+void MqttPublisher::poll(uint32_t now)
+{
+    if (!host)
+        return;
+    if (state == MQTT_DISCONNECTED)
+    {
+        if (now - stateTime >= MQTT_RETRY)
+            connect(now);
+        return;
+    }
+
+    if (state == MQTT_CONNECTING)
+    {
+        // The socket becomes writable once the connection is established or has failed
+        fd_set writable;
+        FD_ZERO(&writable);
+        FD_SET(connection, &writable);
+        struct timeval zero = {0, 0};
+        if (select(connection + 1, NULL, &writable, NULL, &zero) <= 0)
+        {
+            if (now - stateTime >= MQTT_TIMEOUT)
+                disconnect(now);
+            return;
+        }
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (getsockopt(connection, SOL_SOCKET, SO_ERROR, &error, &length) != 0 || error != 0)
+        {
+            disconnect(now);
+            return;
+        }
+
+        uint8_t *out = packet;
+        *out++ = MQTT_CONNECT;
+        out = putRemaining(out, 10 + 2 + strlen(clientId));
+        out = putString(out, "MQTT");
+        *out++ = MQTT_PROTOCOL_LEVEL;
+        *out++ = MQTT_CLEAN_SESSION;
+        *out++ = 0;
+        *out++ = MQTT_KEEPALIVE;
+        out = putString(out, clientId);
+        packetLength = out - packet;
+        packetSent = 0;
+        lastTransmit = now;
+        lastReceive = now;
+        setState(MQTT_WAITING, now);
+    }
+
+    if (!transmit() || !receive(now))
+    {
+        disconnect(now);
+        return;
+    }
+    if (state == MQTT_WAITING)
+    {
+        if (now - stateTime >= MQTT_TIMEOUT)
+            disconnect(now);
+        return;
+    }
+    if ((inflight && now - lastTransmit >= MQTT_TIMEOUT) || now - lastReceive >= MQTT_KEEPALIVE * 1000UL)
+    {
+        disconnect(now); // The message is sent again after the next connection
+        return;
+    }
+    if (packetSent < packetLength || inflight)
+        return;
+
+    publishNext(now);
+    if (!inflight && now - lastTransmit >= MQTT_KEEPALIVE * 500UL)
+    {
+        packet[0] = MQTT_PINGREQ;
+        packet[1] = 0;
+        packetLength = 2;
+        packetSent = 0;
+        lastTransmit = now;
+    }
+    if (!transmit())
+        disconnect(now);
+}
+
+void MqttPublisher::setState(MQTT_STATE state, uint32_t now)
+{
+    this->state = state;
+    stateTime = now;
+}
+
+/**
+ * @brief Starts a non-blocking connection to the broker, checked by the next polls.
+ */
+void MqttPublisher::connect(uint32_t now)
+{
+    setState(MQTT_CONNECTING, now);
+    connection = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (connection < 0)
+    {
+        disconnect(now);
+        return;
+    }
+    setNonBlocking(connection);
+    int yes = 1;
+    setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = inet_addr(host);
+    address.sin_port = htons(port);
+    if (::connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0 && errno != EINPROGRESS)
+        disconnect(now);
+}
+
+/**
+ * @brief Closes the connection; the message in flight stays first in line, and the next
+ * connection is attempted MQTT_RETRY ms later.
+ */
+void MqttPublisher::disconnect(uint32_t now)
+{
+    if (connection >= 0)
+        close(connection);
+    connection = -1;
+    setState(MQTT_DISCONNECTED, now);
+    packetLength = 0;
+    packetSent = 0;
+    inputLength = 0;
+    inflight = false;
+}
+
+/**
+ * @brief Sends what the socket takes of the current packet.
+ *
+ * @return false if the connection failed.
+ */
+bool MqttPublisher::transmit()
+{
+    while (packetSent < packetLength)
+    {
+        ssize_t sent = send(connection, packet + packetSent, packetLength - packetSent, MSG_NOSIGNAL);
+        if (sent < 0)
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        packetSent += sent;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the packets of the broker that have arrived.
+ *
+ * @return false if the connection was closed or the broker sent something unexpected.
+ */
+bool MqttPublisher::receive(uint32_t now)
+{
+    for (;;)
+    {
+        size_t needed = inputLength < 2 ? 2 : 2 + input[1];
+        ssize_t received = recv(connection, input + inputLength, needed - inputLength, 0);
+        if (received == 0)
+            return false;
+        if (received < 0)
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        inputLength += received;
+        lastReceive = now;
+        if (inputLength < 2)
+            continue;
+        if (input[1] > sizeof(input) - 2)
+            return false; // Longer than any packet that answers a publisher
+        if (inputLength == (size_t)2 + input[1])
+        {
+            if (!handlePacket(now))
+                return false;
+            inputLength = 0;
+        }
+    }
+}
+
+/**
+ * @return false if the packet is not one the broker should send.
+ */
+bool MqttPublisher::handlePacket(uint32_t now)
+{
+    switch (input[0])
+    {
+    case MQTT_CONNACK:
+        if (state != MQTT_WAITING || input[1] != 2 || input[3] != 0)
+            return false; // Refused
+        setState(MQTT_CONNECTED, now);
+        connectionsMetric.add();
+        return true;
+    case MQTT_PUBACK:
+        if (input[1] == 2 && inflight && (input[2] << 8 | input[3]) == packetId)
+            acknowledge();
+        return input[1] == 2;
+    case MQTT_PINGRESP:
+        return input[1] == 0;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Sends the oldest message as a PUBLISH, from the queue, or from the spool once the queue is empty.
+ */
+void MqttPublisher::publishNext(uint32_t now)
+{
+    uint8_t record[MQTT_RECORD_HEADER];
+    const uint8_t *payload = NULL;
+    if (queueHead < queueTail)
+    {
+        memcpy(record, queue + queueHead, MQTT_RECORD_HEADER);
+        payload = queue + queueHead + MQTT_RECORD_HEADER;
+    }
+    else if (spoolPosition >= spoolLength)
+        return;
+    else if (spool.read(spoolPosition, record, MQTT_RECORD_HEADER) != MQTT_RECORD_HEADER)
+    {
+        discardSpool();
+        return;
+    }
+
+    size_t length = record[1] | record[2] << 8;
+    if (record[0] > MQTT_RAW || length > MQTT_MAX_MESSAGE)
+    {
+        discardSpool(); // Only the spool can be damaged, by a write cut short
+        return;
+    }
+    const char *topic = topics[record[0]];
+    if (++packetId == 0)
+        packetId = 1;
+
+    uint8_t *out = packet;
+    *out++ = MQTT_PUBLISH_QOS1;
+    out = putRemaining(out, 2 + strlen(topic) + 2 + length);
+    out = putString(out, topic);
+    *out++ = (uint8_t)(packetId >> 8);
+    *out++ = (uint8_t)packetId;
+    if (payload)
+        memcpy(out, payload, length);
+    else if (spool.read(spoolPosition + MQTT_RECORD_HEADER, out, length) != length)
+    {
+        discardSpool();
+        return;
+    }
+    packetLength = out + length - packet;
+    packetSent = 0;
+    lastTransmit = now;
+    inflight = true;
+    inflightSpool = payload == NULL;
+    inflightSize = MQTT_RECORD_HEADER + length;
+}
+
+/**
+ * @brief Removes the message in flight, acknowledged by the broker, from the queue or the spool.
+ */
+void MqttPublisher::acknowledge()
+{
+    inflight = false;
+    publishedMetric.add();
+    if (!inflightSpool)
+    {
+        queueHead += inflightSize;
+        if (queueHead == queueTail)
+            queueHead = queueTail = 0;
+        return;
+    }
+    spoolPosition += inflightSize;
+    if (spoolPosition >= spoolLength)
+    {
+        spool.clear();
+        spoolLength = 0;
+        spoolPosition = 0;
+    }
+}
+
+/**
+ * @brief Gives up the messages of a spool that cannot be read back.
+ */
+void MqttPublisher::discardSpool()
+{
+    spool.clear();
+    spoolLength = 0;
+    spoolPosition = 0;
+    lostMetric.add();
+}
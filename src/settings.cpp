@@ -0,0 +1,59 @@
+#include <string.h>
+#include "../include/settings.h"
+#include "../include/crc32.h"
+
+/**
+ * @brief Sets the settings of a logger that never saved any, the globals of the controller.
+ */
+void defaultSettings(Settings *settings)
+{
+    settings->mode = 1;    // SERIAL_ONLY
+    settings->channel = 0; // VOLTAGE
+    settings->rate = 860;
+    settings->gain = 0xFF; // COMMAND_GAIN_DEFAULT
+    settings->compressed = 0;
+    settings->autostart = 0;
+}
+
+/**
+ * @brief Writes the blob of settings.
+ *
+ * @param out At least SETTINGS_SIZE bytes.
+ * @return The size of the blob.
+ */
+size_t encodeSettings(const Settings &settings, uint8_t *out)
+{
+    SettingsHeader header;
+    header.version = SETTINGS_VERSION;
+    header.length = sizeof(Settings);
+    header.crc = crc32(0, (const uint8_t *)&header, 2);
+    header.crc = crc32(header.crc, (const uint8_t *)&settings, sizeof(settings));
+    memcpy(out, &header, sizeof(header));
+    memcpy(out + sizeof(header), &settings, sizeof(settings));
+    return SETTINGS_SIZE;
+}
+
+/**
+ * @brief Reads a blob of settings.
+ *
+ * @param settings Left unchanged if the blob is not valid.
+ * @return true if the blob is valid.
+ */
+bool decodeSettings(const uint8_t *data, size_t length, Settings *settings)
+{
+    SettingsHeader header;
+    if (length < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.version != SETTINGS_VERSION || length != sizeof(header) + header.length)
+        return false;
+    uint32_t crc = crc32(0, data, 2);
+    if (crc32(crc, data + sizeof(header), header.length) != header.crc)
+        return false;
+
+    Settings read;
+    defaultSettings(&read);
+    memcpy(&read, data + sizeof(header), header.length < sizeof(read) ? header.length : sizeof(read));
+    *settings = read;
+    return true;
+}
@@ -0,0 +1,275 @@
+#include <math.h>
+#include <string.h>
+#include "../include/spectrum.h"
+#include "../include/crc32.h"
+
+SpectrumAnalyzer::SpectrumAnalyzer()
+{
+    size = 0;
+    windowKind = SPECTRUM_HANN;
+    windowSum = 1;
+    memset(amplitudes, 0, sizeof(amplitudes));
+    memset(peaks, 0, sizeof(peaks));
+}
+
+/**
+ * @brief Tells whether a block of that many samples can be transformed.
+ */
+bool SpectrumAnalyzer::isValidSize(uint16_t size)
+{
+    return size >= SPECTRUM_MIN_SIZE && size <= SPECTRUM_MAX_SIZE && (size & (size - 1)) == 0;
+}
+
+/**
+ * @brief Tabulates the window and the twiddle factors for blocks of a size.
+ *
+ * @return false if the size or the window is not supported, leaving the analyzer as it was.
+ */
+bool SpectrumAnalyzer::begin(uint16_t size, uint8_t window)
+{
+    if (!isValidSize(size) || window >= SPECTRUM_WINDOWS)
+        return false;
+    this->size = size;
+    windowKind = window;
+
+    // In double, once, so that the tables are as exact as floats allow
+    const double step = 2 * M_PI / size;
+    for (uint16_t k = 0; k < size * 3 / 4; k++)
+    {
+        twiddles[2 * k] = (float)cos(step * k);
+        twiddles[2 * k + 1] = (float)-sin(step * k);
+    }
+
+    // Periodic windows: the block is one period of the signal the FFT sees
+    windowSum = 0;
+    for (uint16_t n = 0; n < size; n++)
+    {
+        double value = window == SPECTRUM_HANN
+                           ? 0.5 - 0.5 * cos(step * n)
+                           : 0.35875 - 0.48829 * cos(step * n) + 0.14128 * cos(2 * step * n) - 0.01168 * cos(3 * step * n);
+        this->window[n] = (float)value;
+        windowSum += (float)value;
+    }
+    memset(amplitudes, 0, sizeof(amplitudes));
+    memset(peaks, 0, sizeof(peaks));
+    return true;
+}
+
+/**
+ * @brief Transforms the size / 2 complex points of data in place, into their natural order.
+ *
+ * A radix-4 butterfly leaves its outputs 0, 2, 1 and 3 in this order, so that the stages end
+ * in bit-reversed order whether or not the last one is radix-2.
+ */
+void SpectrumAnalyzer::transformComplex()
+{
+    const uint16_t points = size / 2;
+    uint16_t span = points;
+    uint16_t stride = 2; // Of the twiddles of the span, in the table of size
+
+    for (; span >= 4; span /= 4, stride *= 4)
+    {
+        const uint16_t quarter = span / 4;
+        for (uint16_t q = 0; q < quarter; q++)
+        {
+            const float *w1 = twiddles + 2 * (stride * q);
+            const float *w2 = twiddles + 2 * (2 * stride * q);
+            const float *w3 = twiddles + 2 * (3 * stride * q);
+            for (uint16_t base = q; base < points; base += span)
+            {
+                float *a = data + 2 * base;
+                float *b = a + 2 * quarter;
+                float *c = b + 2 * quarter;
+                float *d = c + 2 * quarter;
+
+                float sumRe = a[0] + c[0], sumIm = a[1] + c[1];
+                float diffRe = a[0] - c[0], diffIm = a[1] - c[1];
+                float oddRe = b[0] + d[0], oddIm = b[1] + d[1];
+                // (b - d) times -i
+                float turnRe = b[1] - d[1], turnIm = d[0] - b[0];
+
+                float y1Re = diffRe + turnRe, y1Im = diffIm + turnIm;
+                float y2Re = sumRe - oddRe, y2Im = sumIm - oddIm;
+                float y3Re = diffRe - turnRe, y3Im = diffIm - turnIm;
+
+                a[0] = sumRe + oddRe;
+                a[1] = sumIm + oddIm;
+                b[0] = y2Re * w2[0] - y2Im * w2[1];
+                b[1] = y2Re * w2[1] + y2Im * w2[0];
+                c[0] = y1Re * w1[0] - y1Im * w1[1];
+                c[1] = y1Re * w1[1] + y1Im * w1[0];
+                d[0] = y3Re * w3[0] - y3Im * w3[1];
+                d[1] = y3Re * w3[1] + y3Im * w3[0];
+            }
+        }
+    }
+
+    if (span == 2)
+    {
+        for (uint16_t i = 0; i < points; i += 2)
+        {
+            float *a = data + 2 * i;
+            float re = a[0] - a[2], im = a[1] - a[3];
+            a[0] += a[2];
+            a[1] += a[3];
+            a[2] = re;
+            a[3] = im;
+        }
+    }
+
+    for (uint16_t i = 1, j = 0; i < points; i++)
+    {
+        uint16_t bit = points >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j)
+        {
+            float re = data[2 * i], im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+/**
+ * @brief Computes the amplitudes and the peaks of a block of the ring.
+ *
+ * @param history The ring of the acquisition, which must still retain the block.
+ * @param first The index of the first sample of the block.
+ * @param rate The samples per second, for the frequencies of the peaks.
+ */
+void SpectrumAnalyzer::transform(const SampleHistory &history, uint32_t first, uint16_t rate)
+{
+    if (size == 0)
+        return;
+
+    // The mean weighted by the window: removing it leaves nothing for bin 0 to leak into the next ones
+    float sum = 0;
+    for (uint16_t n = 0; n < size; n++)
+        sum += history.at(first + n) * window[n];
+    float mean = sum / windowSum;
+    for (uint16_t n = 0; n < size; n++)
+        data[n] = (history.at(first + n) - mean) * window[n];
+
+    transformComplex();
+
+    // Bins k and size / 2 - k of the real block from points k and size / 2 - k of its complex FFT
+    const uint16_t points = size / 2;
+    const float unit = 1 / windowSum; // Twice the amplitude of a sine over the sum of the window, halved below
+    amplitudes[0] = fabsf(mean);
+    amplitudes[points] = fabsf(data[0] - data[1]) * unit;
+    for (uint16_t k = 1; k < points; k++)
+    {
+        const float *z = data + 2 * k;
+        const float *mirror = data + 2 * (points - k);
+        const float *w = twiddles + 2 * k;
+        float evenRe = z[0] + mirror[0], evenIm = z[1] - mirror[1];
+        float oddRe = z[1] + mirror[1], oddIm = mirror[0] - z[0];
+        float re = evenRe + oddRe * w[0] - oddIm * w[1];
+        float im = evenIm + oddRe * w[1] + oddIm * w[0];
+        amplitudes[k] = sqrtf(re * re + im * im) * unit;
+    }
+
+    findPeaks(rate);
+}
+
+/**
+ * @brief Keeps the largest local maxima of the amplitudes, by decreasing amplitude.
+ */
+void SpectrumAnalyzer::findPeaks(uint16_t rate)
+{
+    memset(peaks, 0, sizeof(peaks));
+    const uint16_t points = size / 2;
+    const float binWidth = (float)rate / size;
+    for (uint16_t k = 1; k < points; k++)
+    {
+        // Bin 0 holds the mean, which was removed from the block
+        float amplitude = amplitudes[k];
+        if (!((k == 1 || amplitude > amplitudes[k - 1]) && amplitude >= amplitudes[k + 1]) ||
+            amplitude <= peaks[SPECTRUM_PEAKS - 1].amplitude)
+            continue;
+
+        // Vertex of the parabola through the logarithms, within half a bin of k for a window
+        float offset = 0;
+        if (k > 1 && amplitudes[k - 1] > 0 && amplitudes[k + 1] > 0)
+        {
+            float left = logf(amplitudes[k - 1]), centre = logf(amplitude), right = logf(amplitudes[k + 1]);
+            float curvature = left - 2 * centre + right;
+            if (curvature < 0)
+                offset = 0.5f * (left - right) / curvature;
+        }
+
+        uint8_t i = SPECTRUM_PEAKS - 1;
+        for (; i > 0 && peaks[i - 1].amplitude < amplitude; i--)
+            peaks[i] = peaks[i - 1];
+        peaks[i].frequency = (k + offset) * binWidth;
+        peaks[i].amplitude = amplitude;
+    }
+}
+
+/**
+ * @brief Writes the record of the last spectrum, see spectrum.h.
+ *
+ * @param out At least SPECTRUM_MAX_RECORD bytes.
+ * @return The size of the record.
+ */
+size_t SpectrumAnalyzer::encode(uint16_t rate, uint32_t sequence, uint32_t first, uint32_t cycles, uint8_t *out) const
+{
+    SpectrumHeader header;
+    header.magic = SPECTRUM_MAGIC;
+    header.window = windowKind;
+    header.size = size;
+    header.rate = rate;
+    header.bins = getBins();
+    header.sequence = sequence;
+    header.first = first;
+    header.cycles = cycles;
+    memcpy(header.peaks, peaks, sizeof(header.peaks));
+
+    float largest = 0;
+    for (uint16_t k = 0; k < header.bins; k++)
+    {
+        if (amplitudes[k] > largest)
+            largest = amplitudes[k];
+    }
+    header.scale = largest > 0 ? largest / 65535 : 1;
+
+    uint8_t *bins = out + sizeof(header);
+    for (uint16_t k = 0; k < header.bins; k++)
+    {
+        uint16_t value = (uint16_t)(amplitudes[k] / header.scale + 0.5f);
+        bins[2 * k] = (uint8_t)value;
+        bins[2 * k + 1] = (uint8_t)(value >> 8);
+    }
+    header.crc = crc32(0, (const uint8_t *)&header, offsetof(SpectrumHeader, crc));
+    header.crc = crc32(header.crc, bins, 2 * header.bins);
+    memcpy(out, &header, sizeof(header));
+    return sizeof(header) + 2 * header.bins;
+}
+
+/**
+ * @brief Checks whether a complete, intact spectrum record starts at the given position.
+ *
+ * @param data The bytes to check.
+ * @param length The number of bytes available from data.
+ * @return The size of the record, or -1 if there is none.
+ */
+int checkSpectrum(const uint8_t *data, size_t length)
+{
+    SpectrumHeader header;
+
+    if (length < sizeof(header) || data[0] != SPECTRUM_MAGIC)
+        return -1;
+    memcpy(&header, data, sizeof(header));
+    if (!SpectrumAnalyzer::isValidSize(header.size) || header.bins != header.size / 2 + 1 ||
+        sizeof(header) + 2 * header.bins > length)
+        return -1;
+
+    uint32_t crc = crc32(0, data, offsetof(SpectrumHeader, crc));
+    if (crc32(crc, data + sizeof(header), 2 * header.bins) != header.crc)
+        return -1;
+    return sizeof(header) + 2 * header.bins;
+}
@@ -0,0 +1,990 @@
+#include <unistd.h>
+#include "../include/storage.h"
+#include "../include/controller.h"
+
+// STATE OF THE OPEN SESSION
+File sessionFile;
+static uint16_t sessionNumber = 0;
+static char sessionPath[48];
+static char sessionStart[DATESTAMP_SIZE + TIMESTAMP_SIZE];
+static unsigned long sessionOpenedAt = 0;
+static uint32_t sessionSize = 0;      // Bytes written by the logger
+static uint32_t sessionAllocated = 0; // Bytes reserved on the card
+static boolean sessionActive = false;
+static boolean sessionRaw = false; // Whether the open session streams raw sectors
+static uint32_t rotateSize = SESSION_ROTATE_SIZE;         // Set by setSessionRotation()
+static uint32_t rotateDuration = SESSION_ROTATE_DURATION;
+
+// BLOCK INDEX OF THE OPEN SESSION
+static File indexFile;
+static char indexPath[48];
+static BlockIndexEntry indexEntry; // Entry being filled
+static uint16_t indexRecords = 0;  // Records in indexEntry
+
+// The header is kept so that it can be repeated at the top of every rotated file
+static char sessionHeader[192 + CALIBRATION_CURVE_TEXT_SIZE];
+static size_t sessionHeaderLength = 0;
+
+boolean sdRawStreaming = SD_RAW_SUPPORTED;
+
+#if SD_RAW_SUPPORTED
+// STATE OF THE RAW SECTOR STREAM
+static uint8_t rawBuffer[SD_RAW_BURST][SD_SECTOR_SIZE];
+static uint32_t rawFirstSector = 0;  // First sector of the contiguous extent on the card
+static uint32_t rawSectorCount = 0;  // Length of the extent
+static uint32_t rawBufferSector = 0; // Index in the extent of rawBuffer[0]
+static uint16_t rawFull = 0;         // Sectors of rawBuffer completely filled
+static uint16_t rawOffset = 0;       // Bytes used in the sector being filled
+#endif
+
+/**
+ * @brief Writes the current RTC date and time as "MM/DD/YYYY HH:MM:SS".
+ */
+static char *formatNow(char *buffer, Ds1302::DateTime *now)
+{
+    char *end = formatDate(buffer, now->month, now->day, now->year);
+    *end++ = ' ';
+    return formatTime(end, now->hour, now->minute, now->second);
+}
+
+/**
+ * @brief Writes (or rewrites) the index line of a session.
+ *
+ * Lines have a fixed size, so the line of session N starts at (N - 1) * SESSION_RECORD_SIZE.
+ *
+ * @param state One of the SESSION_STATE_* characters.
+ * @param endStamp The last time stamp of the session, "MM/DD/YYYY HH:MM:SS".
+ */
+static void writeIndexRecord(char state, const char *endStamp)
+{
+    char record[SESSION_RECORD_SIZE + 1];
+
+    // 0001 R C 0001_241019_123000.ds32 10/19/2024 12:30:00 10/19/2024 13:30:00 12345678
+    char *end = record;
+    if (sessionNumber < 1000)
+        *end++ = '0';
+    if (sessionNumber < 100)
+        *end++ = '0';
+    if (sessionNumber < 10)
+        *end++ = '0';
+    end = formatUInt(end, sessionNumber);
+    *end++ = ' ';
+    *end++ = sessionRaw ? SESSION_MODE_RAW : SESSION_MODE_FILE;
+    *end++ = ' ';
+    *end++ = state;
+    *end++ = ' ';
+    end = formatString(end, sessionPath + sizeof(SESSION_DIR));
+    end = formatString(end, " ");
+    end = formatString(end, sessionStart);
+    end = formatString(end, " ");
+    end = formatString(end, endStamp);
+    end = formatString(end, " ");
+    end = formatUInt(end, sessionSize);
+    while (end < record + SESSION_RECORD_SIZE - 1)
+        *end++ = ' ';
+    record[SESSION_RECORD_SIZE - 1] = '\n';
+
+    File index = SD.open(SESSION_INDEX, SD.exists(SESSION_INDEX) ? "r+" : FILE_WRITE);
+    if (!index)
+        return;
+    index.seek((uint32_t)(sessionNumber - 1) * SESSION_RECORD_SIZE);
+    index.write((const uint8_t *)record, SESSION_RECORD_SIZE);
+    index.close();
+}
+
+/**
+ * @brief Updates the index line of the current session with the RTC time as its end.
+ */
+static void writeIndexRecord(char state)
+{
+    char endStamp[DATESTAMP_SIZE + TIMESTAMP_SIZE];
+    Ds1302::DateTime now;
+    rtc.getDateTime(&now);
+    formatNow(endStamp, &now);
+    writeIndexRecord(state, endStamp);
+}
+
+/**
+ * @brief Derives the path of the block index from the path of the session file.
+ */
+static void setIndexPath()
+{
+    char *end = formatString(indexPath, sessionPath);
+    formatString(end - (sizeof(SESSION_EXTENSION) - 1), BLOCK_INDEX_EXTENSION);
+}
+
+/**
+ * @brief Appends the entry being filled to the block index.
+ */
+static void flushIndexEntry()
+{
+    if (indexRecords == 0)
+        return;
+    indexFile.write((const uint8_t *)&indexEntry, sizeof(indexEntry));
+    indexRecords = 0;
+}
+
+/**
+ * @brief Adds a record to the block index, writing an entry every BLOCK_INDEX_INTERVAL records.
+ *
+ * @param position The position of the record in the session file.
+ */
+static void indexRecord(uint32_t position, const BlockHeader *header, const BlockSummary *summary)
+{
+    if (indexRecords == 0)
+    {
+        indexEntry.offset = position;
+        indexEntry.sequence = header->sequence;
+        indexEntry.first = header->first;
+        indexEntry.time = header->time;
+        indexEntry.count = 0;
+        indexEntry.minimum = summary->minimum;
+        indexEntry.maximum = summary->maximum;
+        indexEntry.sum = 0;
+    }
+
+    indexEntry.count += summary->count;
+    if (summary->minimum < indexEntry.minimum)
+        indexEntry.minimum = summary->minimum;
+    if (summary->maximum > indexEntry.maximum)
+        indexEntry.maximum = summary->maximum;
+    indexEntry.sum += summary->sum;
+
+    if (++indexRecords == BLOCK_INDEX_INTERVAL)
+        flushIndexEntry();
+}
+
+/**
+ * @brief Reserves clusters for the next SESSION_PREALLOCATE bytes of the session file.
+ *
+ * Writing one byte past the end makes FATFS link the whole range at once, so the logger
+ * does not extend the cluster chain (and update the FAT) on every write.
+ */
+static void preallocate()
+{
+    sessionAllocated += SESSION_PREALLOCATE;
+    sessionFile.seek(sessionAllocated - 1);
+    sessionFile.write((uint8_t)0);
+    sessionFile.seek(sessionSize);
+}
+
+#if SD_RAW_SUPPORTED
+/**
+ * @brief Builds the FATFS path ("0:/sessions/...") of a file on the card.
+ */
+static char *fatfsPath(char *buffer, const char *path)
+{
+    buffer[0] = '0' + SD_RAW_DRIVE;
+    buffer[1] = ':';
+    return formatString(buffer + 2, path);
+}
+
+/**
+ * @brief Opens a session file through FATFS and returns the first sector of its data.
+ */
+static uint32_t firstSectorOf(FIL *fil)
+{
+    FATFS *fs = fil->obj.fs;
+    return fs->database + fs->csize * (fil->obj.sclust - 2);
+}
+
+/**
+ * @brief Creates the session file as one contiguous extent of SD_RAW_EXTENT bytes.
+ *
+ * The directory entry already holds the full size; it is truncated to the written size
+ * when the session is closed, or by recoverSessions() after a power loss.
+ *
+ * @return true if the extent was allocated, false if the card has no contiguous space left.
+ */
+static boolean createRawExtent()
+{
+    char path[sizeof(sessionPath) + 2];
+    FIL fil;
+
+    fatfsPath(path, sessionPath);
+    if (f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+        return false;
+
+    if (f_expand(&fil, SD_RAW_EXTENT, 1) != FR_OK)
+    {
+        f_close(&fil);
+        f_unlink(path);
+        return false;
+    }
+
+    rawFirstSector = firstSectorOf(&fil);
+    rawSectorCount = SD_RAW_EXTENT / SD_SECTOR_SIZE;
+    rawBufferSector = rawFull = rawOffset = 0;
+    f_close(&fil);
+    return true;
+}
+
+/**
+ * @brief Completes the footer of a buffered sector.
+ */
+static void sealSector(uint16_t slot, uint16_t length)
+{
+    SectorFooter *footer = (SectorFooter *)(rawBuffer[slot] + SD_SECTOR_PAYLOAD);
+    footer->session = sessionNumber;
+    footer->length = length;
+    footer->sequence = rawBufferSector + slot;
+}
+
+/**
+ * @brief Writes the buffered sectors to the extent with one multi-sector command.
+ *
+ * @param partial Whether the sector being filled is written too (it stays in the buffer and is written again when full).
+ */
+static void flushRawSectors(boolean partial)
+{
+    uint16_t count = rawFull;
+    if (partial && rawOffset > 0)
+    {
+        sealSector(rawFull, rawOffset);
+        count++;
+    }
+    if (count == 0)
+        return;
+
+    disk_write(SD_RAW_DRIVE, rawBuffer[0], rawFirstSector + rawBufferSector, count);
+
+    // Keep the partial sector at the top of the buffer
+    if (rawFull > 0 && rawOffset > 0)
+        memcpy(rawBuffer[0], rawBuffer[rawFull], rawOffset);
+    rawBufferSector += rawFull;
+    rawFull = 0;
+    sessionSize = (rawBufferSector + (rawOffset > 0)) * SD_SECTOR_SIZE;
+}
+
+/**
+ * @brief Appends data to the raw sector stream.
+ */
+static size_t rawWrite(const uint8_t *data, size_t length)
+{
+    size_t written = 0;
+
+    while (written < length)
+    {
+        if (rawBufferSector + rawFull >= rawSectorCount)
+            break; // Extent full, sessionSync() rotates before this can happen
+
+        size_t chunk = SD_SECTOR_PAYLOAD - rawOffset;
+        if (chunk > length - written)
+            chunk = length - written;
+        memcpy(rawBuffer[rawFull] + rawOffset, data + written, chunk);
+        rawOffset += chunk;
+        written += chunk;
+
+        if (rawOffset == SD_SECTOR_PAYLOAD)
+        {
+            sealSector(rawFull, SD_SECTOR_PAYLOAD);
+            rawFull++;
+            rawOffset = 0;
+            if (rawFull == SD_RAW_BURST)
+                flushRawSectors(false);
+        }
+    }
+    return written;
+}
+
+/**
+ * @brief Reads a sector of an extent and checks that it was written by the given session.
+ *
+ * @return The payload length of the sector, or -1 if it does not belong to the session.
+ */
+static int readRawSector(uint8_t *sector, uint32_t first, uint32_t index, uint16_t session)
+{
+    if (disk_read(SD_RAW_DRIVE, sector, first + index, 1) != RES_OK)
+        return -1;
+
+    SectorFooter *footer = (SectorFooter *)(sector + SD_SECTOR_PAYLOAD);
+    if (footer->session != session || footer->sequence != index || footer->length > SD_SECTOR_PAYLOAD)
+        return -1;
+    return footer->length;
+}
+
+/**
+ * @brief Finds the end of an interrupted raw session and truncates its file there.
+ *
+ * Sectors are written in order and carry their index, so the written ones form a prefix
+ * of the extent: a binary search finds its end with O(log n) sector reads.
+ *
+ * @return true if the file was repaired, false otherwise.
+ */
+static boolean recoverRawSession()
+{
+    char path[sizeof(sessionPath) + 2];
+    FIL fil;
+
+    fatfsPath(path, sessionPath);
+    if (f_open(&fil, path, FA_WRITE) != FR_OK)
+        return false;
+
+    uint32_t first = firstSectorOf(&fil);
+    uint32_t low = 0, high = f_size(&fil) / SD_SECTOR_SIZE; // Sectors [0, low) are valid, [high, ...) are not
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        if (readRawSector(rawBuffer[0], first, middle, sessionNumber) >= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    sessionSize = low * SD_SECTOR_SIZE;
+    boolean repaired = f_lseek(&fil, sessionSize) == FR_OK && f_truncate(&fil) == FR_OK;
+    f_close(&fil);
+    return repaired;
+}
+#endif
+
+// Window read by the repair scan: any such window before the end of the written records
+// contains a whole record
+#define RECOVERY_WINDOW (2 * BLOCK_MAX_SIZE)
+static uint8_t scanBuffer[RECOVERY_WINDOW];
+
+/**
+ * @brief Reads part of a file.
+ *
+ * @return The number of bytes read.
+ */
+static size_t readAt(File &file, uint8_t *buffer, uint32_t offset, size_t length)
+{
+    if (!file.seek(offset))
+        return 0;
+    return file.read(buffer, length);
+}
+
+/**
+ * @brief Converts a position in the data of a session to a position in its file.
+ *
+ * They only differ for raw sessions, where every sector ends with a footer.
+ */
+static uint32_t filePosition(uint32_t position, boolean raw)
+{
+    if (!raw)
+        return position;
+    return position / SD_SECTOR_PAYLOAD * SD_SECTOR_SIZE + position % SD_SECTOR_PAYLOAD;
+}
+
+/**
+ * @brief Converts a position in the file of a session to a position in its data.
+ */
+static uint32_t dataPosition(uint32_t position, boolean raw)
+{
+    if (!raw)
+        return position;
+    return position / SD_SECTOR_SIZE * SD_SECTOR_PAYLOAD + position % SD_SECTOR_SIZE;
+}
+
+/**
+ * @brief Reads the data of a session from a position, leaving out the footers of raw sectors.
+ *
+ * @return The number of bytes read, fewer than length at the end of the data.
+ */
+static size_t readData(File &file, uint32_t position, uint8_t *buffer, size_t length, boolean raw)
+{
+    if (!raw)
+        return readAt(file, buffer, position, length);
+
+    size_t done = 0;
+    while (done < length)
+    {
+        uint32_t sector = filePosition(position + done, true) / SD_SECTOR_SIZE;
+        uint16_t offset = (position + done) % SD_SECTOR_PAYLOAD;
+        SectorFooter footer;
+        if (readAt(file, (uint8_t *)&footer, sector * SD_SECTOR_SIZE + SD_SECTOR_PAYLOAD, sizeof(footer)) != sizeof(footer) ||
+            footer.length <= offset || footer.length > SD_SECTOR_PAYLOAD)
+            break;
+
+        size_t chunk = footer.length - offset;
+        if (chunk > length - done)
+            chunk = length - done;
+        size_t read = readAt(file, buffer + done, sector * SD_SECTOR_SIZE + offset, chunk);
+        done += read;
+        if (read < chunk || footer.length < SD_SECTOR_PAYLOAD)
+            break;
+    }
+    return done;
+}
+
+/**
+ * @brief Finds where the records start in the data of the session, after the empty line that ends the text header.
+ *
+ * @return The position of the first record, or 0 if the header is incomplete.
+ */
+static uint32_t findDataStart(File &file)
+{
+    size_t length = readData(file, 0, scanBuffer, RECOVERY_WINDOW, sessionRaw);
+    for (size_t i = 1; i < length; i++)
+    {
+        if (scanBuffer[i - 1] == '\n' && scanBuffer[i] == '\n')
+            return i + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Looks for a record of the current session starting in the BLOCK_MAX_SIZE bytes from offset.
+ *
+ * @param found Receives the position of the record.
+ * @return true if a record was found, false otherwise.
+ */
+static boolean findRecord(File &file, uint32_t offset, uint32_t *found)
+{
+    size_t length = readAt(file, scanBuffer, offset, RECOVERY_WINDOW);
+    for (size_t i = 0; i < BLOCK_MAX_SIZE && i < length; i++)
+    {
+        if (scanBuffer[i] == BLOCK_MAGIC && checkRecord(scanBuffer + i, length - i, sessionNumber) > 0)
+        {
+            *found = offset + i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Finds the end of an interrupted session written through the File API and truncates its file there.
+ *
+ * The directory entry holds the preallocated size and the clusters past the written data keep
+ * whatever they contained before, so the end is found from the records themselves: the last one
+ * whose CRC and session number check out. The scan reads O(log n) windows of the file, so the
+ * time it takes does not grow with the length of the session.
+ *
+ * @return true if the file was repaired, false otherwise.
+ */
+static boolean recoverFileSession()
+{
+    File file = SD.open(sessionPath, FILE_READ);
+    if (!file)
+        return false;
+
+    // The end of the records is in [low, high] and a record (if any) starts at low. A window
+    // without a record start means that the end is less than BLOCK_MAX_SIZE bytes after it.
+    uint32_t low = findDataStart(file);
+    uint32_t high = file.size();
+    while (high > low && high - low > 2 * RECOVERY_WINDOW)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        uint32_t found;
+        if (findRecord(file, middle, &found))
+            low = found;
+        else
+            high = middle + BLOCK_MAX_SIZE;
+    }
+
+    // Follow the records from there up to the first one missing or damaged
+    int record;
+    while ((record = checkRecord(scanBuffer, readAt(file, scanBuffer, low, BLOCK_MAX_SIZE), sessionNumber)) > 0)
+        low += record;
+    file.close();
+
+    sessionSize = low;
+    char path[sizeof(SD_MOUNT_POINT) + sizeof(sessionPath)];
+    formatString(formatString(path, SD_MOUNT_POINT), sessionPath);
+    return truncate(path, sessionSize) == 0;
+}
+
+/**
+ * @brief Brings the block index of a repaired session in line with its records.
+ *
+ * The last entries may describe records lost with the power, or be missing: the entries
+ * from the last one starting before the end of the data are dropped and rebuilt by reading
+ * the records back. Only the records written since the last sync are read, unless the
+ * whole index file is missing.
+ */
+static void repairBlockIndex()
+{
+    static int16_t samples[CODEC_BLOCK_SAMPLES];
+
+    File file = SD.open(sessionPath, FILE_READ);
+    if (!file)
+        return;
+
+    setIndexPath();
+    uint32_t kept = 0;
+    uint32_t position = 0;
+    File index = SD.open(indexPath, FILE_READ);
+    if (index)
+    {
+        BlockIndexEntry entry;
+        kept = index.size() / sizeof(entry);
+        while (kept > 0)
+        {
+            kept--;
+            if (readAt(index, (uint8_t *)&entry, kept * sizeof(entry), sizeof(entry)) == sizeof(entry) &&
+                entry.offset < sessionSize)
+            {
+                position = dataPosition(entry.offset, sessionRaw);
+                break;
+            }
+        }
+        index.close();
+
+        char path[sizeof(SD_MOUNT_POINT) + sizeof(indexPath)];
+        formatString(formatString(path, SD_MOUNT_POINT), indexPath);
+        truncate(path, kept * sizeof(entry));
+    }
+    if (position == 0)
+        position = findDataStart(file);
+
+    indexFile = SD.open(indexPath, FILE_APPEND);
+    indexRecords = 0;
+    int length;
+    while (position > 0 &&
+           (length = checkRecord(scanBuffer, readData(file, position, scanBuffer, BLOCK_MAX_SIZE, sessionRaw), sessionNumber)) > 0)
+    {
+        BlockHeader header;
+        BlockSummary summary;
+        memcpy(&header, scanBuffer, sizeof(header));
+        int count = decodeBlock(scanBuffer + sizeof(header), header.length, samples, CODEC_BLOCK_SAMPLES);
+        if (count < 0)
+            break;
+        summarizeBlock(samples, count, &summary);
+        indexRecord(filePosition(position, sessionRaw), &header, &summary);
+        position += length;
+    }
+    flushIndexEntry();
+    indexFile.close();
+    file.close();
+}
+
+/**
+ * @brief Creates the next session file, named after its number and the RTC time.
+ *
+ * @return true if the file was created, false otherwise.
+ */
+static boolean createSessionFile()
+{
+    Ds1302::DateTime now;
+    rtc.getDateTime(&now);
+
+    if (!SD.exists(SESSION_DIR))
+        SD.mkdir(SESSION_DIR);
+
+    // The index has one line per session, so its size gives the next number
+    File index = SD.open(SESSION_INDEX, FILE_READ);
+    sessionNumber = index ? index.size() / SESSION_RECORD_SIZE + 1 : 1;
+    if (index)
+        index.close();
+
+    // /sessions/NNNN_YYMMDD_HHMMSS.ds32
+    char *end = formatString(sessionPath, SESSION_DIR "/");
+    const uint8_t fields[] = {(uint8_t)(sessionNumber / 100 % 100), (uint8_t)(sessionNumber % 100), 0,
+                              now.year, now.month, now.day, 0, now.hour, now.minute, now.second};
+    for (uint8_t i = 0; i < sizeof(fields); i++)
+    {
+        if (i == 2 || i == 6)
+        {
+            *end++ = '_';
+            continue;
+        }
+        *end++ = '0' + fields[i] / 10;
+        *end++ = '0' + fields[i] % 10;
+    }
+    formatString(end, ".ds32");
+    formatNow(sessionStart, &now);
+
+    sessionSize = sessionAllocated = 0;
+    sessionRaw = false;
+#if SD_RAW_SUPPORTED
+    // Fall back to the File API when the card has no contiguous space for the extent
+    sessionRaw = sdRawStreaming && createRawExtent();
+#endif
+    if (!sessionRaw)
+    {
+        sessionFile = SD.open(sessionPath, FILE_WRITE);
+        if (!sessionFile)
+            return false;
+        preallocate();
+    }
+    setIndexPath();
+    indexFile = SD.open(indexPath, FILE_WRITE);
+    indexRecords = 0;
+
+    sessionOpenedAt = millis();
+    sessionActive = true;
+    writeIndexRecord(SESSION_STATE_WRITING, sessionStart);
+
+    // DS32 1 R\n<header>Start: 10/19/2024 12:30:00\n\n, then the sample blocks
+    char line[32];
+    end = formatString(line, "DS32 ");
+    end = formatUInt(end, SESSION_FORMAT_VERSION);
+    *end++ = ' ';
+    *end++ = sessionRaw ? SESSION_MODE_RAW : SESSION_MODE_FILE;
+    *end++ = '\n';
+    sessionWrite((const uint8_t *)line, end - line);
+    sessionWrite((const uint8_t *)sessionHeader, sessionHeaderLength);
+    end = formatString(formatString(line, "Start: "), sessionStart);
+    end = formatString(end, "\n\n");
+    sessionWrite((const uint8_t *)line, end - line);
+    return true;
+}
+
+/**
+ * @brief Closes the session file, releasing the clusters reserved but not written.
+ */
+static void closeSessionFile()
+{
+    sessionActive = false;
+    flushIndexEntry();
+    indexFile.close();
+
+#if SD_RAW_SUPPORTED
+    if (sessionRaw)
+    {
+        char path[sizeof(sessionPath) + 2];
+        FIL fil;
+
+        flushRawSectors(true);
+        fatfsPath(path, sessionPath);
+        if (f_open(&fil, path, FA_WRITE) == FR_OK)
+        {
+            f_lseek(&fil, sessionSize);
+            f_truncate(&fil);
+            f_close(&fil);
+        }
+        writeIndexRecord(SESSION_STATE_CLOSED);
+        return;
+    }
+#endif
+
+    sessionFile.close();
+
+    char path[sizeof(SD_MOUNT_POINT) + sizeof(sessionPath)];
+    formatString(formatString(path, SD_MOUNT_POINT), sessionPath);
+    truncate(path, sessionSize);
+
+    writeIndexRecord(SESSION_STATE_CLOSED);
+}
+
+/**
+ * @brief Starts a new acquisition session.
+ *
+ * The previous sessions are kept; the new one gets the next number and its own file.
+ *
+ * @param header Text lines written at the top of the file (and of every rotated file).
+ * @param headerLength The length of the header.
+ * @return true if the session file was created, false otherwise.
+ */
+boolean openSession(const char *header, size_t headerLength)
+{
+    if (sessionActive)
+        closeSession();
+
+    sessionHeaderLength = headerLength < sizeof(sessionHeader) ? headerLength : sizeof(sessionHeader);
+    memcpy(sessionHeader, header, sessionHeaderLength);
+
+    return createSessionFile();
+}
+
+/**
+ * @brief Appends data to the session file.
+ *
+ * @return The number of bytes written.
+ */
+size_t sessionWrite(const uint8_t *data, size_t length)
+{
+    if (!sessionActive)
+        return 0;
+
+#if SD_RAW_SUPPORTED
+    if (sessionRaw)
+        return rawWrite(data, length);
+#endif
+
+    while (sessionSize + length > sessionAllocated)
+        preallocate();
+
+    size_t written = sessionFile.write(data, length);
+    sessionSize += written;
+    return written;
+}
+
+/**
+ * @brief Appends a record of samples to the session file and adds it to the block index.
+ */
+void sessionWriteRecord(const uint8_t *record, size_t length, const BlockSummary *summary)
+{
+    if (!sessionActive)
+        return;
+
+    uint32_t position = sessionSize;
+#if SD_RAW_SUPPORTED
+    if (sessionRaw)
+        position = (rawBufferSector + rawFull) * SD_SECTOR_SIZE + rawOffset;
+#endif
+
+    BlockHeader header;
+    memcpy(&header, record, sizeof(header));
+    indexRecord(position, &header, summary);
+    sessionWrite(record, length);
+}
+
+/**
+ * @brief Sets when the session file is rotated, from the next sync on.
+ *
+ * @param size     Bytes, at most SESSION_ROTATE_SIZE, for which the raw extent is allocated.
+ * @param duration Milliseconds.
+ */
+void setSessionRotation(uint32_t size, uint32_t duration)
+{
+    rotateSize = size < SESSION_ROTATE_SIZE ? size : SESSION_ROTATE_SIZE;
+    rotateDuration = duration;
+}
+
+/**
+ * @brief Commits the written data to the card and rotates the file when it is full or old enough.
+ *
+ * Meant to be called at record boundaries (once per window), so a record is never split across files.
+ *
+ * @return true if a new file was started.
+ */
+boolean sessionSync()
+{
+    if (!sessionActive)
+        return false;
+
+    if (sessionSize >= rotateSize || millis() - sessionOpenedAt >= rotateDuration)
+    {
+        closeSessionFile();
+        return createSessionFile();
+    }
+
+    indexFile.flush();
+#if SD_RAW_SUPPORTED
+    if (sessionRaw)
+    {
+        flushRawSectors(true);
+        return false;
+    }
+#endif
+
+    sessionFile.flush();
+    return false;
+}
+
+/**
+ * @brief Ends the session, closing its file and completing its line in the index.
+ */
+void closeSession()
+{
+    if (sessionActive)
+        closeSessionFile();
+}
+
+/**
+ * @brief Repairs the last session if the logger was switched off while it was being written.
+ *
+ * Raw sessions are cut after the last sector of the session, File sessions after their last
+ * intact record; a record torn by the power loss at the end of a raw sector is left to the
+ * reader, which drops it on its CRC. The index line is marked as recovered.
+ */
+void recoverSessions()
+{
+    File index = SD.open(SESSION_INDEX, FILE_READ);
+    if (!index || index.size() < SESSION_RECORD_SIZE)
+        return;
+
+    // 0001 R W 0001_241019_123000.ds32 10/19/2024 12:30:00 10/19/2024 12:30:00 0
+    char record[SESSION_RECORD_SIZE];
+    index.seek(index.size() / SESSION_RECORD_SIZE * SESSION_RECORD_SIZE - SESSION_RECORD_SIZE);
+    boolean complete = index.read((uint8_t *)record, SESSION_RECORD_SIZE) == SESSION_RECORD_SIZE;
+    index.close();
+    if (!complete || record[7] != SESSION_STATE_WRITING)
+        return;
+
+    sessionNumber = atoi(record);
+    sessionRaw = record[5] == SESSION_MODE_RAW;
+    char *name = record + 9;
+    char *nameEnd = strchr(name, ' ');
+    if (!nameEnd || nameEnd[2 * (DATESTAMP_SIZE + TIMESTAMP_SIZE)] != ' ')
+        return;
+    *nameEnd = '\0';
+    formatString(formatString(sessionPath, SESSION_DIR "/"), name);
+
+    // Start and end stamps are kept as they are: the time of the power loss is not known
+    char *stamps = nameEnd + 1;
+    char endStamp[DATESTAMP_SIZE + TIMESTAMP_SIZE];
+    memcpy(sessionStart, stamps, sizeof(sessionStart) - 1);
+    sessionStart[sizeof(sessionStart) - 1] = '\0';
+    memcpy(endStamp, stamps + sizeof(sessionStart), sizeof(endStamp) - 1);
+    endStamp[sizeof(endStamp) - 1] = '\0';
+
+    boolean repaired = false;
+#if SD_RAW_SUPPORTED
+    if (sessionRaw)
+        repaired = recoverRawSession();
+#endif
+    if (!sessionRaw)
+        repaired = recoverFileSession();
+
+    if (repaired)
+    {
+        repairBlockIndex();
+        writeIndexRecord(SESSION_STATE_RECOVERED, endStamp);
+    }
+}
+
+boolean isSessionOpen()
+{
+    return sessionActive;
+}
+
+/**
+ * @brief Reads the data of a closed session, leaving out the sector footers if it is raw.
+ *
+ * @param position A position in the data, see getSessionDataPosition().
+ * @return The number of bytes read, fewer than length at the end of the data.
+ */
+size_t readSessionData(File &file, boolean raw, uint32_t position, uint8_t *buffer, size_t length)
+{
+    return readData(file, position, buffer, length, raw);
+}
+
+/**
+ * @brief Converts a position in the file of a session, as found in its block index, to a position in its data.
+ */
+uint32_t getSessionDataPosition(uint32_t position, boolean raw)
+{
+    return dataPosition(position, raw);
+}
+
+/**
+ * @brief Returns the length of the data of a closed session, its size without the sector footers if it is raw.
+ */
+uint32_t getSessionDataSize(File &file, boolean raw)
+{
+    uint32_t size = file.size();
+    if (!raw || size < SD_SECTOR_SIZE)
+        return raw ? 0 : size;
+
+    // Only the last sector can be partly used
+    SectorFooter footer;
+    uint32_t last = size / SD_SECTOR_SIZE - 1;
+    if (readAt(file, (uint8_t *)&footer, last * SD_SECTOR_SIZE + SD_SECTOR_PAYLOAD, sizeof(footer)) != sizeof(footer) ||
+        footer.length > SD_SECTOR_PAYLOAD)
+        return last * SD_SECTOR_PAYLOAD;
+    return last * SD_SECTOR_PAYLOAD + footer.length;
+}
+
+uint16_t getSessionNumber()
+{
+    return sessionNumber;
+}
+
+static File spoolWriter; // Both opened at the first use, and closed when the spool is removed
+static File spoolReader;
+
+/**
+ * @brief Appends a message for the broker to SPOOL_FILE, see MqttSpool.
+ *
+ * @return true if it was all written.
+ */
+bool spoolAppend(const uint8_t *data, size_t length)
+{
+    if (!spoolWriter)
+        spoolWriter = SD.open(SPOOL_FILE, FILE_APPEND);
+    if (!spoolWriter || spoolWriter.write(data, length) != length)
+        return false;
+    spoolWriter.flush(); // So the reader sees it, and a power loss keeps it
+    return true;
+}
+
+/**
+ * @brief Reads the spool from a position.
+ *
+ * @return The number of bytes read, fewer than length at the end of the spool.
+ */
+size_t spoolRead(uint32_t position, uint8_t *data, size_t length)
+{
+    if (spoolReader && position + length > spoolReader.size())
+        spoolReader.close(); // Opened before the last appends, which it does not see
+    if (!spoolReader)
+        spoolReader = SD.open(SPOOL_FILE, FILE_READ);
+    return spoolReader ? readAt(spoolReader, data, position, length) : 0;
+}
+
+uint32_t spoolSize()
+{
+    File file = SD.open(SPOOL_FILE, FILE_READ);
+    uint32_t size = file ? file.size() : 0;
+    file.close();
+    return size;
+}
+
+/**
+ * @brief Removes the spool once it has been replayed.
+ */
+void spoolClear()
+{
+    spoolWriter.close();
+    spoolReader.close();
+    SD.remove(SPOOL_FILE);
+}
+
+#ifdef SD_BENCHMARK
+/**
+ * @brief Measures sustained throughput and worst-case latency of the two SD write paths.
+ *
+ * Writes SD_BENCHMARK_SIZE bytes in 512-byte records through a File and, if available,
+ * through the raw sector stream, syncing once every 8 KB like the logger does once per
+ * window. The benchmark files and their lines in the session index are removed afterwards.
+ * Called from setup() once the card is mounted and the RTC set up.
+ *
+ * @param out Where the report is printed.
+ */
+void sdBenchmark(Print &out)
+{
+    static uint8_t record[SD_SECTOR_SIZE];
+    const char *header = "benchmark\n";
+    memset(record, 'x', sizeof(record));
+
+    // The lines of the benchmark sessions are cut from the index afterwards
+    File index = SD.open(SESSION_INDEX, FILE_READ);
+    uint32_t indexSize = index ? index.size() : 0;
+    if (index)
+        index.close();
+    char path[sizeof(SD_MOUNT_POINT) + sizeof(SESSION_INDEX)];
+    formatString(formatString(path, SD_MOUNT_POINT), SESSION_INDEX);
+
+    for (int raw = 0; raw <= SD_RAW_SUPPORTED; raw++)
+    {
+        sdRawStreaming = raw;
+        if (!openSession(header, strlen(header)))
+        {
+            out.println("Benchmark: cannot open a session");
+            return;
+        }
+
+        unsigned long worst = 0;
+        unsigned long start = micros();
+        for (uint32_t written = 0; written < SD_BENCHMARK_SIZE; written += sizeof(record))
+        {
+            unsigned long before = micros();
+            sessionWrite(record, sizeof(record));
+            if (written % 8192 == 0)
+                sessionSync();
+            unsigned long elapsed = micros() - before;
+            if (elapsed > worst)
+                worst = elapsed;
+        }
+        unsigned long total = micros() - start;
+        closeSession();
+        SD.remove(sessionPath);
+        SD.remove(indexPath);
+        if (indexSize == 0)
+            SD.remove(SESSION_INDEX);
+        else
+            truncate(path, indexSize);
+
+        out.print(raw ? "Raw sectors: " : "File API:    ");
+        out.print(SD_BENCHMARK_SIZE / 1024.0 / (total / 1e6), 1);
+        out.print(" KB/s, worst write ");
+        out.print(worst);
+        out.println(" us");
+    }
+    sdRawStreaming = SD_RAW_SUPPORTED;
+}
+#endif
@@ -4,6 +4,7 @@
 
 #include "../include/controller.h"
 #include "../include/view.h"
+#include "../include/bitmap_rle.h"
 
 #define OLED_RESET -1 // probably, shares the RST with ESP32
 
@@ -11,403 +12,12 @@
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
 
+// SPECTRUM MODE: bars under a line of text, in decibels below the largest amplitude
+#define SPECTRUM_BAR_TOP 10
+#define SPECTRUM_DECIBELS 60.0f // Shown from the top of the bars to the bottom of the screen
+
 // MENU INTERFACE
-//  'Menu_1', 128x64px
-static const unsigned char PROGMEM bitmap_Menu_1[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x08, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x08, 0x0e, 0x3b, 0x1e, 0x10, 0xe0, 0x1c, 0x38, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x08, 0x11, 0x24, 0x91, 0x11, 0x10, 0x22, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x07, 0x01, 0x24, 0x91, 0x11, 0x10, 0x20, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x8f, 0x24, 0x91, 0x11, 0xf0, 0x1c, 0x7c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x91, 0x24, 0x91, 0x11, 0x00, 0x02, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x08, 0x91, 0x20, 0x91, 0x11, 0x10, 0x22, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x0f, 0x20, 0x9e, 0x08, 0xe0, 0x1c, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x0c, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x06, 0x01, 0x80, 0xf0, 0xf8, 0xf8, 0xf1, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x03, 0x01, 0x81, 0x99, 0x99, 0x99, 0x99, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x01, 0x81, 0x81, 0x99, 0x99, 0x99, 0x99, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x00, 0x41, 0x81, 0x99, 0x99, 0x99, 0xf9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x00, 0x41, 0x81, 0x99, 0x99, 0x99, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x01, 0x81, 0x81, 0x98, 0xf8, 0xf9, 0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x03, 0x01, 0xf8, 0xf0, 0x18, 0x18, 0xf1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x06, 0x00, 0x00, 0x01, 0x99, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x0c, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x80, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x91, 0x3c, 0xf1, 0x13, 0xc0, 0xec, 0x38, 0x78, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x91, 0x10, 0x89, 0x11, 0x00, 0x92, 0x44, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x91, 0x10, 0x89, 0x11, 0x00, 0x92, 0x44, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x91, 0x10, 0x89, 0x11, 0x00, 0x92, 0x44, 0x89, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x91, 0x10, 0x89, 0x11, 0x00, 0x92, 0x44, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x91, 0x10, 0x89, 0x11, 0x00, 0x82, 0x44, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x0e, 0x0c, 0xf0, 0xe0, 0xc0, 0x82, 0x38, 0x78, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20};
-// 'Menu_2', 128x64px
-static const unsigned char PROGMEM bitmap_Menu_2[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x0e, 0x1e, 0x3c, 0x71, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x11, 0x22, 0x44, 0x89, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x11, 0x22, 0x44, 0x89, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x11, 0x22, 0x44, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x11, 0x22, 0x44, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x11, 0x1e, 0x3c, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0f, 0x8e, 0x02, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x22, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x1c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xf8,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x70,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x18, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x0c, 0x01, 0x98, 0x00, 0xc0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x06, 0x01, 0x99, 0x99, 0xf3, 0xe3, 0x33, 0xe0, 0x76, 0x1e, 0x1f, 0x1e, 0x00, 0x80, 0x00,
-    0x08, 0x03, 0x01, 0x99, 0x98, 0xc3, 0x33, 0x31, 0x80, 0x6b, 0x33, 0x33, 0x33, 0x00, 0x80, 0x20,
-    0x08, 0x01, 0x81, 0x99, 0x98, 0xc3, 0x33, 0x31, 0x80, 0x6b, 0x33, 0x33, 0x33, 0x00, 0x80, 0x00,
-    0x08, 0x00, 0x41, 0x99, 0x98, 0xc3, 0x33, 0x31, 0x80, 0x6b, 0x33, 0x33, 0x3f, 0x00, 0x80, 0x20,
-    0x08, 0x00, 0x41, 0x99, 0x98, 0xc3, 0x33, 0x31, 0x80, 0x6b, 0x33, 0x33, 0x30, 0x00, 0x80, 0x00,
-    0x08, 0x01, 0x81, 0x99, 0x98, 0xc3, 0x33, 0x31, 0x80, 0x63, 0x33, 0x33, 0x33, 0x00, 0x80, 0x20,
-    0x08, 0x03, 0x00, 0xf0, 0xf0, 0x73, 0xe1, 0xe0, 0xe0, 0x63, 0x1e, 0x1f, 0x1e, 0x00, 0x80, 0x00,
-    0x08, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x00, 0x00, 0x02, 0x01, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0xf1, 0xe2, 0x27, 0x81, 0x8c, 0x70, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x89, 0x12, 0x22, 0x01, 0x54, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x89, 0x12, 0x22, 0x01, 0x24, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x89, 0x12, 0x22, 0x01, 0x04, 0x89, 0x13, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x89, 0x12, 0x22, 0x01, 0x04, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x08, 0x89, 0x12, 0x22, 0x01, 0x04, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x89, 0xe1, 0xc1, 0x81, 0x04, 0x70, 0xf1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20};
-// 'Menu_3', 128x64px
-static const unsigned char PROGMEM bitmap_Menu_3[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x44, 0xf3, 0xc4, 0x4f, 0x03, 0xb0, 0xe1, 0xe3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x44, 0x42, 0x24, 0x44, 0x02, 0x49, 0x12, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x44, 0x42, 0x24, 0x44, 0x02, 0x49, 0x12, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x44, 0x42, 0x24, 0x44, 0x02, 0x49, 0x12, 0x27, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x44, 0x42, 0x24, 0x44, 0x02, 0x49, 0x12, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x44, 0x42, 0x24, 0x44, 0x02, 0x09, 0x12, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x1c, 0x38, 0x33, 0xc3, 0x83, 0x02, 0x08, 0xe1, 0xe3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70,
-    0x08, 0x18, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x0c, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0xc6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x06, 0x00, 0xc7, 0xc7, 0xc6, 0x67, 0xc0, 0xee, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x03, 0x00, 0xc6, 0x66, 0x66, 0x63, 0x00, 0xfe, 0x66, 0x66, 0x66, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x01, 0x80, 0xc6, 0x66, 0x66, 0x63, 0x00, 0xd6, 0x66, 0x66, 0x66, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x00, 0x40, 0xc6, 0x66, 0x66, 0x63, 0x00, 0xc6, 0x66, 0x66, 0x7e, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x00, 0x40, 0xc6, 0x66, 0x66, 0x63, 0x00, 0xc6, 0x66, 0x66, 0x60, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x01, 0x80, 0xc6, 0x66, 0x66, 0x63, 0x00, 0xc6, 0x66, 0x66, 0x66, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x03, 0x00, 0xc6, 0x67, 0xc3, 0xc1, 0xc0, 0xc6, 0x3c, 0x3e, 0x3c, 0x00, 0x00, 0x80, 0xf8,
-    0x08, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x70,
-    0x08, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x01, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x23, 0xc2, 0x0e, 0x01, 0xe3, 0x88, 0x88, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x27, 0x91, 0x02, 0x24, 0x48, 0x88, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x48, 0x88, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x22, 0x11, 0x02, 0x27, 0xc8, 0x88, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x08, 0x88, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x45, 0x08, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x22, 0x0e, 0x01, 0xe3, 0x82, 0x08, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20};
-// 'Menu_4', 128x64px
-static const unsigned char PROGMEM bitmap_Menu_4[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x00, 0x00, 0x08, 0x04, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x23, 0xc7, 0x88, 0x9e, 0x06, 0x31, 0xc3, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x24, 0x48, 0x88, 0x05, 0x52, 0x24, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x24, 0x48, 0x88, 0x04, 0x92, 0x24, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x24, 0x48, 0x88, 0x04, 0x12, 0x24, 0x4f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x24, 0x48, 0x88, 0x04, 0x12, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x24, 0x48, 0x88, 0x04, 0x12, 0x24, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x27, 0x87, 0x06, 0x04, 0x11, 0xc3, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x0c, 0x01, 0x80, 0x03, 0x80, 0x00, 0x18, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x06, 0x01, 0x80, 0x06, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x03, 0x01, 0x8f, 0x86, 0x0f, 0x00, 0xf8, 0xf1, 0x98, 0xc3, 0xc3, 0xc0, 0x00, 0x80, 0x20,
-    0x08, 0x01, 0x81, 0x8c, 0xcf, 0x99, 0x81, 0x99, 0x99, 0x98, 0xc6, 0x66, 0x60, 0x00, 0x80, 0x00,
-    0x08, 0x00, 0x41, 0x8c, 0xc6, 0x19, 0x81, 0x99, 0x99, 0x98, 0xc6, 0x06, 0x60, 0x00, 0x80, 0x20,
-    0x08, 0x00, 0x41, 0x8c, 0xc6, 0x19, 0x81, 0x99, 0xf9, 0x98, 0xc6, 0x07, 0xe0, 0x00, 0x80, 0x00,
-    0x08, 0x01, 0x81, 0x8c, 0xc6, 0x19, 0x81, 0x99, 0x81, 0x98, 0xc6, 0x06, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x03, 0x01, 0x8c, 0xc6, 0x19, 0x81, 0x99, 0x98, 0xf0, 0xc6, 0x66, 0x60, 0x00, 0x80, 0x00,
-    0x08, 0x06, 0x01, 0x8c, 0xc6, 0x0f, 0x00, 0xf8, 0xf0, 0x60, 0xc3, 0xc3, 0xc0, 0x00, 0x80, 0x20,
-    0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf8,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x1c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x22, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x38, 0xec, 0x78, 0x43, 0x80, 0x70, 0xe3, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x44, 0x92, 0x44, 0x44, 0x40, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1c, 0x04, 0x92, 0x44, 0x44, 0x40, 0x81, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x02, 0x3c, 0x92, 0x44, 0x47, 0xc0, 0x71, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x44, 0x92, 0x44, 0x44, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x44, 0x82, 0x44, 0x44, 0x40, 0x89, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1c, 0x3c, 0x82, 0x78, 0x23, 0x80, 0x70, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20};
-// 'Menu_5', 128x64px
-static const unsigned char PROGMEM bitmap_Menu_5[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x01, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x23, 0xc2, 0x0e, 0x01, 0xe3, 0x88, 0x88, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x27, 0x91, 0x02, 0x24, 0x48, 0x88, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x48, 0x88, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x22, 0x11, 0x02, 0x27, 0xc8, 0x88, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x08, 0x88, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x22, 0x11, 0x02, 0x24, 0x45, 0x08, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x22, 0x22, 0x0e, 0x01, 0xe3, 0x82, 0x08, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x18, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x0c, 0x01, 0x98, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x06, 0x01, 0x80, 0xf1, 0xd8, 0xf8, 0x61, 0xe0, 0x1e, 0x1e, 0x3e, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x03, 0x01, 0x81, 0x99, 0xac, 0xcc, 0x63, 0x30, 0x33, 0x33, 0x18, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x01, 0x80, 0xf0, 0x19, 0xac, 0xcc, 0x63, 0x30, 0x30, 0x33, 0x18, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x00, 0x40, 0x18, 0xf9, 0xac, 0xcc, 0x63, 0xf0, 0x1e, 0x3f, 0x18, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x00, 0x40, 0x19, 0x99, 0xac, 0xcc, 0x63, 0x00, 0x03, 0x30, 0x18, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x01, 0x81, 0x99, 0x99, 0x8c, 0xcc, 0x63, 0x30, 0x33, 0x33, 0x18, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x03, 0x00, 0xf0, 0xf9, 0x8c, 0xf8, 0x31, 0xe0, 0x1e, 0x1e, 0x0e, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20,
-    0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x0c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x38, 0x78, 0xf1, 0xc4, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x20, 0x44, 0x89, 0x12, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x44, 0x89, 0x12, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x20, 0x44, 0x89, 0x13, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x20, 0x44, 0x89, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x20, 0x44, 0x78, 0xf2, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x3e, 0x38, 0x08, 0x11, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x89, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x70, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70};
-// 'Output_mode', 128x64px
-const unsigned char PROGMEM bitmap_Output_mode[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x54, 0x04, 0x48, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x04, 0x08, 0x80, 0x70, 0xe2, 0x63, 0xc0, 0xec, 0x38, 0x78, 0xe0, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x04, 0x08, 0x80, 0x89, 0x12, 0x84, 0x40, 0x92, 0x44, 0x89, 0x10, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x03, 0x88, 0x80, 0x80, 0x13, 0x04, 0x40, 0x92, 0x44, 0x89, 0x10, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x00, 0x48, 0x80, 0x80, 0xf2, 0x04, 0x40, 0x92, 0x44, 0x89, 0xf0, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x00, 0x48, 0x80, 0x81, 0x12, 0x04, 0x40, 0x92, 0x44, 0x89, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x04, 0x48, 0x80, 0x89, 0x12, 0x04, 0x40, 0x82, 0x44, 0x89, 0x10, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x03, 0x8f, 0x00, 0x70, 0xf2, 0x03, 0xc0, 0x82, 0x38, 0x78, 0xe0, 0x00, 0x00,
-    0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0xfc, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3f, 0xfc, 0x07, 0x84, 0x00, 0x00, 0x80, 0x00, 0x01, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x04, 0x40, 0x00, 0x00, 0x80, 0x00, 0x02, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2e, 0x04, 0x04, 0x44, 0x38, 0xf0, 0x87, 0x11, 0x02, 0x27, 0x84, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x2c, 0x04, 0x04, 0x44, 0x44, 0x88, 0x88, 0x91, 0x02, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x04, 0x04, 0x44, 0x40, 0x88, 0x80, 0x91, 0x02, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x04, 0x04, 0x44, 0x38, 0x88, 0x87, 0x91, 0x02, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x04, 0x44, 0x04, 0x88, 0x88, 0x91, 0x02, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x04, 0x44, 0x44, 0x88, 0x88, 0x8f, 0x02, 0x24, 0x44, 0x3c, 0x00, 0x00, 0x00,
-    0x00, 0x3f, 0xfc, 0x07, 0x84, 0x38, 0xf0, 0x47, 0x81, 0x01, 0xc4, 0x42, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x11, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0a, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0a, 0x50, 0x03, 0x80, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x10, 0x04, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x10, 0x04, 0x07, 0x13, 0x10, 0xe1, 0x01, 0xd8, 0x70, 0xf1, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x1f, 0xf8, 0x04, 0x08, 0x94, 0x11, 0x11, 0x01, 0x24, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x08, 0x03, 0x88, 0x98, 0x10, 0x11, 0x01, 0x24, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x08, 0x00, 0x4f, 0x90, 0x10, 0xf1, 0x01, 0x24, 0x89, 0x13, 0xe0, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x08, 0x00, 0x48, 0x10, 0x11, 0x11, 0x01, 0x24, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x08, 0x04, 0x48, 0x90, 0x11, 0x11, 0x01, 0x04, 0x89, 0x12, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x10, 0x03, 0x87, 0x10, 0x10, 0xf0, 0x81, 0x04, 0x70, 0xf1, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+// Full-screen 128x64 bitmaps are stored compressed in bitmap_assets.cpp (see tools/bitmap_rle.py)
 // 'cursor', 122x20px
 const unsigned char PROGMEM bitmap_cursor[] = {
     0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
@@ -430,72 +40,6 @@ const unsigned char PROGMEM bitmap_cursor[] = {
     0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
     0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
     0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00};
-// 'Input_mode', 128x64px
-const unsigned char PROGMEM bitmap_Input_mode[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x07, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x1c, 0x00,
-    0x00, 0x23, 0xc4, 0x04, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90, 0x22, 0x00,
-    0x00, 0x24, 0x24, 0x04, 0x47, 0x0e, 0x10, 0xe3, 0xc7, 0x1e, 0x1c, 0x38, 0x08, 0x1e, 0x02, 0x00,
-    0x00, 0x28, 0x14, 0x04, 0x48, 0x91, 0x11, 0x11, 0x08, 0x91, 0x22, 0x44, 0x08, 0x11, 0x02, 0x00,
-    0x00, 0x28, 0x14, 0x07, 0x88, 0x90, 0x11, 0x01, 0x00, 0x91, 0x20, 0x44, 0x08, 0x11, 0x0c, 0x00,
-    0x00, 0x28, 0x14, 0x05, 0x0f, 0x8e, 0x10, 0xe1, 0x07, 0x91, 0x20, 0x7c, 0x08, 0x11, 0x02, 0x00,
-    0x00, 0x24, 0x24, 0x04, 0x88, 0x01, 0x10, 0x11, 0x08, 0x91, 0x20, 0x40, 0x08, 0x11, 0x02, 0x00,
-    0x00, 0x22, 0x44, 0x04, 0x48, 0x91, 0x11, 0x11, 0x08, 0x91, 0x22, 0x44, 0x08, 0x91, 0x22, 0x00,
-    0x00, 0x2e, 0x74, 0x04, 0x47, 0x0e, 0x10, 0xe0, 0xc7, 0x91, 0x1c, 0x38, 0x07, 0x11, 0x1c, 0x00,
-    0x00, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x04, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x04, 0x40, 0x08, 0x40, 0x00, 0x00, 0x01, 0x12, 0x04, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x47, 0x08, 0xf1, 0xc3, 0xc7, 0x01, 0x03, 0xc4, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x48, 0x88, 0x42, 0x24, 0x48, 0x81, 0x02, 0x24, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x48, 0x88, 0x40, 0x24, 0x48, 0x81, 0x02, 0x25, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x48, 0x88, 0x41, 0xe4, 0x4f, 0x81, 0x02, 0x26, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x48, 0x88, 0x42, 0x24, 0x48, 0x01, 0x02, 0x24, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x02, 0x88, 0x88, 0x42, 0x23, 0xc8, 0x81, 0x12, 0x24, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x01, 0x07, 0x04, 0x31, 0xe0, 0x47, 0x00, 0xe2, 0x23, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x23, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x21, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x04, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0xe0, 0x00, 0x00, 0x00,
-    0x00, 0x23, 0xc4, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x81, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x08, 0x93, 0x26, 0x38, 0xf1, 0xe0, 0x40, 0xf0, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x08, 0x94, 0x28, 0x44, 0x88, 0x80, 0x40, 0x88, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x08, 0x98, 0x30, 0x44, 0x88, 0x80, 0x40, 0x88, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x08, 0x90, 0x20, 0x7c, 0x88, 0x80, 0x40, 0x88, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x27, 0xe4, 0x04, 0x08, 0x90, 0x20, 0x40, 0x88, 0x80, 0x40, 0x89, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x04, 0x48, 0x90, 0x20, 0x44, 0x88, 0x80, 0x44, 0x89, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x03, 0x87, 0x10, 0x20, 0x38, 0x88, 0x60, 0x38, 0x89, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x26, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 // 'down_sample', 32x17px
 const unsigned char bitmap_down_sample[] PROGMEM = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0xef,
@@ -510,336 +54,6 @@ const unsigned char bitmap_up_sample[] PROGMEM = {
     0xff, 0x3f, 0xfc, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf9, 0xff, 0xff, 0x9f,
     0xf3, 0xff, 0xff, 0xcf, 0xf7, 0xff, 0xff, 0xef, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff};
-// 'sample_rate_set', 128x64px
-const unsigned char bitmap_sample_rate_set[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x80, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xc0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0xe0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3f, 0xf0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7f, 0xf8, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xff, 0xfc, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xff, 0xfe, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0xff, 0xff, 0x80, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0xff, 0xff, 0xc0, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0xff, 0xff, 0xc0, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0xff, 0xff, 0x80, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xff, 0xff, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xff, 0xfe, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xff, 0xfc, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7f, 0xf8, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3f, 0xf0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0xe0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0xc0, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x80, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x88, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x80, 0xe3, 0xb1, 0xe1, 0x0e, 0x03, 0xc3, 0x89, 0x80, 0xe1, 0xc3, 0x87, 0x1e, 0x1e, 0x00,
-    0x00, 0x81, 0x12, 0x49, 0x11, 0x11, 0x02, 0x24, 0x4a, 0x01, 0x12, 0x24, 0x48, 0x91, 0x22, 0x00,
-    0x00, 0x70, 0x12, 0x49, 0x11, 0x11, 0x02, 0x24, 0x4c, 0x01, 0x02, 0x24, 0x08, 0x91, 0x22, 0x00,
-    0x00, 0x08, 0xf2, 0x49, 0x11, 0x1f, 0x02, 0x27, 0xc8, 0x00, 0xe3, 0xe4, 0x08, 0x91, 0x22, 0x00,
-    0x00, 0x09, 0x12, 0x49, 0x11, 0x10, 0x02, 0x24, 0x08, 0x00, 0x12, 0x04, 0x08, 0x91, 0x22, 0x00,
-    0x00, 0x89, 0x12, 0x09, 0x11, 0x11, 0x02, 0x24, 0x48, 0x01, 0x12, 0x24, 0x48, 0x91, 0x22, 0x00,
-    0x00, 0x70, 0xf2, 0x09, 0xe0, 0x8e, 0x03, 0xc3, 0x88, 0x00, 0xe1, 0xc3, 0x87, 0x11, 0x1e, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// 'logger', 128x64px
-const unsigned char bitmap_logger[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x12, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x22, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x22, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x08, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// 'error_sdcard', 128x64px
-const unsigned char bitmap_error_sdcard[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x07, 0xff, 0x3f, 0xc0, 0xff, 0x00, 0xf8, 0x3f, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x07, 0xff, 0x3f, 0xc0, 0xff, 0x00, 0xf8, 0x3f, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x07, 0xff, 0x3f, 0xc0, 0xff, 0x00, 0xf8, 0x3f, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x07, 0xff, 0x3f, 0xc0, 0xff, 0x00, 0xf8, 0x3f, 0xc0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x07, 0x00, 0x38, 0x38, 0xc0, 0xc7, 0x07, 0x38, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x07, 0x00, 0x38, 0x38, 0xc0, 0xc7, 0x07, 0x38, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x07, 0x00, 0x38, 0x38, 0xc0, 0xc7, 0x07, 0x38, 0x38, 0x0e, 0x00, 0x0f, 0xff, 0xc0, 0x0c,
-    0x0c, 0x07, 0x00, 0x38, 0x38, 0xc0, 0xc7, 0x07, 0x38, 0x38, 0x0e, 0x00, 0x1a, 0x49, 0x60, 0x0c,
-    0x30, 0x07, 0xf8, 0x3f, 0xc0, 0xff, 0x07, 0x07, 0x3f, 0xc0, 0x0e, 0x00, 0x32, 0x49, 0x60, 0x30,
-    0x30, 0x07, 0xf8, 0x3f, 0xc0, 0xff, 0x07, 0x07, 0x3f, 0xc0, 0x0e, 0x00, 0x62, 0x49, 0x60, 0x30,
-    0x0c, 0x07, 0xf8, 0x3f, 0xc0, 0xff, 0x07, 0x07, 0x3f, 0xc0, 0x0e, 0x00, 0xc2, 0x49, 0x60, 0x0c,
-    0x0c, 0x07, 0x00, 0x38, 0xc0, 0xc7, 0x07, 0x07, 0x38, 0xc0, 0x0e, 0x00, 0x82, 0x49, 0x60, 0x0c,
-    0x30, 0x07, 0x00, 0x38, 0xc0, 0xc7, 0x07, 0x07, 0x38, 0xc0, 0x0e, 0x00, 0x80, 0x00, 0x60, 0x30,
-    0x30, 0x07, 0x00, 0x38, 0xc0, 0xc7, 0x07, 0x07, 0x38, 0xc0, 0x0e, 0x00, 0x80, 0x00, 0x60, 0x30,
-    0x0c, 0x07, 0x00, 0x38, 0xc0, 0xc7, 0x07, 0x07, 0x38, 0xc0, 0x00, 0x00, 0x80, 0xf8, 0x60, 0x0c,
-    0x0c, 0x07, 0xff, 0x38, 0x38, 0xc0, 0xc0, 0xf8, 0x38, 0x38, 0x00, 0x00, 0x81, 0x8c, 0x60, 0x0c,
-    0x30, 0x07, 0xff, 0x38, 0x38, 0xc0, 0xc0, 0xf8, 0x38, 0x38, 0x0e, 0x00, 0x83, 0x04, 0x60, 0x30,
-    0x30, 0x07, 0xff, 0x38, 0x38, 0xc0, 0xc0, 0xf8, 0x38, 0x38, 0x0e, 0x00, 0x83, 0x04, 0x60, 0x30,
-    0x0c, 0x07, 0xff, 0x38, 0x38, 0xc0, 0xc0, 0xf8, 0x38, 0x38, 0x0e, 0x00, 0x82, 0x04, 0x60, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0c, 0x60, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18, 0x60, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x60, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x60, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x60, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x60, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x60, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x60, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x60, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x60, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x03, 0xb8, 0x31, 0x9c, 0xe1, 0x26, 0x7c, 0x79, 0x92, 0x97, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x04, 0x24, 0x4a, 0x52, 0x91, 0xa9, 0x10, 0x42, 0x52, 0xd4, 0x80, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x03, 0x24, 0x43, 0xdc, 0x91, 0x69, 0x10, 0x72, 0x52, 0xb4, 0x80, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0xa4, 0x4a, 0x54, 0x91, 0x29, 0x10, 0x42, 0x52, 0x94, 0x80, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x07, 0x38, 0x32, 0x52, 0xe1, 0x26, 0x10, 0x41, 0x8c, 0x97, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// 'error_wifi', 128x64px
-const unsigned char bitmap_error_serial[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x0f, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x08, 0x08, 0x8f, 0x0e, 0x09, 0x87, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x0e, 0x05, 0x08, 0x82, 0x0a, 0x08, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x08, 0x02, 0x08, 0x82, 0x0c, 0x0f, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x08, 0x05, 0x0f, 0x02, 0x08, 0x08, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x0f, 0x88, 0x88, 0x0f, 0x88, 0x07, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x07, 0x8e, 0x1d, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x30,
-    0x0c, 0x02, 0x02, 0x12, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x0c,
-    0x0c, 0x02, 0x02, 0x12, 0x4f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x03, 0xff, 0xcc, 0x00, 0x0c,
-    0x30, 0x02, 0x02, 0x10, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x4a, 0x00, 0x30,
-    0x30, 0x01, 0x8f, 0x90, 0x47, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x4a, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x05, 0x4a, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x42, 0x4a, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x80, 0x02, 0x02, 0xc5, 0x4a, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x02, 0x80, 0x4a, 0x00, 0x30,
-    0x0c, 0x0f, 0x07, 0x00, 0x08, 0x87, 0x02, 0x0e, 0x07, 0x80, 0x02, 0x12, 0x80, 0x4a, 0x00, 0x0c,
-    0x0c, 0x08, 0x88, 0x80, 0x08, 0x80, 0x82, 0x02, 0x08, 0x80, 0x12, 0x02, 0x80, 0x4a, 0x00, 0x0c,
-    0x30, 0x08, 0x88, 0x80, 0x08, 0x87, 0x82, 0x02, 0x08, 0x80, 0x10, 0x02, 0xc5, 0x4a, 0x00, 0x30,
-    0x30, 0x08, 0x88, 0x80, 0x05, 0x08, 0x82, 0x02, 0x08, 0x80, 0x1f, 0x12, 0x42, 0x4a, 0x00, 0x30,
-    0x0c, 0x08, 0x87, 0x00, 0x02, 0x07, 0x8f, 0x8f, 0x87, 0x80, 0x00, 0x82, 0x05, 0x4a, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x4a, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x4a, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xff, 0xca, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x0c,
-    0x0c, 0x09, 0x87, 0x07, 0x0f, 0x07, 0x0f, 0x07, 0x07, 0x00, 0x03, 0xff, 0xff, 0xfa, 0x00, 0x0c,
-    0x30, 0x0a, 0x08, 0x88, 0x08, 0x88, 0x88, 0x88, 0x08, 0x80, 0x01, 0x00, 0x00, 0x06, 0x00, 0x30,
-    0x30, 0x0c, 0x0f, 0x87, 0x08, 0x88, 0x88, 0x87, 0x0f, 0x80, 0x00, 0x80, 0x00, 0x02, 0x00, 0x30,
-    0x0c, 0x08, 0x08, 0x00, 0x8f, 0x08, 0x88, 0x80, 0x88, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x00, 0x0c,
-    0x0c, 0x08, 0x07, 0x0f, 0x08, 0x07, 0x08, 0x8f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x09, 0x87, 0x07, 0x07, 0x0e, 0x08, 0x87, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x0a, 0x08, 0x88, 0x88, 0x82, 0x08, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x0c, 0x0f, 0x88, 0x0f, 0x82, 0x08, 0x8f, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x08, 0x08, 0x08, 0x88, 0x02, 0x05, 0x08, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x08, 0x07, 0x07, 0x07, 0x0f, 0x82, 0x07, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-// '10_1', 20x15px
-const unsigned char bitmap_waiting_serial[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x02, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x07, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x0b, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x0a, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x0a, 0xe0, 0xea, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x0a, 0x40, 0x4a, 0x40, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x0a, 0x00, 0x0a, 0x40, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x0a, 0x00, 0x0a, 0x43, 0xfc, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0c,
-    0x0c, 0x0a, 0x00, 0x0a, 0x4f, 0xc0, 0x07, 0x80, 0x00, 0x20, 0x00, 0x00, 0x41, 0xfc, 0x00, 0x0c,
-    0x30, 0x0a, 0x00, 0x0a, 0xfc, 0x00, 0x01, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x81, 0x04, 0x00, 0x30,
-    0x30, 0x0a, 0x31, 0x8a, 0xe0, 0x00, 0x00, 0x76, 0x02, 0x02, 0x03, 0x80, 0x81, 0x34, 0x00, 0x30,
-    0x0c, 0x0a, 0x1f, 0x0a, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xef, 0x81, 0x04, 0x00, 0x0c,
-    0x0c, 0x0a, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3f, 0x81, 0x04, 0x00, 0x0c,
-    0x30, 0x0b, 0xff, 0xfa, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x81, 0x34, 0x00, 0x30,
-    0x30, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x04, 0x00, 0x30,
-    0x0c, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xfc, 0x00, 0x0c,
-    0x0c, 0x08, 0x24, 0x82, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x0c,
-    0x30, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x08, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x08, 0x40, 0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x08, 0x80, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x0e, 0xbe, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x45, 0x92, 0x40, 0x02, 0x20, 0x0c, 0x11, 0x02, 0x64, 0x00, 0x00, 0x30, 0x24, 0x00, 0x30,
-    0x30, 0x56, 0x47, 0x1c, 0xc7, 0x52, 0x12, 0x22, 0x90, 0x94, 0x33, 0x77, 0x4b, 0x70, 0xdc, 0x30,
-    0x0c, 0x55, 0xd2, 0x53, 0x22, 0x54, 0x0e, 0x33, 0xa2, 0x74, 0x44, 0xcc, 0xf4, 0x25, 0x32, 0x0c,
-    0x0c, 0x56, 0x52, 0x52, 0xe2, 0x54, 0x12, 0x0c, 0x22, 0x94, 0x44, 0xcc, 0xc4, 0x25, 0x32, 0x0c,
-    0x30, 0x29, 0x93, 0x52, 0x22, 0x24, 0x0c, 0x33, 0x22, 0x64, 0x33, 0x4c, 0xb3, 0x34, 0xd2, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 const unsigned char bitmap_inf[] PROGMEM = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -1090,6 +304,18 @@ boolean initializeScreen()
   return true;
 }
 
+/**
+ * @brief Draws a full-screen compressed asset.
+ *
+ * The asset is decompressed straight into the display framebuffer, replacing its content.
+ *
+ * @param asset The RLE asset to draw, generated by tools/bitmap_rle.py.
+ */
+void drawScreenAsset(const unsigned char *asset)
+{
+  rleDecode(asset, display.getBuffer(), RLE_FRAME_SIZE);
+}
+
 /**
  * @brief Updates the context cursor position on the display.
  *
@@ -1130,23 +356,23 @@ int updateMenu(int menu)
     updateMenu(menu);
     break;
   case 1:
-    display.drawBitmap(0, 0, bitmap_Menu_1, 128, 64, WHITE);
+    drawScreenAsset(rle_Menu_1);
     display.display();
     break;
   case 2:
-    display.drawBitmap(0, 0, bitmap_Menu_2, 128, 64, WHITE);
+    drawScreenAsset(rle_Menu_2);
     display.display();
     break;
   case 3:
-    display.drawBitmap(0, 0, bitmap_Menu_3, 128, 64, WHITE);
+    drawScreenAsset(rle_Menu_3);
     display.display();
     break;
   case 4:
-    display.drawBitmap(0, 0, bitmap_Menu_4, 128, 64, WHITE);
+    drawScreenAsset(rle_Menu_4);
     display.display();
     break;
   case 5:
-    display.drawBitmap(0, 0, bitmap_Menu_5, 128, 64, WHITE);
+    drawScreenAsset(rle_Menu_5);
     display.display();
     break;
   case 6:
@@ -1167,9 +393,9 @@ void errorMessageGraphic(int currentMode)
 {
   display.clearDisplay();
   if (currentMode == 1)
-    display.drawBitmap(0, 0, bitmap_error_serial, 128, 64, WHITE);
+    drawScreenAsset(rle_error_serial);
   else
-    display.drawBitmap(0, 0, bitmap_error_sdcard, 128, 64, WHITE);
+    drawScreenAsset(rle_error_sdcard);
   display.display();
 }
 
@@ -1179,7 +405,7 @@ void errorMessageGraphic(int currentMode)
 void waitSerialGraphic()
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_waiting_serial, 128, 64, WHITE);
+  drawScreenAsset(rle_waiting_serial);
   display.display();
 }
 
@@ -1191,10 +417,10 @@ void waitSerialGraphic()
  * @param channel The channel of the logger.
  */
 
-void loggerGraphic(String currentTime, float measure)
+void loggerGraphic(const char *currentTime, float measure)
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_logger, 128, 64, WHITE);
+  drawScreenAsset(rle_logger);
 
   if (abs(measure) < 0.005)
     measure = abs(measure);
@@ -1243,6 +469,9 @@ void printBitmapIcon(){
 }
 
 void printMeasureValue(float measure){
+  char value[FORMAT_NUMBER_SIZE];
+  char prefix;
+
   switch (currentChannel)
     {
     case VOLTAGE:
@@ -1253,7 +482,8 @@ void printMeasureValue(float measure){
       display.setTextSize(3);
       display.setTextColor(WHITE);
       display.setCursor(30, 20);
-      display.println(measure);
+      formatFixed(value, measure, 2);
+      display.println(value);
       break;
     case CURRENT:
       display.setTextSize(1);
@@ -1263,7 +493,8 @@ void printMeasureValue(float measure){
       display.setTextSize(3);
       display.setTextColor(WHITE);
       display.setCursor(30, 20);
-      display.println(measure);
+      formatFixed(value, measure, 2);
+      display.println(value);
       break;
     case RESISTANCE:
       display.setTextSize(1);
@@ -1279,19 +510,14 @@ void printMeasureValue(float measure){
       {
         display.drawBitmap(17, 0, bitmap_inf, 110, 47, WHITE);
       }
-      else if (abs(measure) >= 1000000)
+      else if (abs(measure) > 20)
       {
-        display.println(measure / 1000000);
-        display.drawBitmap(105, 26, bitmap_10_6, 20, 15, WHITE);
-      }
-      else if (abs(measure) >= 1000)
-      {
-        display.println(measure / 1000);
-        display.drawBitmap(105, 26, bitmap_10_3, 20, 15, WHITE);
-      }
-      else if (abs(measure) < 1000 && abs(measure) > 20)
-      {
-        display.println(measure);
+        formatEngineering(value, measure, 2, &prefix);
+        display.println(value);
+        if (prefix == 'M')
+          display.drawBitmap(105, 26, bitmap_10_6, 20, 15, WHITE);
+        else if (prefix == 'k')
+          display.drawBitmap(105, 26, bitmap_10_3, 20, 15, WHITE);
       }
       else
       {
@@ -1313,7 +539,7 @@ void printMeasureValue(float measure){
 void outputModeGraphic(int channel)
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_Output_mode, 128, 64, WHITE);
+  drawScreenAsset(rle_Output_mode);
   updateContextCursor(channel);
   display.display();
 }
@@ -1326,7 +552,7 @@ void outputModeGraphic(int channel)
 void inputModeGraphic(int mode)
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_Input_mode, 128, 64, WHITE);
+  drawScreenAsset(rle_Input_mode);
   updateContextCursor(mode);
   display.display();
 }
@@ -1338,12 +564,12 @@ void inputModeGraphic(int mode)
  * @param sdState The state of the SD card component.
  * @param RTCState The state of the RTC (Real-Time Clock) component.
  */
-void infoGraphic(String TimeStamp, String DateStamp)
+void infoGraphic(const char *TimeStamp, const char *DateStamp)
 {
   // String wifiStateString = "connected";
   // String SDCardStateString = "detected";
   // String RTCStateString = "initializide";
-  String versionFirmware = "-v2.4.3";
+  const char *versionFirmware = "-v2.4.3";
 
   display.clearDisplay();
   display.setTextSize(1);
@@ -1373,7 +599,7 @@ void infoGraphic(String TimeStamp, String DateStamp)
 void sampleSetGraphic(int sample)
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_sample_rate_set, 128, 64, WHITE);
+  drawScreenAsset(rle_sample_rate_set);
   display.setTextColor(WHITE);
   display.setTextSize(3);
   display.setCursor(22, 16);
@@ -1389,7 +615,7 @@ void sampleSetGraphic(int sample)
 void sampleSetSelectorGraphic(boolean arrowup)
 {
   display.clearDisplay();
-  display.drawBitmap(0, 0, bitmap_sample_rate_set, 128, 64, WHITE);
+  drawScreenAsset(rle_sample_rate_set);
   if (arrowup == 0)
   {
     display.drawBitmap(87, 28, bitmap_down_sample, 32, 17, WHITE);
@@ -1400,3 +626,98 @@ void sampleSetSelectorGraphic(boolean arrowup)
   }
   display.display();
 }
+
+/**
+ * @brief Shows the progress of the guided calibration.
+ *
+ * @param points The reference points measured so far.
+ * @param measuring Whether the windows of the next point are being averaged.
+ * @param window The windows of that point averaged so far, out of windows.
+ */
+void calibrationGraphic(const char *channel, int points, boolean measuring, int window, int windows)
+{
+  display.clearDisplay();
+  display.setTextColor(WHITE);
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print("Calibration ");
+  display.println(channel);
+  display.setCursor(0, 16);
+  display.print("Points: ");
+  display.println(points);
+  display.setCursor(0, 32);
+  if (measuring)
+  {
+    display.print("Measuring ");
+    display.print(window);
+    display.print("/");
+    display.println(windows);
+  }
+  else
+    display.println("Apply the next input");
+  display.setCursor(0, 48);
+  display.println("SELECT to leave");
+  display.display();
+}
+
+/**
+ * @brief Draws the last spectrum: its largest peak, then its amplitudes above the mean as bars,
+ * each column showing the largest of its bins.
+ *
+ * @param amplitudes The bins of the spectrum, or NULL while the first block is being read.
+ * @param peaks The peaks of the spectrum, by decreasing amplitude (spectrum.h).
+ */
+void spectrumGraphic(const char *channel, const float *amplitudes, uint16_t bins, const SpectrumPeak *peaks)
+{
+  display.clearDisplay();
+  display.setTextColor(WHITE);
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  if (!amplitudes)
+  {
+    display.print("Spectrum ");
+    display.println(channel);
+    display.setCursor(0, 32);
+    display.println("Reading a block");
+    display.setCursor(0, 48);
+    display.println("SELECT to leave");
+    display.display();
+    return;
+  }
+
+  if (peaks[0].amplitude > 0)
+  {
+    display.print(peaks[0].frequency, 1);
+    display.print(" Hz ");
+    display.print(peaks[0].amplitude, 0);
+    display.print(" cnt");
+  }
+
+  uint16_t columns = bins - 1 < SCREEN_WIDTH ? bins - 1 : SCREEN_WIDTH;
+  float largest = 0;
+  for (uint16_t k = 1; k < bins; k++)
+  {
+    if (amplitudes[k] > largest)
+      largest = amplitudes[k];
+  }
+  for (uint16_t column = 0; largest > 0 && column < columns; column++)
+  {
+    float amplitude = 0;
+    uint16_t end = 1 + (uint32_t)(column + 1) * (bins - 1) / columns;
+    for (uint16_t k = 1 + (uint32_t)column * (bins - 1) / columns; k < end; k++)
+    {
+      if (amplitudes[k] > amplitude)
+        amplitude = amplitudes[k];
+    }
+    if (amplitude <= 0)
+      continue;
+    float decibels = 20 * log10f(amplitude / largest);
+    int height = (int)((SPECTRUM_DECIBELS + decibels) * (SCREEN_HEIGHT - SPECTRUM_BAR_TOP) / SPECTRUM_DECIBELS);
+    if (height <= 0)
+      continue;
+    int left = column * SCREEN_WIDTH / columns;
+    int width = (column + 1) * SCREEN_WIDTH / columns - left;
+    display.fillRect(left, SCREEN_HEIGHT - height, width > 2 ? width - 1 : width, height, WHITE);
+  }
+  display.display();
+}
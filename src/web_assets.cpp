@@ -0,0 +1,283 @@
+// Generated by tools/web_assets.py from include/website/, do not edit.
+#include <string.h>
+#include "../include/web_assets.h"
+
+// 'style.css', 513 bytes gzipped (1150 minified, 1820 source)
+static const uint8_t asset0[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x93, 0x61, 0x8e, 0x9b, 0x30,
+    0x10, 0x85, 0xaf, 0x82, 0x54, 0x55, 0x4a, 0xa4, 0x18, 0x91, 0x90, 0xa4, 0x95, 0xf9, 0xd3, 0x33,
+    0xf4, 0x06, 0x06, 0x0f, 0xe0, 0xc6, 0x78, 0x90, 0x6d, 0x36, 0xa1, 0x28, 0x77, 0xef, 0xd8, 0xb0,
+    0x51, 0x93, 0x45, 0x55, 0x37, 0x56, 0x12, 0x5b, 0x78, 0x66, 0xde, 0xbc, 0x6f, 0x28, 0x51, 0x8e,
+    0x53, 0x8d, 0xc6, 0xb3, 0x5a, 0x74, 0x4a, 0x8f, 0xfc, 0x27, 0x96, 0xe8, 0x71, 0xe7, 0x46, 0xe7,
+    0xa1, 0x63, 0x83, 0xda, 0x39, 0x61, 0x1c, 0x73, 0x60, 0x55, 0x5d, 0x74, 0xc2, 0x36, 0xca, 0xf0,
+    0xac, 0xe8, 0x85, 0x94, 0xca, 0x34, 0xb4, 0x2b, 0x45, 0x75, 0x69, 0x2c, 0x0e, 0x46, 0xb2, 0x0a,
+    0x35, 0x5a, 0xfe, 0xa5, 0x3e, 0x85, 0x75, 0x4f, 0x2b, 0x4a, 0x2a, 0x94, 0x01, 0x3b, 0x49, 0xe5,
+    0x7a, 0x2d, 0x46, 0x5e, 0x6b, 0xb8, 0x15, 0xe1, 0x87, 0x49, 0x65, 0xa1, 0xf2, 0x0a, 0x0d, 0xa7,
+    0xa0, 0xa1, 0x33, 0x85, 0xd0, 0xaa, 0x31, 0x4c, 0x51, 0x49, 0xc7, 0x2b, 0x30, 0x1e, 0xec, 0xa3,
+    0xc6, 0x21, 0xeb, 0x6f, 0xf7, 0xb4, 0x03, 0xe1, 0x06, 0x0b, 0x1d, 0x3d, 0x63, 0xa5, 0xc6, 0xea,
+    0x32, 0x79, 0xb8, 0x79, 0x16, 0xe3, 0xde, 0x23, 0x66, 0x79, 0x8c, 0xf4, 0x7b, 0xec, 0x56, 0xe2,
+    0xde, 0x84, 0x1e, 0x60, 0x6e, 0xd6, 0xa9, 0xdf, 0xc0, 0xf3, 0x73, 0x4f, 0x7a, 0xc2, 0xf1, 0x0a,
+    0xaa, 0x69, 0x3d, 0x2f, 0x51, 0xcb, 0x62, 0x69, 0x23, 0xcf, 0xf3, 0x87, 0x84, 0x3d, 0xa5, 0x5a,
+    0xeb, 0x34, 0x7e, 0x8a, 0x12, 0xad, 0x04, 0xcb, 0xac, 0x90, 0x6a, 0x70, 0xfc, 0x7b, 0xb8, 0x8a,
+    0x37, 0xe6, 0x5a, 0x21, 0xf1, 0xca, 0x29, 0x32, 0x09, 0xdf, 0x90, 0x22, 0xb1, 0x4d, 0x29, 0x36,
+    0xd9, 0x2e, 0xae, 0x74, 0xbf, 0x2d, 0xbc, 0x25, 0x6f, 0x55, 0xf4, 0x21, 0x6e, 0x6b, 0xb4, 0x5d,
+    0x92, 0xa5, 0x07, 0x97, 0x90, 0x6a, 0x60, 0xd4, 0x0b, 0x0e, 0x7e, 0xa5, 0x87, 0xc4, 0xf5, 0xc2,
+    0x4c, 0xd7, 0x96, 0xfc, 0x62, 0xb4, 0xad, 0x80, 0xf7, 0x16, 0x98, 0x26, 0xb3, 0xc9, 0xf6, 0x56,
+    0x58, 0x3f, 0x5d, 0x95, 0xf4, 0x2d, 0xe9, 0xce, 0xbe, 0x92, 0x2b, 0x37, 0x36, 0x1f, 0xcf, 0xd9,
+    0xe7, 0xfa, 0x58, 0xa9, 0xcc, 0x5b, 0x7c, 0x23, 0xa2, 0x0f, 0xb5, 0xdc, 0x55, 0x42, 0xc3, 0x66,
+    0x9f, 0x66, 0xa7, 0xed, 0x8c, 0xdc, 0xa2, 0x76, 0x0b, 0xa1, 0x27, 0xee, 0xbf, 0x06, 0xe7, 0x55,
+    0x3d, 0xb2, 0x70, 0x87, 0xd2, 0xf1, 0xa8, 0x9b, 0x89, 0x28, 0xa4, 0xf8, 0x87, 0xdc, 0x65, 0xe6,
+    0x0e, 0xd1, 0xc8, 0x47, 0x09, 0x56, 0x0e, 0x04, 0xd9, 0xb8, 0xe7, 0x1a, 0x0b, 0xaf, 0xf7, 0x09,
+    0x88, 0xd8, 0x1a, 0xd1, 0xc7, 0xcd, 0x87, 0xd0, 0x64, 0xfe, 0x5f, 0xac, 0x3a, 0x86, 0xbb, 0xed,
+    0x3c, 0x06, 0xc7, 0x78, 0x1d, 0xfb, 0x00, 0x66, 0xb5, 0x97, 0xd5, 0x19, 0x0e, 0xd6, 0x43, 0x75,
+    0x09, 0xec, 0x83, 0xbd, 0xfd, 0xf4, 0x3c, 0x8e, 0x51, 0xc3, 0x52, 0xf2, 0x69, 0xae, 0xaa, 0xc1,
+    0x3a, 0xa2, 0xd0, 0xa3, 0x8a, 0x43, 0xfc, 0x11, 0x4f, 0x96, 0x7d, 0x2b, 0x09, 0xcf, 0x7c, 0x8a,
+    0xd0, 0x17, 0x54, 0xdc, 0xa0, 0x81, 0x17, 0x6c, 0x47, 0xca, 0xf8, 0xd7, 0x58, 0xbd, 0x66, 0xa3,
+    0xe9, 0xca, 0xdd, 0x22, 0x63, 0x61, 0xb9, 0x56, 0xf0, 0x74, 0x2e, 0xf3, 0xfb, 0x8f, 0x0e, 0xa4,
+    0x12, 0x09, 0x1a, 0x3d, 0x26, 0xae, 0xb2, 0x00, 0x26, 0x11, 0x46, 0x26, 0x9b, 0x17, 0x42, 0xdb,
+    0xe9, 0x95, 0xfb, 0xff, 0xbe, 0xe2, 0xf7, 0xfb, 0x1f, 0xfb, 0x6a, 0x62, 0x6c, 0x7e, 0x04, 0x00,
+    0x00};
+
+// 'script.js', 1639 bytes gzipped (4404 minified, 5313 source)
+static const uint8_t asset1[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x58, 0xe9, 0x6e, 0xdb, 0x38,
+    0x10, 0xfe, 0xef, 0xa7, 0x60, 0x50, 0x20, 0xa2, 0x1a, 0x45, 0x3e, 0xda, 0xa6, 0x45, 0xd2, 0x6c,
+    0x90, 0xab, 0xbb, 0x06, 0xd2, 0x24, 0x48, 0xdc, 0xee, 0x8f, 0x6c, 0x10, 0xd0, 0x12, 0x65, 0x73,
+    0x23, 0x8b, 0xae, 0x44, 0xf9, 0x40, 0x9b, 0x07, 0xda, 0x97, 0xd9, 0x67, 0xda, 0x19, 0x92, 0xba,
+    0xec, 0xb8, 0x07, 0xb6, 0x28, 0x12, 0x71, 0x0e, 0xce, 0x37, 0xc3, 0x39, 0xc8, 0x04, 0x32, 0xc9,
+    0x14, 0xb9, 0xe8, 0x7f, 0x3e, 0x7f, 0x38, 0xbd, 0xba, 0xfc, 0xd0, 0xff, 0x9d, 0x1c, 0x92, 0xee,
+    0x41, 0x2b, 0xa8, 0xc8, 0xb7, 0xc7, 0x1f, 0xaf, 0x2f, 0xce, 0x6f, 0x81, 0xde, 0x6b, 0xd2, 0x07,
+    0xc7, 0x03, 0xa4, 0xbe, 0x2a, 0xa8, 0x9f, 0x2e, 0xfb, 0x9a, 0x70, 0xe7, 0x7c, 0x76, 0x3c, 0xe2,
+    0x1c, 0xe3, 0x8f, 0x7f, 0xff, 0x71, 0xee, 0x0b, 0xfe, 0xe9, 0x1f, 0xc7, 0x37, 0x83, 0x87, 0x8b,
+    0xc1, 0xe0, 0x04, 0x84, 0x3a, 0x4d, 0xea, 0xf5, 0xf9, 0x4d, 0xff, 0xea, 0x0c, 0xe8, 0x6f, 0x3a,
+    0x25, 0xe7, 0xe6, 0xfc, 0xf4, 0xea, 0xe6, 0xec, 0xe1, 0x16, 0x7e, 0x5d, 0x9e, 0xe1, 0xc6, 0x7b,
+    0xc8, 0x8b, 0xb9, 0x22, 0x99, 0x0c, 0x1e, 0xe1, 0xd7, 0x21, 0x49, 0xf2, 0x38, 0x36, 0x24, 0x50,
+    0x89, 0xc4, 0xa8, 0x49, 0x1a, 0xb3, 0x54, 0x5d, 0xf3, 0x24, 0x14, 0x09, 0x32, 0x22, 0x16, 0x67,
+    0xdc, 0x70, 0x52, 0x1e, 0xc8, 0x34, 0xe4, 0x21, 0x82, 0xbd, 0x37, 0xa4, 0x29, 0xcb, 0x33, 0x4d,
+    0xb0, 0x62, 0x51, 0x9e, 0x04, 0x4a, 0xc8, 0x04, 0x37, 0x4e, 0x78, 0xa0, 0xa8, 0x4b, 0xbe, 0xb6,
+    0x2a, 0xbb, 0x7c, 0x4e, 0xfe, 0xe4, 0xc3, 0x5b, 0xbd, 0xa6, 0xce, 0x3c, 0xdb, 0x6f, 0xb7, 0x1d,
+    0xb2, 0x43, 0x62, 0x19, 0x30, 0xd4, 0xf2, 0xc7, 0x12, 0x1c, 0xd8, 0x21, 0x4e, 0x7b, 0x9e, 0x39,
+    0xee, 0x81, 0x55, 0xf4, 0x87, 0x22, 0x61, 0xe9, 0x72, 0xb0, 0x9c, 0x72, 0xd8, 0xc3, 0x61, 0x69,
+    0xca, 0x96, 0xc3, 0x3c, 0x8a, 0x78, 0xea, 0x94, 0x22, 0x32, 0x99, 0xf0, 0x2c, 0x63, 0x23, 0x94,
+    0xa0, 0x7c, 0xc6, 0x13, 0xe5, 0x92, 0xc3, 0xdf, 0x10, 0x31, 0x17, 0x33, 0x4e, 0xd1, 0xf0, 0x19,
+    0x53, 0xec, 0xb3, 0xe0, 0x73, 0xc3, 0xf6, 0x43, 0x58, 0xba, 0x6e, 0x6d, 0x83, 0x20, 0x96, 0x99,
+    0x56, 0xd7, 0x9a, 0x19, 0x57, 0x03, 0x31, 0xe1, 0x32, 0x57, 0xd4, 0xba, 0xe2, 0x91, 0x6e, 0xa7,
+    0xd3, 0x01, 0x8d, 0xa7, 0xca, 0xcb, 0x62, 0xff, 0x19, 0xec, 0xab, 0x3d, 0x9d, 0x0b, 0x15, 0x8c,
+    0x89, 0x5e, 0xfb, 0x23, 0xae, 0x3e, 0x89, 0x44, 0xbd, 0xa3, 0x1d, 0x17, 0x79, 0x01, 0x83, 0xed,
+    0x6b, 0x19, 0xb3, 0xdf, 0x2a, 0x83, 0x0f, 0xcc, 0x31, 0x03, 0x23, 0xf1, 0x3e, 0x69, 0x6a, 0x76,
+    0x5d, 0xaf, 0x95, 0x32, 0xc5, 0x9b, 0xf4, 0xee, 0x1e, 0xed, 0x79, 0x44, 0xa5, 0x39, 0x07, 0xf6,
+    0x88, 0x89, 0xa4, 0x62, 0x7f, 0x88, 0x25, 0x53, 0xaf, 0x7a, 0xf4, 0x75, 0xc9, 0x97, 0x51, 0x04,
+    0xbe, 0xac, 0x4b, 0xbc, 0x2b, 0x25, 0x22, 0x16, 0x28, 0x99, 0xae, 0x4b, 0x74, 0x2b, 0x23, 0x2c,
+    0xf8, 0x92, 0x8b, 0x14, 0x12, 0x62, 0x0d, 0xe0, 0x9e, 0x4b, 0xb6, 0x20, 0x2d, 0xbd, 0xd6, 0xd3,
+    0x41, 0x6b, 0x98, 0x72, 0xf6, 0x78, 0x50, 0x73, 0xd4, 0xd6, 0xc0, 0x7e, 0x4b, 0x44, 0x84, 0x6e,
+    0x59, 0x77, 0xbf, 0x7d, 0xb3, 0x59, 0xe3, 0x96, 0x0a, 0x3a, 0x6f, 0x03, 0x99, 0x27, 0x98, 0x24,
+    0x1b, 0x3c, 0x2d, 0xc4, 0x22, 0x91, 0x66, 0xab, 0x62, 0x35, 0x87, 0x0f, 0xb4, 0x2d, 0x2b, 0x04,
+    0xc0, 0xdc, 0xd6, 0x4a, 0xd6, 0x46, 0x32, 0x25, 0x14, 0x53, 0x57, 0xe8, 0x72, 0x82, 0x5f, 0xef,
+    0x8d, 0x69, 0xf8, 0xdc, 0xd9, 0xd1, 0x07, 0xa5, 0xed, 0xcc, 0x58, 0x9c, 0xf3, 0x9a, 0x9d, 0xbe,
+    0x46, 0xf3, 0x0e, 0xb2, 0xb3, 0x47, 0x5e, 0x12, 0x61, 0xcd, 0xc1, 0xa7, 0x71, 0xcb, 0xc7, 0x73,
+    0xa8, 0x56, 0x26, 0xa6, 0x06, 0x4c, 0x01, 0xc0, 0x8f, 0x79, 0x32, 0x52, 0x63, 0x6d, 0x4f, 0x0b,
+    0xe1, 0xc9, 0x82, 0x4a, 0xb3, 0x60, 0x2b, 0xc0, 0xfe, 0x34, 0xcf, 0xc6, 0xf4, 0xce, 0xf8, 0xb2,
+    0x83, 0x26, 0x35, 0xa6, 0x7b, 0x9d, 0x82, 0xeb, 0xb1, 0xc6, 0xbe, 0xd2, 0x88, 0xf4, 0x4a, 0x7c,
+    0xf3, 0x44, 0x60, 0xdc, 0x1c, 0x82, 0x15, 0xa7, 0x9b, 0xce, 0x9d, 0xc5, 0x61, 0x93, 0xaf, 0xec,
+    0x38, 0x59, 0xc0, 0x62, 0x74, 0xfd, 0xbb, 0x9e, 0x61, 0x08, 0x15, 0x5f, 0xd4, 0x8f, 0x62, 0x35,
+    0xb5, 0x7c, 0x25, 0x3f, 0x88, 0x05, 0x0f, 0xe9, 0x6b, 0x17, 0x4c, 0xa2, 0x7d, 0x13, 0x90, 0x50,
+    0x06, 0xf9, 0x04, 0x6b, 0x10, 0x74, 0xce, 0x63, 0x8e, 0x9f, 0x27, 0xcb, 0x7e, 0x48, 0x9d, 0x09,
+    0x67, 0x89, 0xe3, 0x02, 0x1e, 0x0e, 0x35, 0x09, 0xf9, 0xa1, 0xf7, 0xdf, 0x01, 0xcc, 0x7f, 0x25,
+    0xc8, 0xd2, 0xc8, 0xe9, 0xc6, 0x34, 0x05, 0x8c, 0x1a, 0xf9, 0xaf, 0xdb, 0xcd, 0x54, 0xb8, 0xc1,
+    0x2c, 0x70, 0x36, 0x58, 0xdd, 0xdb, 0x68, 0xf5, 0xcd, 0x4f, 0x5a, 0x55, 0xd0, 0x5f, 0x76, 0x75,
+    0x65, 0x65, 0x02, 0xbb, 0xc9, 0x06, 0x08, 0x0d, 0xf3, 0x2b, 0xd9, 0x4e, 0xda, 0xf5, 0x5c, 0xaa,
+    0x20, 0x74, 0x10, 0x82, 0x43, 0x32, 0x68, 0x90, 0xa5, 0xf9, 0x2f, 0x39, 0x4f, 0x97, 0xb7, 0x3c,
+    0xe6, 0x78, 0x7e, 0xd4, 0x79, 0x01, 0x11, 0xcd, 0xf2, 0x54, 0xe3, 0xd9, 0x35, 0xc9, 0x9e, 0x4d,
+    0x75, 0xf8, 0x05, 0x24, 0x43, 0x3a, 0x30, 0x47, 0x8b, 0x38, 0xca, 0xc2, 0x7e, 0xaa, 0xb7, 0xbe,
+    0x88, 0x43, 0xa7, 0x3b, 0xc5, 0x59, 0x41, 0xab, 0xa2, 0x09, 0x58, 0x32, 0x63, 0x19, 0xe8, 0x6d,
+    0x74, 0x5a, 0x4f, 0x17, 0xc7, 0x96, 0xe9, 0x96, 0x95, 0x87, 0x96, 0xb0, 0xd6, 0x1d, 0xf0, 0xab,
+    0x3e, 0x8a, 0xb0, 0x2e, 0x54, 0x9e, 0x26, 0x45, 0x92, 0xde, 0x65, 0x50, 0x26, 0x49, 0x98, 0x79,
+    0x64, 0x22, 0x43, 0x7e, 0xff, 0x3d, 0x9b, 0x73, 0x91, 0x84, 0x72, 0x0e, 0x9e, 0x69, 0x37, 0xfd,
+    0x6c, 0x1a, 0x0b, 0x98, 0x3e, 0xfb, 0x88, 0x62, 0x65, 0xd8, 0x61, 0x50, 0xa1, 0x45, 0xa0, 0x6b,
+    0xd4, 0x69, 0x6b, 0xe6, 0x91, 0xb5, 0x73, 0x88, 0xe7, 0x60, 0xbf, 0x31, 0xb8, 0xdb, 0x53, 0x09,
+    0x67, 0x61, 0xc8, 0xc6, 0x0d, 0x7f, 0x2e, 0x42, 0x28, 0x6f, 0xe4, 0x21, 0x24, 0xcd, 0xc1, 0x0f,
+    0xb7, 0xe5, 0xab, 0x31, 0x4f, 0x28, 0x34, 0x82, 0x6c, 0x0a, 0xd8, 0xb9, 0x1d, 0x4d, 0x66, 0xe1,
+    0xeb, 0x79, 0x76, 0xa2, 0xe7, 0x19, 0x75, 0x4b, 0x59, 0x33, 0xe0, 0xb4, 0x64, 0x98, 0xb2, 0x39,
+    0x35, 0x26, 0x3c, 0xd2, 0x98, 0x64, 0x56, 0xc8, 0x2b, 0x70, 0xa1, 0x3a, 0x4c, 0x52, 0x00, 0x6f,
+    0x86, 0xd8, 0xd7, 0x27, 0x20, 0x44, 0x30, 0x3d, 0xe3, 0x78, 0x69, 0x49, 0xcf, 0x4d, 0xf7, 0xe6,
+    0x4c, 0x6b, 0x98, 0xc3, 0xbc, 0xab, 0xb6, 0x2f, 0xcf, 0x19, 0xdd, 0x5a, 0xe9, 0xc1, 0x38, 0xe6,
+    0x8a, 0xb3, 0x31, 0xa1, 0xf9, 0x71, 0x2f, 0x7f, 0xae, 0xe5, 0xd7, 0xfa, 0x47, 0x21, 0xa6, 0xfb,
+    0xe4, 0xda, 0x66, 0xdd, 0x4d, 0x93, 0x01, 0x43, 0xa4, 0xbb, 0xf5, 0x31, 0x46, 0xd6, 0x94, 0x8e,
+    0x89, 0x94, 0x47, 0x7a, 0x1d, 0xcf, 0xa2, 0x2b, 0xd5, 0x8c, 0x73, 0x3f, 0xd4, 0xb3, 0x8d, 0xdf,
+    0x28, 0xaf, 0x6d, 0x02, 0x3f, 0x6d, 0x33, 0xb4, 0xb9, 0x00, 0x38, 0x4f, 0x0d, 0x8d, 0x3a, 0xbd,
+    0xd0, 0x31, 0x82, 0xb8, 0xf4, 0x83, 0x98, 0xb3, 0xf4, 0x06, 0xef, 0x46, 0x80, 0x05, 0xfe, 0xd7,
+    0x93, 0xa7, 0x5c, 0x8d, 0xb9, 0x18, 0x8d, 0x95, 0x2d, 0x13, 0x1b, 0xce, 0xf7, 0xa4, 0x57, 0x15,
+    0x01, 0xb6, 0xdf, 0x89, 0x48, 0xc4, 0x24, 0x9f, 0x80, 0xd1, 0x3e, 0xd4, 0x0e, 0x34, 0x9c, 0xa5,
+    0xa5, 0xb3, 0x85, 0xa5, 0xef, 0x56, 0x8c, 0xe7, 0xe6, 0x9e, 0xd9, 0xb8, 0x1c, 0x7c, 0xd5, 0x7e,
+    0x1f, 0x99, 0x1a, 0xfb, 0xb0, 0xa4, 0x96, 0xe4, 0xd9, 0x13, 0x3f, 0xac, 0xdf, 0x46, 0x8f, 0x6c,
+    0xe8, 0xee, 0xc4, 0x3d, 0xd9, 0x37, 0xd1, 0x87, 0x4f, 0xc0, 0x5c, 0xd9, 0x37, 0xfb, 0xb0, 0x05,
+    0xb5, 0x24, 0xaf, 0x52, 0xd1, 0x49, 0x67, 0x4f, 0x00, 0xfa, 0x0e, 0x08, 0x17, 0x6a, 0xbb, 0xa5,
+    0x63, 0xd0, 0x02, 0xca, 0x4b, 0xf5, 0x12, 0xaf, 0x66, 0xba, 0x80, 0x4d, 0x1e, 0xd7, 0xe3, 0x04,
+    0x2a, 0x86, 0x55, 0xe9, 0xea, 0xc9, 0xdc, 0x90, 0x69, 0x6b, 0x3b, 0xc5, 0x76, 0xa6, 0x56, 0x0f,
+    0x9b, 0xa5, 0xfb, 0xb2, 0x72, 0xbc, 0xeb, 0xd9, 0xec, 0x6c, 0x57, 0x4e, 0x68, 0x42, 0x59, 0x0d,
+    0x20, 0xad, 0x9b, 0x6e, 0xed, 0x68, 0x87, 0x7c, 0x24, 0x92, 0x6b, 0x10, 0xa7, 0xf6, 0xe4, 0xd6,
+    0xa3, 0x86, 0x71, 0xfe, 0x89, 0xa3, 0x30, 0x20, 0x17, 0xe8, 0x73, 0x11, 0x58, 0xb2, 0x4d, 0x3a,
+    0x8b, 0x08, 0xfe, 0xa1, 0x6b, 0x06, 0x6f, 0x9b, 0x18, 0x4c, 0xe0, 0x76, 0xd7, 0x5a, 0x14, 0xf6,
+    0xd6, 0x53, 0x40, 0x9a, 0xc8, 0x19, 0x1f, 0x48, 0xba, 0xf0, 0xc8, 0x92, 0x56, 0xb1, 0x07, 0x61,
+    0x0e, 0x85, 0x5f, 0x4a, 0xc5, 0x22, 0x79, 0x5e, 0x0a, 0x5a, 0x3e, 0x41, 0xc9, 0x5f, 0x46, 0x2d,
+    0xa0, 0x5e, 0x3a, 0xfe, 0x9b, 0x3a, 0x56, 0x2b, 0xfc, 0x2c, 0xb4, 0x32, 0x7b, 0x6a, 0xd1, 0x7c,
+    0x1e, 0x94, 0xf5, 0xf5, 0xc9, 0x64, 0x8f, 0x16, 0xcc, 0x54, 0x2a, 0x1f, 0xf9, 0xad, 0x5a, 0xea,
+    0x5b, 0x8b, 0xf3, 0xa2, 0xd3, 0x79, 0x3b, 0x8c, 0x22, 0xe7, 0x60, 0x45, 0x80, 0x36, 0xfb, 0x5c,
+    0xa6, 0xa0, 0x13, 0x7e, 0xac, 0x86, 0xa0, 0x1e, 0x63, 0xab, 0xef, 0x19, 0x0c, 0xa9, 0x7d, 0xbe,
+    0x6c, 0x6f, 0xdb, 0x07, 0x94, 0x0f, 0xd3, 0x30, 0x5c, 0xde, 0x2a, 0xdd, 0x95, 0x0e, 0xab, 0x07,
+    0x8d, 0x7f, 0x75, 0x7d, 0x7e, 0xe9, 0x16, 0x0f, 0x8a, 0x0c, 0x7a, 0x2c, 0xde, 0x2c, 0xec, 0xb8,
+    0xab, 0x19, 0xd6, 0x36, 0x36, 0x1a, 0xde, 0x32, 0x5f, 0x2b, 0x50, 0xe5, 0x74, 0x55, 0xe1, 0xff,
+    0x23, 0x93, 0xd3, 0x15, 0x60, 0x30, 0x24, 0x13, 0xb8, 0xde, 0x84, 0x38, 0x5f, 0x6a, 0x43, 0x3d,
+    0x63, 0x93, 0xa9, 0x8e, 0xec, 0xe6, 0xfb, 0x93, 0x96, 0xa8, 0xee, 0x2f, 0x45, 0x91, 0xe1, 0x0d,
+    0x07, 0x22, 0x30, 0x99, 0x7e, 0x4f, 0xb9, 0x14, 0xaa, 0xeb, 0xeb, 0x87, 0x68, 0x36, 0xc3, 0x4c,
+    0xb2, 0xe6, 0x8f, 0x88, 0x35, 0xe3, 0x39, 0xd0, 0x6d, 0x1c, 0x07, 0x6f, 0x38, 0xb4, 0x32, 0x00,
+    0x6c, 0x5c, 0x3c, 0x64, 0x35, 0xb6, 0xa3, 0x7b, 0x02, 0xdc, 0xa0, 0x6c, 0xf7, 0xb3, 0x17, 0x07,
+    0xb8, 0x0d, 0xf0, 0x45, 0x71, 0x99, 0x26, 0x32, 0x2a, 0xdf, 0xb5, 0xda, 0x65, 0x30, 0xba, 0x53,
+    0xb7, 0xaa, 0xa5, 0x71, 0xb3, 0xe7, 0xed, 0x42, 0xec, 0xed, 0xcd, 0xe5, 0x08, 0x92, 0x5e, 0xcb,
+    0x6e, 0xb8, 0x93, 0xed, 0xb9, 0xcd, 0x5d, 0x5a, 0xe6, 0x36, 0xa2, 0xe4, 0x35, 0xd8, 0x87, 0x2b,
+    0xa0, 0x4c, 0xe8, 0x5b, 0x2d, 0xa2, 0x01, 0x17, 0xbd, 0x11, 0x8a, 0xe0, 0xb1, 0x1e, 0xbd, 0x00,
+    0x8e, 0x58, 0x71, 0x1b, 0x40, 0xea, 0x30, 0x3c, 0x42, 0x94, 0xf1, 0xc7, 0x29, 0x8f, 0x40, 0xf0,
+    0xd3, 0xcd, 0x85, 0x95, 0xb9, 0x1a, 0xfe, 0x0d, 0x43, 0x06, 0xd6, 0xfa, 0xf5, 0x7b, 0x12, 0xcb,
+    0x21, 0xbd, 0x03, 0xef, 0xee, 0x3d, 0xf2, 0x95, 0x28, 0x78, 0x4b, 0x03, 0x0c, 0x2c, 0x8e, 0x36,
+    0xd0, 0x1c, 0xf2, 0xe4, 0x16, 0xfb, 0x14, 0x49, 0x80, 0x95, 0x14, 0xcb, 0xd1, 0x88, 0xa7, 0x3e,
+    0x4a, 0x58, 0x6e, 0x10, 0x8b, 0xe0, 0x91, 0x16, 0xbd, 0xdb, 0xbc, 0xf0, 0xe1, 0x0d, 0xad, 0x9f,
+    0x47, 0x3c, 0x05, 0x8f, 0x68, 0x75, 0x2f, 0xf4, 0x1a, 0x7f, 0xa4, 0x00, 0xb1, 0xff, 0x00, 0xfb,
+    0xcf, 0xad, 0xc0, 0x35, 0x11, 0x00, 0x00};
+
+// 'index.html', 629 bytes gzipped (1531 minified, 1910 source)
+static const uint8_t asset2[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x54, 0x5b, 0x6f, 0xdb, 0x20,
+    0x14, 0xfe, 0x2b, 0x8c, 0x49, 0xd3, 0x26, 0xd5, 0xb1, 0x93, 0xf5, 0x92, 0xb4, 0xb6, 0xa5, 0xaa,
+    0xd9, 0x9e, 0x36, 0x6d, 0x52, 0xbb, 0x87, 0x3d, 0x9e, 0xc0, 0x69, 0xcc, 0x82, 0xc1, 0x03, 0x9c,
+    0x34, 0xff, 0xbe, 0x60, 0x72, 0x71, 0x9a, 0x74, 0xea, 0x5e, 0xec, 0x73, 0xbe, 0x73, 0x81, 0xf3,
+    0x7d, 0x40, 0xfe, 0x6e, 0xfa, 0xe3, 0xee, 0xe1, 0xf7, 0xcf, 0x2f, 0xa4, 0x72, 0xb5, 0x2c, 0xf3,
+    0xf0, 0x25, 0x12, 0xd4, 0xbc, 0xa0, 0xa8, 0xa8, 0xf7, 0x11, 0x78, 0x99, 0xd7, 0xe8, 0x80, 0xb0,
+    0x0a, 0x8c, 0x45, 0x57, 0xd0, 0x5f, 0x0f, 0x5f, 0x93, 0x31, 0xdd, 0xa0, 0x0a, 0x6a, 0x2c, 0xe8,
+    0x52, 0xe0, 0xaa, 0xd1, 0xc6, 0x51, 0xc2, 0xb4, 0x72, 0xa8, 0x7c, 0xd6, 0x4a, 0x70, 0x57, 0x15,
+    0x1c, 0x97, 0x82, 0x61, 0xd2, 0x39, 0x67, 0x44, 0x28, 0xe1, 0x04, 0xc8, 0xc4, 0x32, 0x90, 0x58,
+    0x0c, 0x07, 0x99, 0xef, 0x22, 0x85, 0x5a, 0x10, 0x83, 0xb2, 0xa0, 0xd6, 0xad, 0x25, 0xda, 0x0a,
+    0xd1, 0xb7, 0xa9, 0x0c, 0x3e, 0x6e, 0x90, 0x01, 0x8e, 0x2f, 0x46, 0x7c, 0x72, 0x01, 0x03, 0x66,
+    0xad, 0x2f, 0x70, 0xc2, 0x49, 0x2c, 0xbf, 0xe9, 0xf9, 0x1c, 0x4d, 0x9e, 0x46, 0x2f, 0x4f, 0xe3,
+    0x46, 0x67, 0x9a, 0xaf, 0xcb, 0x9c, 0x8b, 0x25, 0x61, 0x12, 0xac, 0x2d, 0x68, 0xd8, 0x0e, 0x08,
+    0x85, 0x86, 0x1e, 0xc0, 0x35, 0x82, 0x6d, 0x0d, 0xd6, 0x7e, 0xa7, 0xc9, 0x4c, 0x6a, 0xb6, 0x08,
+    0xa3, 0x8e, 0xca, 0xef, 0x7b, 0xd8, 0x77, 0x1c, 0xbd, 0x5a, 0xb2, 0x04, 0xd9, 0x22, 0x25, 0x82,
+    0x9f, 0x82, 0xcb, 0xdc, 0x36, 0xa0, 0xca, 0x6c, 0x90, 0x65, 0x79, 0xda, 0x99, 0x79, 0xea, 0xfb,
+    0x6c, 0xbf, 0x0c, 0xd4, 0x12, 0x6c, 0x57, 0x1b, 0x18, 0x0d, 0x94, 0x6d, 0xb6, 0x1a, 0xbd, 0xc8,
+    0x1b, 0xbd, 0xcc, 0x32, 0xcf, 0x02, 0x8a, 0x79, 0xe5, 0xb9, 0x1c, 0x9d, 0x07, 0xa6, 0xd2, 0x58,
+    0x7a, 0x34, 0x9f, 0xd1, 0xd2, 0xee, 0xa6, 0x38, 0x8e, 0x25, 0xb3, 0xd6, 0x39, 0xad, 0x02, 0x75,
+    0xd1, 0x22, 0x5a, 0x31, 0x29, 0xd8, 0x22, 0xf0, 0xeb, 0x97, 0xec, 0x0d, 0xfd, 0xf1, 0x13, 0x2d,
+    0x3f, 0xbc, 0x9f, 0x5c, 0x5e, 0x9c, 0xdf, 0xe4, 0x69, 0x4c, 0x3e, 0x2e, 0x6a, 0xa0, 0xb5, 0x78,
+    0x54, 0x34, 0xcc, 0xb2, 0xab, 0xf3, 0x9b, 0xed, 0xff, 0xf5, 0x6a, 0xeb, 0x74, 0x73, 0x62, 0xc5,
+    0xcf, 0xa3, 0x5e, 0x4d, 0x24, 0xaa, 0x37, 0x89, 0x6e, 0x9c, 0xf0, 0x13, 0x9c, 0x1c, 0xb2, 0x42,
+    0xb6, 0x98, 0xe9, 0xa7, 0x64, 0x6e, 0x74, 0xdb, 0xf8, 0x98, 0x50, 0x4d, 0xeb, 0x88, 0x5b, 0x37,
+    0xb8, 0x0f, 0x46, 0xa9, 0x2c, 0xd4, 0x8d, 0xf4, 0xb2, 0xc5, 0x23, 0xbb, 0xf1, 0xfc, 0x01, 0x84,
+    0x19, 0x4a, 0xf2, 0xa8, 0xcd, 0x1e, 0xbb, 0xef, 0xfe, 0x79, 0xda, 0x85, 0xfe, 0xd5, 0xd2, 0x89,
+    0x1a, 0x3d, 0x89, 0x75, 0xb3, 0xed, 0xba, 0x07, 0x0e, 0x1a, 0xf7, 0xe0, 0x87, 0xad, 0xb9, 0x6b,
+    0xdf, 0xcb, 0x5b, 0x09, 0xc5, 0xf5, 0x8a, 0x96, 0x77, 0xe1, 0x2c, 0x5c, 0xef, 0x32, 0x2c, 0x4a,
+    0x64, 0xae, 0x5b, 0x71, 0x9b, 0x91, 0x47, 0x4e, 0x48, 0x77, 0xe6, 0x0a, 0x3a, 0xcc, 0xae, 0xa5,
+    0x73, 0x33, 0x5a, 0x0e, 0x33, 0x62, 0xf3, 0x34, 0x06, 0x5f, 0x26, 0x5d, 0xee, 0x92, 0x48, 0x2d,
+    0xd4, 0x6b, 0x59, 0xd9, 0xb5, 0x0f, 0xd6, 0xf0, 0x44, 0xcb, 0x5b, 0x29, 0xcf, 0x42, 0x66, 0xea,
+    0xbd, 0x7d, 0x76, 0x1a, 0x77, 0x73, 0x42, 0xa6, 0xff, 0xd0, 0xc2, 0x5f, 0x1b, 0xb5, 0xe5, 0xac,
+    0xb3, 0x0f, 0x68, 0x88, 0x88, 0x3f, 0x26, 0xea, 0x0d, 0x1a, 0x58, 0xc7, 0x77, 0x9a, 0x7a, 0xf3,
+    0x50, 0xd0, 0x00, 0xdc, 0x3b, 0x50, 0x1c, 0x0c, 0x27, 0x53, 0xff, 0x18, 0x41, 0x18, 0xe2, 0x8d,
+    0xca, 0x26, 0xc0, 0xfe, 0xb6, 0xc2, 0x8a, 0x50, 0xd2, 0x17, 0xf8, 0x00, 0x3f, 0xd2, 0xf9, 0x30,
+    0x1a, 0xe4, 0x26, 0xb7, 0x7b, 0x64, 0xb7, 0x74, 0x64, 0xef, 0xe5, 0xf5, 0xf0, 0xda, 0x2a, 0xa9,
+    0x81, 0x4f, 0xc1, 0x41, 0xb8, 0x1b, 0xd3, 0x8d, 0xff, 0xf2, 0x72, 0xf4, 0xbf, 0x96, 0x19, 0xd1,
+    0x38, 0x62, 0x0d, 0xf3, 0x03, 0x77, 0xf6, 0xe0, 0x6a, 0x32, 0xe4, 0xc3, 0xf1, 0x64, 0x3c, 0xf8,
+    0x13, 0xae, 0x7d, 0x1a, 0x51, 0x6f, 0xc4, 0xf7, 0x31, 0xed, 0xde, 0xfa, 0x67, 0x1c, 0x76, 0x9c,
+    0xcd, 0xfb, 0x05, 0x00, 0x00};
+
+// 'embed.html', 1093 bytes gzipped (2968 minified, 4435 source)
+static const uint8_t asset3[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x56, 0xdb, 0x6e, 0xe3, 0x36,
+    0x10, 0xfd, 0x15, 0x56, 0x8b, 0x16, 0x09, 0x10, 0x5a, 0xf2, 0x25, 0x37, 0x59, 0x16, 0xba, 0xd8,
+    0x6c, 0x9f, 0x5a, 0xb4, 0xe8, 0xa6, 0x0f, 0x7d, 0xa4, 0x24, 0xda, 0xe6, 0x86, 0x22, 0x55, 0x92,
+    0xf2, 0xa5, 0x86, 0xff, 0xbd, 0x43, 0x52, 0x96, 0x2d, 0x5b, 0xd9, 0x64, 0x9f, 0x1a, 0x23, 0x12,
+    0x39, 0x9c, 0x19, 0x0e, 0xcf, 0x99, 0x19, 0x2a, 0xf9, 0xe1, 0xe9, 0xf7, 0x4f, 0xcf, 0x7f, 0xff,
+    0xf1, 0x19, 0x2d, 0x4d, 0xc9, 0xd3, 0xc4, 0x3e, 0x11, 0x27, 0x62, 0x31, 0x0b, 0xa8, 0x08, 0x60,
+    0x4e, 0x49, 0x91, 0x26, 0x25, 0x35, 0x04, 0xe5, 0x4b, 0xa2, 0x34, 0x35, 0xb3, 0xe0, 0xaf, 0xe7,
+    0x5f, 0xf0, 0x43, 0xd0, 0x48, 0x05, 0x29, 0xe9, 0x2c, 0x58, 0x31, 0xba, 0xae, 0xa4, 0x32, 0x01,
+    0xca, 0xa5, 0x30, 0x54, 0x80, 0xd6, 0x9a, 0x15, 0x66, 0x39, 0x2b, 0xe8, 0x8a, 0xe5, 0x14, 0xbb,
+    0xc9, 0x0d, 0x62, 0x82, 0x19, 0x46, 0x38, 0xd6, 0x39, 0xe1, 0x74, 0x36, 0x1c, 0x44, 0xe0, 0xc5,
+    0x30, 0xc3, 0x69, 0xfa, 0xab, 0x5c, 0x2c, 0xa8, 0x4a, 0x42, 0x3f, 0x4b, 0xb4, 0xd9, 0xc2, 0x2b,
+    0x93, 0xc5, 0x76, 0x37, 0x07, 0x87, 0x78, 0x4e, 0x4a, 0xc6, 0xb7, 0xf1, 0x9f, 0x32, 0x93, 0x46,
+    0xde, 0xe8, 0xad, 0x36, 0xb4, 0xc4, 0x35, 0xbb, 0xd1, 0x44, 0x68, 0xac, 0xa9, 0x62, 0xf3, 0x69,
+    0x49, 0xd4, 0x82, 0x89, 0x38, 0x9a, 0x56, 0xa4, 0x28, 0x98, 0x58, 0xc0, 0x28, 0x23, 0xf9, 0xcb,
+    0x42, 0xc9, 0x5a, 0x14, 0x38, 0x97, 0x5c, 0xaa, 0xf8, 0xc3, 0xfc, 0xd6, 0xfe, 0xa6, 0x46, 0x81,
+    0x1d, 0x84, 0x22, 0x45, 0x7c, 0xae, 0x83, 0xa2, 0xc1, 0x58, 0x23, 0x4a, 0x34, 0xc5, 0x4c, 0x60,
+    0x59, 0x9b, 0xfd, 0xc0, 0x1e, 0x89, 0x30, 0x41, 0xd5, 0xae, 0x60, 0xba, 0xe2, 0x64, 0x1b, 0xcf,
+    0x39, 0xdd, 0x4c, 0xed, 0x03, 0x17, 0x4c, 0xd1, 0xdc, 0x39, 0x02, 0xeb, 0xba, 0x14, 0x53, 0xc2,
+    0xd9, 0x42, 0x60, 0x06, 0xf1, 0xe9, 0x38, 0x07, 0x20, 0xa8, 0x6a, 0x03, 0x1a, 0x45, 0xd5, 0x66,
+    0x3f, 0x28, 0xc1, 0x77, 0xad, 0x68, 0x09, 0x6b, 0x38, 0xe3, 0x32, 0x7f, 0xd9, 0x19, 0xba, 0x31,
+    0xd8, 0xd9, 0x1d, 0x2c, 0xfc, 0x59, 0x30, 0x1c, 0xd6, 0xc8, 0xb2, 0xc7, 0x6e, 0x45, 0x78, 0x4d,
+    0x3d, 0x32, 0x9a, 0xfd, 0x4b, 0xe3, 0xf1, 0x5d, 0x05, 0xf1, 0xd8, 0xe9, 0x9a, 0xb2, 0xc5, 0xd2,
+    0xc4, 0x99, 0xe4, 0xc5, 0xb4, 0x39, 0xf3, 0x78, 0x3c, 0x6e, 0x43, 0x18, 0x82, 0xab, 0x3e, 0x58,
+    0xdc, 0xdf, 0x34, 0x93, 0xaa, 0xa0, 0x0a, 0x2b, 0x52, 0xb0, 0x5a, 0xc7, 0x0f, 0x56, 0x55, 0x6e,
+    0xb0, 0x5e, 0x92, 0x42, 0xae, 0x63, 0xb0, 0x44, 0xf6, 0xdf, 0xba, 0x40, 0x6a, 0x91, 0x91, 0xab,
+    0xe8, 0xc6, 0xfd, 0x06, 0xc3, 0xeb, 0x53, 0x40, 0xdd, 0x70, 0x2e, 0x55, 0x09, 0x48, 0x8e, 0xce,
+    0x90, 0xbc, 0x38, 0x03, 0xd2, 0x15, 0x11, 0xbb, 0xf5, 0x12, 0xf0, 0xc2, 0x30, 0xcc, 0x69, 0x5c,
+    0x29, 0x8a, 0x39, 0x80, 0x0d, 0xb0, 0x43, 0xbe, 0x99, 0x9d, 0xcb, 0x1c, 0x88, 0x3b, 0xfa, 0x11,
+    0x50, 0xd9, 0xf8, 0x44, 0x8a, 0xef, 0xa2, 0xef, 0x3b, 0x47, 0xcf, 0xce, 0xf1, 0x52, 0xae, 0x80,
+    0xd1, 0x36, 0xda, 0xd8, 0xe5, 0xe4, 0x15, 0xe4, 0xe4, 0xed, 0xb5, 0xa7, 0x5c, 0x49, 0xae, 0x1b,
+    0x86, 0x3a, 0xbc, 0x7f, 0xad, 0xb5, 0x61, 0xf3, 0x2d, 0x6e, 0x32, 0x3d, 0x76, 0x71, 0x63, 0xe2,
+    0x02, 0x99, 0x7e, 0x23, 0xdc, 0x26, 0x41, 0x47, 0x0e, 0xc8, 0x76, 0x0b, 0x9c, 0xd5, 0x40, 0xb2,
+    0xd0, 0xdd, 0x3d, 0x16, 0xa4, 0x72, 0x5c, 0x5d, 0xa8, 0x21, 0xff, 0x6e, 0x60, 0x99, 0x58, 0xbf,
+    0x4b, 0x4f, 0xf9, 0xc4, 0xa9, 0xcb, 0xca, 0x92, 0xd0, 0x1b, 0x77, 0x6f, 0xbe, 0x5a, 0x98, 0x69,
+    0xfe, 0x62, 0x79, 0xb6, 0x50, 0x56, 0xbb, 0x6e, 0xea, 0xb9, 0x18, 0x9a, 0x2d, 0x3b, 0x39, 0x94,
+    0xd7, 0x4a, 0x03, 0xe2, 0x95, 0x64, 0x2e, 0x61, 0x2f, 0xa9, 0x88, 0xa2, 0xfb, 0x0c, 0xa8, 0xf0,
+    0x33, 0x47, 0x70, 0x43, 0x4b, 0x2c, 0xa4, 0xa0, 0x67, 0x14, 0x4d, 0xc0, 0xe3, 0x5b, 0x35, 0xd9,
+    0x84, 0xd1, 0xf0, 0xd6, 0xb7, 0xe1, 0xed, 0x5d, 0x36, 0xde, 0xff, 0x5c, 0xd2, 0x82, 0x11, 0x24,
+    0x05, 0xdf, 0x22, 0x9d, 0x2b, 0x4a, 0x05, 0x22, 0xa2, 0x40, 0x57, 0x67, 0x6c, 0x5c, 0xef, 0xce,
+    0x39, 0x7e, 0x6f, 0x39, 0xef, 0xf7, 0x83, 0x82, 0xa8, 0x17, 0x6c, 0x96, 0x90, 0x4d, 0x3d, 0x71,
+    0xd8, 0x72, 0x3b, 0xa6, 0xe3, 0x7e, 0xe0, 0xf4, 0xb0, 0x5e, 0x33, 0x93, 0x2f, 0xdf, 0x2c, 0x75,
+    0xcf, 0xf9, 0xa9, 0x09, 0x3a, 0x43, 0xff, 0xe1, 0xff, 0x01, 0xbf, 0x2f, 0xa6, 0xb7, 0xa8, 0x48,
+    0x42, 0xdf, 0xc6, 0x93, 0xd0, 0xdf, 0x22, 0xb6, 0x9d, 0xa7, 0x49, 0xc1, 0x56, 0x28, 0xe7, 0x44,
+    0xeb, 0x59, 0xd0, 0x36, 0xd6, 0xa0, 0x23, 0xbe, 0xe8, 0x90, 0xf6, 0x1e, 0x1a, 0xa5, 0xbf, 0x1d,
+    0xc5, 0xe0, 0x71, 0xf4, 0xaa, 0x89, 0x2b, 0xef, 0x00, 0xb1, 0xa2, 0x4f, 0x0c, 0x57, 0x0b, 0x74,
+    0x9c, 0x34, 0x1a, 0x44, 0x11, 0x84, 0x67, 0x87, 0x49, 0x08, 0x7e, 0x0e, 0xcf, 0x9c, 0x88, 0x15,
+    0xd1, 0xce, 0xd6, 0xb5, 0x9f, 0xa0, 0x0d, 0xd5, 0xcf, 0xfc, 0xa5, 0x16, 0x40, 0x0a, 0x05, 0xc8,
+    0xd7, 0xdd, 0x2c, 0x18, 0x4d, 0xec, 0x35, 0x16, 0x7a, 0xd3, 0x8b, 0xf3, 0x1d, 0x33, 0x2c, 0xe8,
+    0x5b, 0x3b, 0xd4, 0x35, 0x2c, 0xfa, 0x11, 0x64, 0x6e, 0xce, 0x59, 0xfe, 0x32, 0x0b, 0xb4, 0x81,
+    0x2d, 0x4f, 0x0e, 0x7d, 0x75, 0x1d, 0xa4, 0x3f, 0x7d, 0x78, 0xbc, 0xbb, 0x9d, 0x4c, 0x93, 0xd0,
+    0x2b, 0x5f, 0x1a, 0x55, 0xa4, 0xd6, 0xf4, 0xc2, 0x08, 0xfa, 0xd1, 0xfd, 0x64, 0x7a, 0x78, 0xbf,
+    0x6e, 0xad, 0x8d, 0xac, 0x7a, 0x76, 0x1c, 0x8f, 0x4e, 0x6c, 0x3c, 0x50, 0x27, 0x27, 0xe9, 0xb4,
+    0x9c, 0xb3, 0x43, 0x76, 0x7a, 0x0b, 0xac, 0x31, 0x51, 0xd5, 0x06, 0x99, 0x6d, 0x45, 0x8f, 0x8b,
+    0x9e, 0x2a, 0x4d, 0xca, 0x8a, 0x03, 0x6d, 0xfe, 0x7b, 0xa2, 0x99, 0xa5, 0x09, 0x27, 0x19, 0xe5,
+    0x08, 0x1a, 0xf4, 0x51, 0xf6, 0xc5, 0xbd, 0x93, 0xd0, 0x2d, 0x7d, 0xcb, 0xa5, 0x61, 0x25, 0x05,
+    0x10, 0xcb, 0xea, 0xe0, 0xf5, 0x28, 0xe8, 0x38, 0x3e, 0x11, 0x3f, 0x1f, 0x86, 0xad, 0xfb, 0x13,
+    0xbd, 0x35, 0x13, 0x70, 0x11, 0x06, 0xe9, 0x27, 0x9b, 0x0b, 0x71, 0xab, 0xa1, 0x29, 0x87, 0x9e,
+    0xe1, 0x76, 0x3c, 0x68, 0x24, 0x1e, 0x13, 0xe4, 0x72, 0x6e, 0x16, 0x0c, 0xa3, 0x98, 0x1b, 0x93,
+    0x05, 0xe9, 0x30, 0x42, 0x3a, 0x09, 0xfd, 0xe2, 0xb9, 0xd2, 0x5d, 0xab, 0x84, 0x4a, 0x26, 0x5e,
+    0xd3, 0x8a, 0x62, 0x58, 0x84, 0x5e, 0x16, 0xa4, 0x1f, 0x39, 0xbf, 0xb1, 0x9a, 0x21, 0xcc, 0x8e,
+    0xda, 0xa1, 0x8f, 0xa6, 0x87, 0xa6, 0xef, 0xe0, 0x02, 0xca, 0x46, 0x1c, 0x30, 0x73, 0xe3, 0x0e,
+    0x0c, 0x5e, 0x02, 0x69, 0x22, 0xde, 0xc1, 0x81, 0x36, 0x45, 0xcb, 0x29, 0x0c, 0xbb, 0x84, 0x5a,
+    0xc1, 0x17, 0x03, 0xed, 0x99, 0xa8, 0x02, 0x3d, 0xc1, 0x97, 0x22, 0xb1, 0x87, 0x78, 0x27, 0xb3,
+    0x98, 0xe4, 0xff, 0xd4, 0xcc, 0x37, 0xad, 0x53, 0x82, 0x3b, 0xf2, 0x0b, 0x9e, 0xbb, 0xab, 0x96,
+    0x6e, 0xf4, 0xf1, 0x28, 0x69, 0xb7, 0xf6, 0xe8, 0x9d, 0x97, 0x07, 0x70, 0x2b, 0xb8, 0x24, 0xc5,
+    0x13, 0x31, 0xc4, 0xd6, 0xc6, 0x53, 0x33, 0x3f, 0x2f, 0x8e, 0xd3, 0x27, 0xdc, 0x41, 0xac, 0x32,
+    0x48, 0xab, 0x1c, 0x0e, 0xec, 0xc6, 0x83, 0xfb, 0xc7, 0x61, 0x31, 0x7c, 0x78, 0x7c, 0x18, 0x7c,
+    0xb5, 0x65, 0x1f, 0x7a, 0x29, 0x0c, 0x7c, 0x7f, 0x0c, 0xdd, 0x87, 0xf8, 0x7f, 0x23, 0xe3, 0x08,
+    0x8f, 0x98, 0x0b, 0x00, 0x00};
+
+const WebAsset webAssets[] = {
+    {"/style.e852d95a.css", "text/css; charset=utf-8", "\"e852d95a26af7995\"", true, asset0, 513},
+    {"/script.791d1898.js", "application/javascript; charset=utf-8", "\"791d1898d0ad56ca\"", true, asset1, 1639},
+    {"/index.html", "text/html; charset=utf-8", "\"df82faf64b842cd7\"", false, asset2, 629},
+    {"/embed.html", "text/html; charset=utf-8", "\"3f6909301fec5def\"", false, asset3, 1093},
+};
+const size_t webAssetCount = 4;
+
+/**
+ * @brief Returns the asset served at a path, "/" being the index, or NULL.
+ */
+const WebAsset *findWebAsset(const char *path)
+{
+    if (strcmp(path, "/") == 0)
+        path = "/index.html";
+    for (size_t i = 0; i < webAssetCount; i++)
+    {
+        if (strcmp(webAssets[i].path, path) == 0)
+            return &webAssets[i];
+    }
+    return NULL;
+}
@@ -0,0 +1,879 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include "../include/webserver.h"
+#ifdef ESP32
+#include <lwip/sockets.h> // Registered with the VFS, so close() and fcntl() work on the sockets
+#else
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// States of a connection
+#define HTTP_READING 0 // Waiting for a request, or sending the response to the last one
+#define HTTP_CLOSING 1 // Sending the last response, closed once the queue is empty
+#define WS_CONNECTED 2 // WebSocket, after the handshake
+
+// WebSocket opcodes (RFC 6455)
+#define WS_TEXT 0x1
+#define WS_BINARY 0x2
+#define WS_CLOSE_FRAME 0x8
+#define WS_PING 0x9
+#define WS_PONG 0xA
+
+static const char *WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+static void setNonBlocking(int socket)
+{
+    fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static uint32_t rotate(uint32_t value, int bits)
+{
+    return value << bits | value >> (32 - bits);
+}
+
+/**
+ * @brief Computes the SHA-1 digest of a short message, for the WebSocket handshake only.
+ *
+ * @param length At most 119 bytes, so the padded message fits in two blocks.
+ */
+static void sha1(const uint8_t *message, size_t length, uint8_t digest[20])
+{
+    uint8_t data[128] = {0};
+    size_t blocks = length + 9 > 64 ? 2 : 1;
+    memcpy(data, message, length);
+    data[length] = 0x80;
+    uint64_t bits = (uint64_t)length * 8;
+    for (int i = 0; i < 8; i++)
+        data[blocks * 64 - 1 - i] = (uint8_t)(bits >> (8 * i));
+
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    for (size_t block = 0; block < blocks; block++)
+    {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++)
+        {
+            const uint8_t *p = data + block * 64 + i * 4;
+            w[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+        }
+        for (int i = 16; i < 80; i++)
+            w[i] = rotate(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++)
+        {
+            uint32_t f, k;
+            if (i < 20)
+            {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = rotate(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotate(b, 30);
+            b = a;
+            a = temp;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+    for (int i = 0; i < 20; i++)
+        digest[i] = (uint8_t)(h[i / 4] >> (24 - 8 * (i % 4)));
+}
+
+/**
+ * @brief Encodes bytes in base64, with padding.
+ *
+ * @param out At least 4 * ((length + 2) / 3) + 1 bytes.
+ */
+static void base64(const uint8_t *data, size_t length, char *out)
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i < length; i += 3)
+    {
+        uint32_t group = (uint32_t)data[i] << 16;
+        if (i + 1 < length)
+            group |= data[i + 1] << 8;
+        if (i + 2 < length)
+            group |= data[i + 2];
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 0x3F];
+        *out++ = i + 1 < length ? alphabet[(group >> 6) & 0x3F] : '=';
+        *out++ = i + 2 < length ? alphabet[group & 0x3F] : '=';
+    }
+    *out = '\0';
+}
+
+static const char *statusText(int status)
+{
+    switch (status)
+    {
+    case 200:
+        return "OK";
+    case 206:
+        return "Partial Content";
+    case 304:
+        return "Not Modified";
+    case 400:
+        return "Bad Request";
+    case 404:
+        return "Not Found";
+    case 405:
+        return "Method Not Allowed";
+    case 409:
+        return "Conflict";
+    case 416:
+        return "Range Not Satisfiable";
+    case 431:
+        return "Request Header Fields Too Large";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return "Error";
+    }
+}
+
+/**
+ * @brief Finds a header of a request, ignoring the case of its name.
+ *
+ * @param length Set to the length of the value, which is not terminated.
+ * @return The value, without leading spaces, or NULL if the header is missing.
+ */
+const char *findHeader(const HttpRequest &request, const char *name, size_t *length)
+{
+    size_t nameLength = strlen(name);
+    for (const char *line = request.headers; *line != '\0';)
+    {
+        const char *end = strstr(line, "\r\n");
+        if (!end)
+            end = line + strlen(line);
+        if (strncasecmp(line, name, nameLength) == 0 && line[nameLength] == ':')
+        {
+            const char *value = line + nameLength + 1;
+            while (*value == ' ')
+                value++;
+            *length = end - value;
+            return value;
+        }
+        line = *end ? end + 2 : end;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Copies the value of a parameter of the query, as it is (not percent-decoded).
+ *
+ * @param size The size of value; a longer value is cut.
+ * @return true if the parameter is present.
+ */
+bool findParameter(const HttpRequest &request, const char *name, char *value, size_t size)
+{
+    size_t nameLength = strlen(name);
+    for (const char *field = request.query; *field != '\0';)
+    {
+        const char *end = strchr(field, '&');
+        if (!end)
+            end = field + strlen(field);
+        if (strncmp(field, name, nameLength) == 0 && field[nameLength] == '=')
+        {
+            size_t length = end - field - nameLength - 1;
+            if (length >= size)
+                length = size - 1;
+            memcpy(value, field + nameLength + 1, length);
+            value[length] = '\0';
+            return true;
+        }
+        field = *end ? end + 1 : end;
+    }
+    return false;
+}
+
+HttpServer::HttpServer()
+{
+    listener = -1;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+        clients[i].socket = -1;
+        clients[i].source = NULL;
+    }
+    routeCount = 0;
+    socketPath = NULL;
+    socketHandler = NULL;
+    droppedMessages = 0;
+    now = 0;
+    sourceRead = false;
+}
+
+/**
+ * @brief Starts listening on every interface.
+ *
+ * @return true on success, false if the port could not be opened.
+ */
+bool HttpServer::begin(uint16_t port)
+{
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0)
+        return false;
+
+    int yes = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(listener, HTTP_MAX_CLIENTS) != 0)
+    {
+        close(listener);
+        listener = -1;
+        return false;
+    }
+    setNonBlocking(listener);
+    return true;
+}
+
+/**
+ * @brief Serves GET requests for a path with a handler. Paths are matched exactly, without the query.
+ */
+void HttpServer::on(const char *path, HttpHandler handler)
+{
+    if (routeCount < HTTP_MAX_ROUTES)
+    {
+        routes[routeCount].path = path;
+        routes[routeCount].handler = handler;
+        routeCount++;
+    }
+}
+
+/**
+ * @brief Accepts WebSocket connections on a path.
+ */
+void HttpServer::onWebSocket(const char *path, WebSocketHandler handler)
+{
+    socketPath = path;
+    socketHandler = handler;
+}
+
+/**
+ * @brief Accepts new connections, reads requests and sends what the sockets take, without waiting.
+ *
+ * @param now The current time in milliseconds.
+ */
+void HttpServer::handleClients(uint32_t now)
+{
+    this->now = now;
+    sourceRead = false;
+    if (listener < 0)
+        return;
+
+    fd_set readable, writable;
+    FD_ZERO(&readable);
+    FD_ZERO(&writable);
+    FD_SET(listener, &readable);
+    int highest = listener;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+        HttpClient &client = clients[i];
+        if (client.socket < 0)
+            continue;
+        bool pending = client.queueEnd > client.queueStart || client.bodyLeft > 0 || client.source;
+        // A keep-alive connection is only read again once its response has gone out
+        if (client.state == WS_CONNECTED || (client.state == HTTP_READING && !pending))
+            FD_SET(client.socket, &readable);
+        if (pending)
+            FD_SET(client.socket, &writable);
+        if (client.socket > highest)
+            highest = client.socket;
+    }
+
+    struct timeval immediately = {0, 0};
+    if (select(highest + 1, &readable, &writable, NULL, &immediately) > 0)
+    {
+        if (FD_ISSET(listener, &readable))
+            acceptClient();
+        for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+        {
+            if (clients[i].socket >= 0 && FD_ISSET(clients[i].socket, &writable))
+                transmit(i);
+            if (clients[i].socket >= 0 && FD_ISSET(clients[i].socket, &readable))
+                receive(i);
+        }
+    }
+
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+        HttpClient &client = clients[i];
+        if (client.socket >= 0 && client.state != WS_CONNECTED && now - client.lastActivity > HTTP_IDLE_TIMEOUT)
+            disconnect(i);
+    }
+}
+
+/**
+ * @brief Takes the waiting connections, closing the oldest idle keep-alive one if all slots are used.
+ */
+void HttpServer::acceptClient()
+{
+    int socket;
+    while ((socket = accept(listener, NULL, NULL)) >= 0)
+    {
+        int slot = -1;
+        for (int i = 0; i < HTTP_MAX_CLIENTS && slot < 0; i++)
+        {
+            if (clients[i].socket < 0)
+                slot = i;
+        }
+        for (int i = 0; i < HTTP_MAX_CLIENTS && slot < 0; i++)
+        {
+            const HttpClient &client = clients[i];
+            if (client.state == HTTP_READING && client.received == 0 &&
+                client.queueEnd == client.queueStart && client.bodyLeft == 0 && !client.source &&
+                (slot < 0 || client.lastActivity < clients[slot].lastActivity))
+                slot = i;
+        }
+        if (slot < 0)
+        {
+            static const char busy[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            ::send(socket, busy, sizeof(busy) - 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+            close(socket);
+            continue;
+        }
+        if (clients[slot].socket >= 0)
+            disconnect(slot);
+
+        setNonBlocking(socket);
+        int yes = 1;
+        setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes)); // Small WebSocket messages go out at once
+
+        HttpClient &client = clients[slot];
+        client.socket = socket;
+        client.state = HTTP_READING;
+        client.lastActivity = now;
+        client.received = 0;
+        client.queueStart = client.queueEnd = 0;
+        client.body = NULL;
+        client.bodyLeft = 0;
+        client.source = NULL;
+        client.chunked = false;
+    }
+}
+
+/**
+ * @brief Reads from a client, handling the request or the WebSocket frames once they are complete.
+ */
+void HttpServer::receive(int index)
+{
+    HttpClient &client = clients[index];
+    ssize_t count = recv(client.socket, client.request + client.received, HTTP_REQUEST_SIZE - client.received, MSG_DONTWAIT);
+    if (count == 0 || (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        disconnect(index);
+        return;
+    }
+    if (count < 0)
+        return;
+    client.received += count;
+    client.request[client.received] = '\0';
+    client.lastActivity = now;
+
+    if (client.state == WS_CONNECTED)
+        receiveFrame(index);
+    else if (strstr(client.request, "\r\n\r\n"))
+        handleRequest(index);
+    else if (client.received == HTTP_REQUEST_SIZE)
+    {
+        client.state = HTTP_CLOSING;
+        sendText(index, 431, "text/plain", "Request too large\n");
+    }
+}
+
+/**
+ * @brief Sends the queue, then the attached body or source, until the socket would block.
+ */
+void HttpServer::transmit(int index)
+{
+    HttpClient &client = clients[index];
+    for (;;)
+    {
+        if (client.queueEnd == client.queueStart && client.bodyLeft == 0 &&
+            (!client.source || sourceRead || !refill(index)))
+            break;
+
+        bool queued = client.queueEnd > client.queueStart;
+        const uint8_t *data = queued ? client.queue + client.queueStart : client.body;
+        size_t length = queued ? client.queueEnd - client.queueStart : client.bodyLeft;
+        ssize_t sent = ::send(client.socket, data, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                disconnect(index);
+            return;
+        }
+        client.lastActivity = now;
+        if (queued)
+        {
+            client.queueStart += sent;
+            if (client.queueStart == client.queueEnd)
+                client.queueStart = client.queueEnd = 0;
+        }
+        else
+        {
+            client.body += sent;
+            client.bodyLeft -= sent;
+        }
+    }
+    if (client.socket >= 0 && client.state == HTTP_CLOSING && !client.source)
+        disconnect(index);
+}
+
+/**
+ * @brief Reads the next chunk of the attached source into the empty queue, framed if the response is chunked.
+ *
+ * @return true if bytes were queued, false if the body is over or was cut short, which closes the
+ * connection since the announced Content-Length can no longer be kept.
+ */
+bool HttpServer::refill(int index)
+{
+    HttpClient &client = clients[index];
+    sourceRead = true;
+    size_t size = HTTP_SOURCE_CHUNK;
+    if (client.sourceLeft != HTTP_CHUNKED && size > client.sourceLeft)
+        size = client.sourceLeft;
+    size_t framing = client.chunked ? 6 : 0; // Room for the size line, 4 hex digits at most
+    size_t produced = size > 0 ? client.source(index, client.queue + framing, size) : 0;
+
+    if (produced == 0)
+    {
+        bool complete = client.sourceLeft == 0 || client.sourceLeft == HTTP_CHUNKED;
+        release(index);
+        if (!complete)
+        {
+            disconnect(index);
+            return false;
+        }
+        return client.chunked && writeBody(index, "0\r\n\r\n", 5) == 5;
+    }
+
+    client.queueEnd = framing + produced;
+    if (client.chunked)
+    {
+        char line[8];
+        int length = snprintf(line, sizeof(line), "%x\r\n", (unsigned)produced);
+        client.queueStart = framing - length;
+        memcpy(client.queue + client.queueStart, line, length);
+        client.queue[client.queueEnd++] = '\r';
+        client.queue[client.queueEnd++] = '\n';
+    }
+    if (client.sourceLeft != HTTP_CHUNKED)
+    {
+        client.sourceLeft -= produced;
+        if (client.sourceLeft == 0)
+            release(index);
+    }
+    return true;
+}
+
+/**
+ * @brief Detaches the source of a client, letting it close what it holds.
+ */
+void HttpServer::release(int index)
+{
+    HttpBodySource source = clients[index].source;
+    if (!source)
+        return;
+    clients[index].source = NULL;
+    source(index, NULL, 0);
+}
+
+/**
+ * @brief Parses the request received by a client and answers it.
+ */
+void HttpServer::handleRequest(int index)
+{
+    HttpClient &client = clients[index];
+    HttpRequest request;
+    char *line = client.request;
+    char *version = NULL;
+    request.method = line;
+
+    // The spaces are looked for in the request line only, not in the headers or past them
+    char *end = strstr(line, "\r\n");
+    char *space = NULL;
+    if (end)
+    {
+        *end = '\0';
+        request.headers = end + 2;
+        space = strchr(line, ' ');
+    }
+    if (space)
+    {
+        *space = '\0';
+        request.path = space + 1;
+        space = strchr(space + 1, ' ');
+    }
+    if (space)
+    {
+        *space = '\0';
+        version = space + 1;
+    }
+    client.received = 0;
+    if (!version || version[0] == '\0' || request.path[0] != '/')
+    {
+        client.state = HTTP_CLOSING;
+        sendText(index, 400, "text/plain", "Bad request\n");
+        transmit(index);
+        return;
+    }
+
+    char *query = strchr((char *)request.path, '?');
+    if (query)
+        *query++ = '\0';
+    request.query = query ? query : "";
+
+    size_t length;
+    const char *connection = findHeader(request, "Connection", &length);
+    bool closing = strcmp(version, "HTTP/1.1") != 0 || (connection && strncasecmp(connection, "close", 5) == 0);
+    client.state = closing ? HTTP_CLOSING : HTTP_READING;
+
+    if (strcmp(request.method, "GET") != 0)
+        sendText(index, 405, "text/plain", "Only GET is supported\n");
+    else if (socketPath && strcmp(request.path, socketPath) == 0)
+        upgrade(index, request);
+    else
+    {
+        int route = 0;
+        while (route < routeCount && strcmp(routes[route].path, request.path) != 0)
+            route++;
+        if (route < routeCount)
+            routes[route].handler(*this, index, request);
+        else
+            sendText(index, 404, "text/plain", "Not found\n");
+    }
+    transmit(index);
+}
+
+/**
+ * @brief Completes the WebSocket handshake of a request.
+ */
+void HttpServer::upgrade(int index, const HttpRequest &request)
+{
+    size_t length;
+    const char *key = findHeader(request, "Sec-WebSocket-Key", &length);
+    if (!key || length == 0 || length > 64)
+    {
+        clients[index].state = HTTP_CLOSING;
+        sendText(index, 400, "text/plain", "Not a WebSocket request\n");
+        return;
+    }
+
+    uint8_t concatenated[100];
+    uint8_t digest[20];
+    char encoded[32];
+    memcpy(concatenated, key, length);
+    memcpy(concatenated + length, WS_GUID, 36);
+    sha1(concatenated, length + 36, digest);
+    base64(digest, sizeof(digest), encoded);
+
+    char response[160];
+    int size = snprintf(response, sizeof(response),
+                        "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                        "Sec-WebSocket-Accept: %s\r\n\r\n",
+                        encoded);
+    writeBody(index, response, size);
+    clients[index].state = WS_CONNECTED;
+    if (socketHandler)
+        socketHandler(*this, index, WS_OPEN, NULL, 0);
+}
+
+/**
+ * @brief Handles the complete frames received from a WebSocket client.
+ *
+ * Only the short, unfragmented messages a browser sends to control the logger are accepted;
+ * anything else closes the connection.
+ */
+void HttpServer::receiveFrame(int index)
+{
+    HttpClient &client = clients[index];
+    uint8_t *data = (uint8_t *)client.request;
+    while (client.socket >= 0 && client.received >= 2)
+    {
+        uint8_t opcode = data[0] & 0x0F;
+        size_t length = data[1] & 0x7F;
+        size_t header = 2;
+        if (length == 126)
+        {
+            if (client.received < 4)
+                return;
+            length = data[2] << 8 | data[3];
+            header = 4;
+        }
+        // Length code 127 announces a 64-bit length, far past WS_MAX_MESSAGE
+        if (!(data[0] & 0x80) || !(data[1] & 0x80) || (data[1] & 0x7F) == 127 || length > WS_MAX_MESSAGE)
+        {
+            disconnect(index);
+            return;
+        }
+        if (client.received < header + 4 + length)
+            return;
+
+        uint8_t *mask = data + header;
+        uint8_t *payload = mask + 4;
+        for (size_t i = 0; i < length; i++)
+            payload[i] ^= mask[i % 4];
+
+        switch (opcode)
+        {
+        case WS_TEXT:
+        case WS_BINARY:
+            if (socketHandler)
+                socketHandler(*this, index, WS_MESSAGE, payload, length);
+            break;
+        case WS_PING:
+            queueFrame(index, WS_PONG, payload, length);
+            break;
+        case WS_CLOSE_FRAME:
+            queueFrame(index, WS_CLOSE_FRAME, payload, length < 2 ? length : 2);
+            if (socketHandler)
+                socketHandler(*this, index, WS_CLOSE, NULL, 0);
+            client.state = HTTP_CLOSING;
+            client.received = 0;
+            return;
+        default:
+            break;
+        }
+
+        size_t frame = header + 4 + length;
+        memmove(data, data + frame, client.received - frame);
+        client.received -= frame;
+    }
+}
+
+/**
+ * @brief Appends an unmasked, unfragmented frame to the queue of a client if it fits whole.
+ */
+bool HttpServer::queueFrame(int index, uint8_t opcode, const uint8_t *data, size_t length)
+{
+    uint8_t header[4];
+    size_t headerLength = 2;
+    header[0] = 0x80 | opcode;
+    if (length < 126)
+        header[1] = (uint8_t)length;
+    else
+    {
+        header[1] = 126;
+        header[2] = (uint8_t)(length >> 8);
+        header[3] = (uint8_t)length;
+        headerLength = 4;
+    }
+
+    const HttpClient &client = clients[index];
+    if (length > 0xFFFF || HTTP_QUEUE_SIZE - (client.queueEnd - client.queueStart) < headerLength + length)
+        return false;
+    writeBody(index, header, headerLength);
+    writeBody(index, data, length);
+    return true;
+}
+
+/**
+ * @brief Closes a connection and frees its slot.
+ */
+void HttpServer::disconnect(int index)
+{
+    HttpClient &client = clients[index];
+    if (client.state == WS_CONNECTED && socketHandler)
+        socketHandler(*this, index, WS_CLOSE, NULL, 0);
+    release(index);
+    close(client.socket);
+    client.socket = -1;
+}
+
+/**
+ * @brief Queues the status line and headers of a response. Content-Length and Connection are added here.
+ *
+ * @param type The Content-Type, or NULL for a 304 response, which has no body.
+ * @param length The length of the body, or HTTP_CHUNKED to send it in chunks. A connection that
+ * closes after the response gets it unframed instead, ended by the close (HTTP/1.0 clients).
+ * @param headers Extra header lines, each ending with "\r\n", or NULL.
+ * @return true if they fit in the queue.
+ */
+bool HttpServer::respond(int client, int status, const char *type, size_t length, const char *headers)
+{
+    char response[384];
+    char entity[128] = "";
+    HttpClient &target = clients[client];
+    target.chunked = type && length == HTTP_CHUNKED && target.state != HTTP_CLOSING;
+    if (target.chunked)
+        snprintf(entity, sizeof(entity), "Content-Type: %s\r\nTransfer-Encoding: chunked\r\n", type);
+    else if (type && length == HTTP_CHUNKED)
+        snprintf(entity, sizeof(entity), "Content-Type: %s\r\n", type);
+    else if (type)
+        snprintf(entity, sizeof(entity), "Content-Type: %s\r\nContent-Length: %lu\r\n", type, (unsigned long)length);
+    int size = snprintf(response, sizeof(response), "HTTP/1.1 %d %s\r\n%sConnection: %s\r\n%s\r\n",
+                        status, statusText(status), entity,
+                        target.state == HTTP_CLOSING ? "close" : "keep-alive", headers ? headers : "");
+    if (size >= (int)sizeof(response))
+        return false;
+    return writeBody(client, response, size) == (size_t)size;
+}
+
+/**
+ * @brief Copies bytes to the queue of a client.
+ *
+ * @return The number of bytes that fit.
+ */
+size_t HttpServer::writeBody(int index, const void *data, size_t length)
+{
+    HttpClient &client = clients[index];
+    if (client.queueEnd + length > HTTP_QUEUE_SIZE && client.queueStart > 0)
+    {
+        memmove(client.queue, client.queue + client.queueStart, client.queueEnd - client.queueStart);
+        client.queueEnd -= client.queueStart;
+        client.queueStart = 0;
+    }
+    if (length > HTTP_QUEUE_SIZE - client.queueEnd)
+        length = HTTP_QUEUE_SIZE - client.queueEnd;
+    memcpy(client.queue + client.queueEnd, data, length);
+    client.queueEnd += length;
+    return length;
+}
+
+/**
+ * @brief Sends a body straight from memory after the queue, without copying it.
+ *
+ * @param data Must stay valid until it has been sent: a constant, such as a web asset.
+ */
+void HttpServer::attach(int index, const uint8_t *data, size_t length)
+{
+    clients[index].body = data;
+    clients[index].bodyLeft = length;
+}
+
+/**
+ * @brief Sends a body produced by a source as the socket takes it, see HttpBodySource.
+ *
+ * @param length The length announced to respond(), or HTTP_CHUNKED.
+ */
+void HttpServer::attach(int index, HttpBodySource source, size_t length)
+{
+    clients[index].source = source;
+    clients[index].sourceLeft = length;
+}
+
+/**
+ * @brief Answers with a short text.
+ */
+void HttpServer::sendText(int client, int status, const char *type, const char *text)
+{
+    size_t length = strlen(text);
+    if (respond(client, status, type, length))
+        writeBody(client, text, length);
+}
+
+/**
+ * @brief Answers with a gzipped web asset sent straight from flash, or with 304 if the browser has it.
+ *
+ * The asset is sent gzipped whatever the Accept-Encoding: every browser takes it.
+ */
+void HttpServer::sendAsset(int client, const HttpRequest &request, const WebAsset &asset)
+{
+    char headers[160];
+    snprintf(headers, sizeof(headers), "ETag: %s\r\nCache-Control: %s\r\nContent-Encoding: gzip\r\n",
+             asset.etag, asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+
+    size_t length;
+    const char *match = findHeader(request, "If-None-Match", &length);
+    size_t etagLength = strlen(asset.etag);
+    for (size_t i = 0; match && i + etagLength <= length; i++)
+    {
+        if (memcmp(match + i, asset.etag, etagLength) == 0)
+        {
+            respond(client, 304, NULL, 0, headers);
+            return;
+        }
+    }
+    if (respond(client, 200, asset.type, asset.length, headers))
+        attach(client, asset.data, asset.length);
+}
+
+/**
+ * @brief Queues a binary WebSocket message for one client, or drops it whole if the queue is too full.
+ *
+ * @return true if it was queued.
+ */
+bool HttpServer::sendMessage(int client, const uint8_t *data, size_t length)
+{
+    if (clients[client].socket < 0 || clients[client].state != WS_CONNECTED)
+        return false;
+    if (!queueFrame(client, WS_BINARY, data, length))
+    {
+        droppedMessages++;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Queues a binary WebSocket message for every connected client.
+ *
+ * @return The number of clients it was queued for.
+ */
+uint8_t HttpServer::broadcast(const uint8_t *data, size_t length)
+{
+    uint8_t count = 0;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+        if (sendMessage(i, data, length))
+            count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Returns the number of open WebSocket connections.
+ */
+uint8_t HttpServer::getSocketCount() const
+{
+    uint8_t count = 0;
+    for (int i = 0; i < HTTP_MAX_CLIENTS; i++)
+    {
+        if (clients[i].socket >= 0 && clients[i].state == WS_CONNECTED)
+            count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Returns the number of WebSocket messages dropped because a client was not keeping up.
+ */
+uint32_t HttpServer::getDroppedMessages() const
+{
+    return droppedMessages;
+}
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+Converts the full-screen PNGs in bitmap_display_png/ into run-length encoded,
+page-ordered assets for the SSD1306 (see include/bitmap_rle.h).
+
+The PNG is thresholded on luminance (>= 128 is a lit pixel, the same rule
+image2cpp used for the original PROGMEM arrays), transposed into the SSD1306
+framebuffer layout (8 pages of 128 columns, bit 0 = top row of the page) and
+run-length encoded. Every asset is decoded again before it is written and the
+script fails if the result is not bit-identical to the source image.
+
+Usage:
+    python3 tools/bitmap_rle.py            # regenerate src/bitmap_assets.cpp
+    python3 tools/bitmap_rle.py --check    # only verify, do not write
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+SCREEN_WIDTH = 128
+SCREEN_HEIGHT = 64
+FRAME_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT // 8
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), '..'))
+PNG_DIR = os.path.join(ROOT, 'bitmap_display_png')
+OUTPUT = os.path.join(ROOT, 'src', 'bitmap_assets.cpp')
+
+# PNG file name -> asset name used by view.cpp
+ASSETS = [
+    ('Menu_1', 'rle_Menu_1'),
+    ('Menu_2', 'rle_Menu_2'),
+    ('Menu_3', 'rle_Menu_3'),
+    ('Menu_4', 'rle_Menu_4'),
+    ('Menu_5', 'rle_Menu_5'),
+    ('Output_mode', 'rle_Output_mode'),
+    ('Input_mode', 'rle_Input_mode'),
+    ('sample_rate_set', 'rle_sample_rate_set'),
+    ('logger', 'rle_logger'),
+    ('error_sdcard', 'rle_error_sdcard'),
+    ('error_serial', 'rle_error_serial'),
+    ('waiting_serial', 'rle_waiting_serial'),
+]
+
+# Token layout, must match rleDecode() in src/bitmap_rle.cpp
+LITERAL_MAX = 128  # 0x00..0x7F: copy the next (c + 1) bytes
+REPEAT_MIN = 2     # 0x80..0xFF: repeat the next byte (c - 0x80 + 2) times
+REPEAT_MAX = 129
+
+
+def read_png(path):
+    """Decodes an 8-bit, non-interlaced greyscale/RGB(A) PNG into rows of luminance."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, = struct.unpack('>I', data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+
+    if depth != 8 or interlace != 0 or color not in (0, 2, 4, 6):
+        raise ValueError('%s: unsupported PNG format' % path)
+
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}[color]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    previous = bytearray(stride)
+    rows = []
+    offset = 0
+    for _ in range(height):
+        filter_type = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = previous[x]
+            c = previous[x - channels] if x >= channels else 0
+            if filter_type == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif filter_type == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif filter_type == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif filter_type == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + predictor) & 0xFF
+        previous = line
+
+        luminance = []
+        for x in range(width):
+            pixel = line[x * channels:(x + 1) * channels]
+            if channels >= 3:
+                luminance.append((pixel[0] * 299 + pixel[1] * 587 + pixel[2] * 114) // 1000)
+            else:
+                luminance.append(pixel[0])
+        rows.append(luminance)
+    return width, height, rows
+
+
+def to_pages(width, height, rows):
+    """Packs the image into the SSD1306 framebuffer layout."""
+    if (width, height) != (SCREEN_WIDTH, SCREEN_HEIGHT):
+        raise ValueError('only %dx%d images are supported' % (SCREEN_WIDTH, SCREEN_HEIGHT))
+    frame = bytearray(FRAME_SIZE)
+    for page in range(SCREEN_HEIGHT // 8):
+        for x in range(SCREEN_WIDTH):
+            byte = 0
+            for bit in range(8):
+                if rows[page * 8 + bit][x] >= 128:
+                    byte |= 1 << bit
+            frame[page * SCREEN_WIDTH + x] = byte
+    return bytes(frame)
+
+
+def encode(frame):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:LITERAL_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:LITERAL_MAX]
+
+    i = 0
+    while i < len(frame):
+        run = 1
+        while i + run < len(frame) and frame[i + run] == frame[i] and run < REPEAT_MAX:
+            run += 1
+        if run >= REPEAT_MIN + 1 or (run == REPEAT_MIN and not literal):
+            flush_literal()
+            out.append(0x80 + run - REPEAT_MIN)
+            out.append(frame[i])
+        else:
+            literal.extend(frame[i:i + run])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def decode(data, size=FRAME_SIZE):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        token = data[i]
+        i += 1
+        if token < 0x80:
+            out.extend(data[i:i + token + 1])
+            i += token + 1
+        else:
+            out.extend(bytes([data[i]]) * (token - 0x80 + REPEAT_MIN))
+            i += 1
+    if len(out) != size or i != len(data):
+        raise ValueError('stream length mismatch')
+    return bytes(out)
+
+
+def emit(assets):
+    lines = [
+        '// Generated by tools/bitmap_rle.py from bitmap_display_png/, do not edit.',
+        '#include "../include/bitmap_rle.h"',
+        '',
+    ]
+    for png, name, data in assets:
+        lines.append("// '%s', %dx%dpx, %d bytes (%d uncompressed)" %
+                     (png, SCREEN_WIDTH, SCREEN_HEIGHT, len(data), FRAME_SIZE))
+        lines.append('const unsigned char %s[] PROGMEM = {' % name)
+        for row in range(0, len(data), 16):
+            chunk = ', '.join('0x%02x' % b for b in data[row:row + 16])
+            end = '};' if row + 16 >= len(data) else ','
+            lines.append('    ' + chunk + end)
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--check', action='store_true', help='verify only, do not write the output file')
+    args = parser.parse_args()
+
+    assets = []
+    total = 0
+    for png, name in ASSETS:
+        frame = to_pages(*read_png(os.path.join(PNG_DIR, png + '.png')))
+        data = encode(frame)
+        if decode(data) != frame:
+            sys.exit('%s: decoded asset is not bit-identical to the source image' % png)
+        assets.append((png, name, data))
+        total += len(data)
+        print('%-16s %5d -> %4d bytes' % (png, FRAME_SIZE, len(data)))
+    print('total            %5d -> %4d bytes' % (FRAME_SIZE * len(assets), total))
+
+    if not args.check:
+        with open(OUTPUT, 'w') as f:
+            f.write(emit(assets))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,115 @@
+// adccheck: checks the tables of the ADS1115 (ads1115.h) against the conversions the logger
+// used before them.
+//
+//   adccheck
+//   For every channel and gain of ADC_CONVERSIONS, compares convert() and the curve() it
+//   compiles its tables from with the formulas of the first firmware, written out below with
+//   their own constants, over the whole range of counts. Checks adcRateIndex() on the rates of
+//   the ADC and on rates it does not have. Prints every failure and exits with 1 if there is one.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "../../include/ads1115.h"
+
+// The constants of the first firmware (controller.h), not those of ads1115.h
+static const float baselineFullScale[] = {6.144f, 4.096f, 2.048f, 1.024f, 0.512f, 0.256f}; // GAIN_TWOTHIRDS to GAIN_SIXTEEN
+static const float FACTOR_V = 4.334335237;
+static const float FACTOR_I = 30;
+static const float FACTOR_R = 999;
+static const float multiplier_V = 0.0001875; // The volts of a count at the default gain of each channel
+static const float multiplier_I = 0.00003125;
+static const float multiplier_R = 0.000125;
+
+static int failures;
+
+/**
+ * @brief The conversion of the first firmware (conversionMeasurement()), for a gain.
+ *
+ * @param counts The mean of the counts of a window, or for the current the RMS.
+ */
+static double baselineConversion(uint8_t channel, uint8_t gain, double counts)
+{
+    double K_value = baselineFullScale[gain] / 32768.0;
+    switch (channel)
+    {
+    case 0:
+        return counts * K_value * FACTOR_V;
+    case 1:
+        return counts * K_value * FACTOR_I;
+    default:
+        return FACTOR_R * 3.3 / (counts * K_value) - FACTOR_R;
+    }
+}
+
+static void expect(bool passed, const char *what, uint8_t channel, uint8_t gain, double counts, double got, double expected)
+{
+    if (passed)
+        return;
+    if (failures++ < 20)
+        printf("FAIL: %s of %s at gain %u, %.3f counts: %.9g instead of %.9g\n", what, ADC_CHANNELS[channel].name,
+               gain, counts, got, expected);
+}
+
+/**
+ * @brief Compares in single precision: for the resistance, relative to FACTOR_R too, which is
+ * subtracted from the quotient and leaves its rounding error in small values.
+ */
+static bool matches(double got, double expected, uint8_t channel)
+{
+    return fabs(got - expected) <= 2e-6 * (fabs(expected) + (channel == 2 ? FACTOR_R : 0)) + 1e-9;
+}
+
+int main()
+{
+    unsigned compared = 0;
+
+    // The default gains give the multipliers of the first firmware
+    const float multipliers[] = {multiplier_V, multiplier_I, multiplier_R};
+    for (uint8_t channel = 0; channel < ADC_CHANNEL_COUNT; channel++)
+    {
+        double lsb = adcLsb(ADC_CHANNELS[channel].gain);
+        expect(matches(lsb, multipliers[channel], 0), "volts of a count at the default gain", channel,
+               ADC_CHANNELS[channel].gain, 1, lsb, multipliers[channel]);
+    }
+
+    for (uint8_t channel = 0; channel < ADC_CHANNEL_COUNT; channel++)
+    {
+        for (uint8_t gain = 0; gain < ADC_GAIN_COUNT; gain++)
+        {
+            const AdcConversionEntry &entry = ADC_CONVERSIONS[channel][gain];
+            CalibrationCurve curve = entry.curve();
+            for (int32_t sample = -32768; sample <= 32767; sample += 7)
+            {
+                // Whole counts, and means between them; the resistance is only defined above 0
+                for (double counts = sample; counts < sample + 1; counts += 0.375)
+                {
+                    if (channel == 2 && counts <= 0)
+                        continue;
+                    double expected = baselineConversion(channel, gain, counts);
+                    double converted = entry.convert((float)counts);
+                    double evaluated = evaluateCurve(curve, (float)counts);
+                    expect(matches(converted, expected, channel), "convert()", channel, gain, counts, converted, expected);
+                    expect(matches(evaluated, expected, channel), "curve()", channel, gain, counts, evaluated, expected);
+                    compared++;
+                }
+            }
+        }
+    }
+
+    // The index of every rate of the ADC, and -1 for the others
+    for (uint8_t i = 0; i < ADC_RATE_COUNT; i++)
+    {
+        if (adcRateIndex(ADC_RATES[i].samples) != i && failures++ < 20)
+            printf("FAIL: adcRateIndex(%u) is %d instead of %u\n", ADC_RATES[i].samples, adcRateIndex(ADC_RATES[i].samples), i);
+    }
+    const int invalidRates[] = {-1, 0, 1, 7, 9, 100, 475 + 65536, 500, 859, 861, 1000, 65535};
+    for (size_t i = 0; i < sizeof(invalidRates) / sizeof(invalidRates[0]); i++)
+    {
+        if (adcRateIndex(invalidRates[i]) != -1 && failures++ < 20)
+            printf("FAIL: adcRateIndex(%d) is %d instead of -1\n", invalidRates[i], adcRateIndex(invalidRates[i]));
+    }
+
+    printf("%u conversions compared, %d failures\n", compared, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+// bitmapcheck: checks the run-length encoded screens (bitmap_rle.h) against the bitmaps they
+// were made from.
+//
+//   bitmapcheck [directory]
+//   Decodes every full-screen asset of src/bitmap_assets.cpp with rleDecode(), as drawScreenAsset()
+//   does, and compares each pixel of the page buffer with the PNG of bitmap_display_png/ (or of
+//   `directory`), thresholded at a luminance of 128 as tools/bitmap_rle.py and image2cpp do. Also
+//   checks that the decoder writes nothing past the frame and that a shorter decode gives the
+//   start of the same frame. Prints every failure and exits with 1 if there is one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+#include "../../include/bitmap_rle.h"
+
+#ifndef BITMAP_DIRECTORY
+#define BITMAP_DIRECTORY "../../bitmap_display_png"
+#endif
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define GUARD_SIZE 64
+#define GUARD_BYTE 0xA5
+
+// The assets of view.cpp and the PNG each was generated from (the table of tools/bitmap_rle.py)
+static const struct
+{
+    const char *png;
+    const unsigned char *asset;
+} screens[] = {
+    {"Menu_1", rle_Menu_1},
+    {"Menu_2", rle_Menu_2},
+    {"Menu_3", rle_Menu_3},
+    {"Menu_4", rle_Menu_4},
+    {"Menu_5", rle_Menu_5},
+    {"Output_mode", rle_Output_mode},
+    {"Input_mode", rle_Input_mode},
+    {"sample_rate_set", rle_sample_rate_set},
+    {"logger", rle_logger},
+    {"error_sdcard", rle_error_sdcard},
+    {"error_serial", rle_error_serial},
+    {"waiting_serial", rle_waiting_serial},
+};
+
+static int failures;
+
+static void fail(const char *name, const char *what)
+{
+    if (failures++ < 20)
+        printf("FAIL: %s: %s\n", name, what);
+}
+
+static uint32_t readBigEndian(const uint8_t *p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+/**
+ * @brief Reads an 8-bit, non-interlaced greyscale or RGB(A) PNG as rows of luminance.
+ *
+ * @return False if the file cannot be read or has another format.
+ */
+static bool readPng(const std::string &path, uint32_t &width, uint32_t &height, std::vector<uint8_t> &luminance)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + read);
+    fclose(file);
+
+    if (data.size() < 8 || memcmp(data.data(), "\x89PNG\r\n\x1a\n", 8) != 0)
+        return false;
+
+    std::vector<uint8_t> idat;
+    uint8_t depth = 0, color = 0, interlace = 1;
+    width = height = 0;
+    for (size_t pos = 8; pos + 12 <= data.size();)
+    {
+        uint32_t length = readBigEndian(&data[pos]);
+        if (length > data.size() - pos - 12)
+            return false;
+        const uint8_t *kind = &data[pos + 4], *body = &data[pos + 8];
+        if (memcmp(kind, "IHDR", 4) == 0 && length >= 13)
+        {
+            width = readBigEndian(body);
+            height = readBigEndian(body + 4);
+            depth = body[8];
+            color = body[9];
+            interlace = body[12];
+        }
+        else if (memcmp(kind, "IDAT", 4) == 0)
+        {
+            idat.insert(idat.end(), body, body + length);
+        }
+        pos += 12 + length;
+    }
+
+    size_t channels = color == 0 ? 1 : color == 2 ? 3 : color == 4 ? 2 : color == 6 ? 4 : 0;
+    if (depth != 8 || interlace != 0 || channels == 0 || width == 0 || height == 0)
+        return false;
+
+    size_t stride = width * channels;
+    std::vector<uint8_t> raw(height * (stride + 1));
+    uLongf rawSize = raw.size();
+    if (uncompress(raw.data(), &rawSize, idat.data(), idat.size()) != Z_OK || rawSize != raw.size())
+        return false;
+
+    // Undo the filter of each row against the previous one
+    std::vector<uint8_t> previous(stride), line(stride);
+    luminance.assign(width * height, 0);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t filter = raw[y * (stride + 1)];
+        memcpy(line.data(), &raw[y * (stride + 1) + 1], stride);
+        for (size_t x = 0; x < stride; x++)
+        {
+            int a = x >= channels ? line[x - channels] : 0;
+            int b = previous[x];
+            int c = x >= channels ? previous[x - channels] : 0;
+            int predictor = 0;
+            switch (filter)
+            {
+            case 1:
+                predictor = a;
+                break;
+            case 2:
+                predictor = b;
+                break;
+            case 3:
+                predictor = (a + b) >> 1;
+                break;
+            case 4:
+            {
+                int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+                predictor = pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+                break;
+            }
+            }
+            line[x] = (uint8_t)(line[x] + predictor);
+        }
+        previous = line;
+
+        for (uint32_t x = 0; x < width; x++)
+        {
+            const uint8_t *pixel = &line[x * channels];
+            luminance[y * width + x] = channels >= 3 ? (pixel[0] * 299 + pixel[1] * 587 + pixel[2] * 114) / 1000 : pixel[0];
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [directory]\n", argv[0]);
+        return 2;
+    }
+    std::string directory = argc > 1 ? argv[1] : BITMAP_DIRECTORY;
+
+    size_t compressed = 0;
+    for (size_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++)
+    {
+        const char *name = screens[i].png;
+        uint32_t width, height;
+        std::vector<uint8_t> luminance;
+        if (!readPng(directory + "/" + name + ".png", width, height, luminance))
+        {
+            fail(name, "cannot read the PNG");
+            continue;
+        }
+        if (width != SCREEN_WIDTH || height != SCREEN_HEIGHT)
+        {
+            fail(name, "the PNG is not 128x64");
+            continue;
+        }
+
+        // The frame, followed by a guard the decoder must not touch
+        uint8_t frame[RLE_FRAME_SIZE + GUARD_SIZE];
+        memset(frame, GUARD_BYTE, sizeof(frame));
+        size_t consumed = rleDecode(screens[i].asset, frame, RLE_FRAME_SIZE);
+        compressed += consumed;
+        for (size_t j = RLE_FRAME_SIZE; j < sizeof(frame); j++)
+        {
+            if (frame[j] != GUARD_BYTE)
+            {
+                fail(name, "decoded past the frame");
+                break;
+            }
+        }
+
+        // Page order of the SSD1306: byte page * 128 + x, bit 0 at the top of the page
+        unsigned wrong = 0;
+        for (uint32_t y = 0; y < SCREEN_HEIGHT; y++)
+        {
+            for (uint32_t x = 0; x < SCREEN_WIDTH; x++)
+            {
+                bool lit = frame[y / 8 * SCREEN_WIDTH + x] >> (y % 8) & 1;
+                wrong += lit != (luminance[y * SCREEN_WIDTH + x] >= 128);
+            }
+        }
+        if (wrong)
+        {
+            char what[64];
+            snprintf(what, sizeof(what), "%u pixels differ from the PNG", wrong);
+            fail(name, what);
+        }
+
+        // A partial decode stops inside the frame and matches its start
+        for (size_t size = 1; size < RLE_FRAME_SIZE; size += 37)
+        {
+            uint8_t partial[RLE_FRAME_SIZE + GUARD_SIZE];
+            memset(partial, GUARD_BYTE, sizeof(partial));
+            size_t used = rleDecode(screens[i].asset, partial, size);
+            if (used > consumed || memcmp(partial, frame, size) != 0 || partial[size] != GUARD_BYTE)
+            {
+                fail(name, "a partial decode differs from the frame");
+                break;
+            }
+        }
+    }
+
+    size_t count = sizeof(screens) / sizeof(screens[0]);
+    printf("%zu screens, %zu bytes for %zu, %d failures\n", count, compressed, count * RLE_FRAME_SIZE, failures);
+    return failures ? 1 : 0;
+}
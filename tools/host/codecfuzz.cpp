@@ -0,0 +1,179 @@
+// codecfuzz: round-trip fuzz test of the sample codec (codec.h).
+//
+//   codecfuzz [iterations] [seed]
+//   Encodes `iterations` random blocks (300000 by default) of noise, slow ramps, sines and
+//   extreme values, and checks that each one decodes to the same samples, that it is refused
+//   by a destination one sample too small and once truncated, and that corrupted copies and
+//   random bytes are either refused or decoded within the destination. Prints the encoded size
+//   of each shape as a fraction of its raw size. Every buffer is on the
+//   heap at its exact size, so that the sanitizers the target is built with
+//   (-fsanitize=address,undefined) catch any access past its end. Exits with 1 on a failure.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../include/codec.h"
+
+#define SHAPE_COUNT 5
+
+static const char *const shapeNames[SHAPE_COUNT] = {"noise", "ramp", "sine", "constant", "extremes"};
+
+static uint32_t state;
+static unsigned long failures;
+
+/**
+ * @brief xorshift32, so that a failing seed can be replayed on any host.
+ */
+static uint32_t random32()
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static uint32_t randomBelow(uint32_t limit)
+{
+    return random32() % limit;
+}
+
+static void fail(unsigned long iteration, const char *what)
+{
+    if (failures++ < 20)
+        fprintf(stderr, "iteration %lu: %s\n", iteration, what);
+}
+
+/**
+ * @brief Fills a block with one of the shapes the logger sees, or with the worst cases of the codec.
+ *
+ * @return The index of the shape in shapeNames.
+ */
+static unsigned fillBlock(int16_t *samples, uint16_t count)
+{
+    int32_t level = (int32_t)randomBelow(65536) - 32768;
+    uint32_t noise = 1 + randomBelow(1 << randomBelow(17));
+    double frequency = randomBelow(1000) / 2000.0, amplitude = randomBelow(32768);
+
+    unsigned shape = randomBelow(SHAPE_COUNT);
+    switch (shape)
+    {
+    case 0: // Full-scale noise, which the codec keeps verbatim
+        for (uint16_t i = 0; i < count; i++)
+            samples[i] = (int16_t)random32();
+        break;
+    case 1: // A slow ramp with some noise, wrapping at the ends of the range
+        for (uint16_t i = 0; i < count; i++)
+        {
+            level += (int32_t)randomBelow(2 * noise + 1) - (int32_t)noise;
+            samples[i] = (int16_t)(uint16_t)level;
+        }
+        break;
+    case 2: // A sine with noise
+        for (uint16_t i = 0; i < count; i++)
+        {
+            double value = amplitude * sin(2 * M_PI * frequency * i) + (int32_t)randomBelow(2 * noise + 1) - (int32_t)noise;
+            samples[i] = (int16_t)(value > 32767 ? 32767 : value < -32768 ? -32768 : value);
+        }
+        break;
+    case 3: // A constant
+        for (uint16_t i = 0; i < count; i++)
+            samples[i] = (int16_t)level;
+        break;
+    default: // Jumps between the extremes: the largest second-order residuals, always escaped
+        for (uint16_t i = 0; i < count; i++)
+            samples[i] = randomBelow(2) ? INT16_MAX : INT16_MIN;
+        break;
+    }
+    return shape;
+}
+
+/**
+ * @brief Decodes a copy of the data on the heap at its exact size.
+ */
+static int decodeCopy(const uint8_t *data, size_t length, int16_t *samples, uint16_t capacity)
+{
+    uint8_t *copy = (uint8_t *)malloc(length ? length : 1);
+    memcpy(copy, data, length);
+    int count = decodeBlock(copy, length, samples, capacity);
+    free(copy);
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = argc > 1 ? strtoul(argv[1], NULL, 10) : 300000;
+    state = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+    if (argc > 3 || iterations == 0 || state == 0)
+    {
+        fprintf(stderr, "usage: %s [iterations] [seed]\n", argv[0]);
+        return 2;
+    }
+
+    unsigned long encoded[SHAPE_COUNT] = {0}, compressed[SHAPE_COUNT] = {0}, blocks[SHAPE_COUNT] = {0};
+    unsigned long corruptedAccepted = 0;
+    for (unsigned long iteration = 0; iteration < iterations; iteration++)
+    {
+        uint16_t count = 1 + randomBelow(CODEC_BLOCK_SAMPLES);
+        int16_t *samples = (int16_t *)malloc(count * sizeof(int16_t));
+        int16_t *decoded = (int16_t *)malloc(count * sizeof(int16_t));
+        uint8_t *block = (uint8_t *)malloc(CODEC_MAX_SIZE);
+        unsigned shape = fillBlock(samples, count);
+
+        // Round trip
+        size_t length = encodeBlock(samples, count, block);
+        if (length < CODEC_HEADER_SIZE || length > CODEC_MAX_SIZE)
+            fail(iteration, "encoded size out of range");
+        else if (decodeCopy(block, length, decoded, count) != count ||
+                 memcmp(samples, decoded, count * sizeof(int16_t)) != 0)
+            fail(iteration, "round trip changed the samples");
+        blocks[shape]++;
+        encoded[shape] += 2 * count;
+        compressed[shape] += length;
+
+        // A destination too small, and a truncated block
+        if (count > 1 && decodeCopy(block, length, decoded, count - 1) != -1)
+            fail(iteration, "decoded past the capacity");
+        if (decodeCopy(block, randomBelow(length), decoded, count) != -1)
+            fail(iteration, "decoded a truncated block");
+
+        // Corrupted bits or bytes: refused, or samples within the destination
+        size_t flips = 1 + randomBelow(4);
+        for (size_t i = 0; i < flips; i++)
+        {
+            size_t at = randomBelow(length);
+            block[at] ^= randomBelow(2) ? (uint8_t)(1 << randomBelow(8)) : (uint8_t)random32();
+        }
+        int result = decodeCopy(block, length, decoded, count);
+        if (result != -1 && (result < 1 || result > count))
+            fail(iteration, "corrupted block decoded out of range");
+        corruptedAccepted += result != -1;
+
+        // Random bytes
+        size_t garbage = randomBelow(CODEC_MAX_SIZE + 8);
+        for (size_t i = 0; i < garbage && i < CODEC_MAX_SIZE; i++)
+            block[i] = (uint8_t)random32();
+        result = decodeCopy(block, garbage < CODEC_MAX_SIZE ? garbage : CODEC_MAX_SIZE, decoded, count);
+        if (result != -1 && (result < 1 || result > count))
+            fail(iteration, "random bytes decoded out of range");
+
+        free(block);
+        free(decoded);
+        free(samples);
+    }
+
+    // The encoded size of each shape against its 16-bit samples
+    unsigned long allEncoded = 0, allCompressed = 0;
+    printf("%-10s %10s %10s\n", "shape", "blocks", "ratio");
+    for (unsigned shape = 0; shape < SHAPE_COUNT; shape++)
+    {
+        printf("%-10s %10lu %10.3f\n", shapeNames[shape], blocks[shape],
+               encoded[shape] ? (double)compressed[shape] / encoded[shape] : 0.0);
+        allEncoded += encoded[shape];
+        allCompressed += compressed[shape];
+    }
+    printf("%-10s %10lu %10.3f\n", "all", iterations, (double)allCompressed / allEncoded);
+    printf("%lu corrupted blocks decoded (no CRC at this level), %lu failures\n", corruptedAccepted, failures);
+    return failures ? 1 : 0;
+}
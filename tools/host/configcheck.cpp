@@ -0,0 +1,115 @@
+// configcheck: checks a configuration file for the card (config.h) with the loader of the
+// firmware, before it is copied to the card.
+//
+//   configcheck [config.json]
+//   Reads the file (default: standard input) over the defaults of a logger that was never set
+//   up, then prints the configuration it gives, or the member at fault, with the time taken and
+//   the bytes of the JSON document used. Exits with 1 if the file is not valid.
+//   Built apart from the other tools, as it needs ArduinoJson, which `pio pkg install` fetches
+//   into .pio/libdeps: make -C tools/host configcheck [ARDUINOJSON=path/to/ArduinoJson/src].
+//   make -C tools/host configtest checks the files of tools/host/configs/, valid or not, against
+//   the outcome in their .expected.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../include/config.h"
+
+// SESSION_ROTATE_SIZE of storage.h
+static const ConfigLimits limits = {64UL * 1024 * 1024};
+
+class StdioConfigSource : public ConfigSource
+{
+private:
+    FILE *file;
+
+protected:
+    size_t fill(char *data, size_t size) override { return fread(data, 1, size, file); }
+
+public:
+    StdioConfigSource(FILE *file) : file(file) {}
+};
+
+static void printCurve(const char *channel, unsigned gain, const CalibrationCurve &curve)
+{
+    static const char *kindNames[] = {"none", "poly", "inverse", "table"};
+    char gainText[8];
+    snprintf(gainText, sizeof(gainText), "%u", gain);
+    printf("calibration  %s %s %s", channel, gain == CALIBRATION_DEFAULT_GAIN ? "default" : gainText, kindNames[curve.kind]);
+    for (uint8_t i = 0; i < curve.count; i++)
+    {
+        if (curve.kind == CURVE_TABLE)
+            printf(" %g:%g", curve.counts[i], curve.values[i]);
+        else
+            printf(" %g", curve.values[i]);
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [config.json]\n", argv[0]);
+        return 2;
+    }
+    FILE *file = argc == 2 ? fopen(argv[1], "rb") : stdin;
+    if (!file)
+    {
+        perror(argv[1]);
+        return 2;
+    }
+
+    static LoggerConfig config;
+    defaultSettings(&config.settings);
+    config.rotateSize = limits.maxRotateSize;
+    config.rotateDuration = 3600000;
+    config.mqttRaw = false;
+    for (uint8_t channel = 0; channel < CALIBRATION_CHANNELS; channel++)
+    {
+        for (uint8_t gain = 0; gain < CALIBRATION_GAINS; gain++)
+            config.curves[channel][gain].kind = CURVE_NONE;
+    }
+
+    StdioConfigSource source(file);
+    size_t poolUsed = 0;
+    char error[CONFIG_ERROR_SIZE];
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    bool valid = parseConfig(source, limits, &config, &poolUsed, error, sizeof(error));
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (file != stdin)
+        fclose(file);
+    long microseconds = (end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000;
+    fprintf(stderr, "%u bytes read in %ld us, %u of %u bytes of the pool\n", (unsigned)source.getTotal(), microseconds,
+            (unsigned)poolUsed, (unsigned)CONFIG_POOL_SIZE);
+    if (!valid)
+    {
+        fprintf(stderr, "%s\n", error);
+        return 1;
+    }
+
+    static const char *modeNames[] = {"display", "serial", "sd"};
+    static const char *channelNames[] = {"voltage", "current", "resistance"};
+    const Settings &settings = config.settings;
+    printf("output       %s%s\n", modeNames[settings.mode], settings.compressed ? ", compressed" : "");
+    printf("channel      %s\n", channelNames[settings.channel]);
+    printf("rate         %u\n", (unsigned)settings.rate);
+    if (settings.gain == 0xFF)
+        printf("gain         default\n");
+    else
+        printf("gain         %u\n", (unsigned)settings.gain);
+    printf("autostart    %s\n", settings.autostart ? "on" : "off");
+    printf("rotation     %lu MB, %lu min\n", (unsigned long)(config.rotateSize >> 20), (unsigned long)(config.rotateDuration / 60000));
+    printf("mqtt raw     %s\n", config.mqttRaw ? "on" : "off");
+    for (uint8_t channel = 0; channel < CALIBRATION_CHANNELS; channel++)
+    {
+        for (uint8_t gain = 0; gain < CALIBRATION_GAINS; gain++)
+        {
+            if (config.curves[channel][gain].kind != CURVE_NONE)
+                printCurve(channelNames[channel], gain, config.curves[channel][gain]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,228 @@
+// ds32conv: converts session files written by the logger (.ds32) to CSV or flat binary.
+//
+//   ds32conv [-j threads] [-r | -w] [-b] [-o output] <file.ds32>...
+//       -j  threads used to scan, decode and format (default: one per core)
+//       -r  ADC counts instead of values converted with the curve, or the gain, offset and
+//           factor, of the file
+//       -w  one value per second instead of every sample, as the logger shows it: the mean of
+//           the counts of the second (their RMS for the current) converted
+//       -b  flat little-endian binary (float32 values, or int16 counts with -r) instead of CSV
+//       -o  output file (default: standard output)
+//   The files are written one after the other, so the parts of a rotated session can be
+//   given in order.
+//
+//   ds32conv [-j threads] --bench [megabytes] [directory]
+//       writes that much of synthetic session files (1024 MB in /tmp by default), converts
+//       them and reports the throughput of each stage in GB/s of session data.
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "ds32file.h"
+#include "../../include/storage_format.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief Decodes a file and writes it out.
+ *
+ * @return 0 on success, 1 on error.
+ */
+static int convertFile(const char *path, FILE *out, bool binary, bool converted, bool windows, unsigned threads)
+{
+    Ds32File file;
+    if (!file.open(path, threads))
+    {
+        fprintf(stderr, "%s\n", file.getError().c_str());
+        return 1;
+    }
+
+    std::vector<int16_t> samples(file.getSampleCount());
+    if (!file.decodeAll(samples.data(), threads))
+        fprintf(stderr, "%s: some records could not be decoded\n", path);
+    if (file.getDamagedBytes() > 0)
+        fprintf(stderr, "%s: %zu damaged bytes skipped\n", path, file.getDamagedBytes());
+
+    if (windows && file.getInfo().rate == 0)
+    {
+        fprintf(stderr, "%s: no sample rate in the header\n", path);
+        return 1;
+    }
+    bool written = windows  ? file.writeWindows(out, samples.data(), binary)
+                   : binary ? file.writeBinary(out, samples.data(), converted, threads)
+                            : file.writeCsv(out, samples.data(), converted, threads);
+    if (!written)
+    {
+        perror("write");
+        return 1;
+    }
+    return 0;
+}
+
+static FILE *benchSink;
+
+static void writeBenchRecord(const uint8_t *record, size_t length, const BlockSummary *)
+{
+    fwrite(record, 1, length, benchSink);
+}
+
+/**
+ * @brief Writes a synthetic session file like the logger does at 860 SPS: a slow sine with noise.
+ */
+static bool writeBenchFile(const char *path, size_t size, uint16_t session)
+{
+    benchSink = fopen(path, "wb");
+    if (!benchSink)
+        return false;
+
+    fprintf(benchSink, "DS32 %d %c\nCurrent measure: Voltage\nGain: 0.000125000\nOffset: 0.00\n"
+                       "Array length (Sample rate): 860\nFactor: 4.33\nStart: 10/19/2024 12:30:00\n\n",
+            SESSION_FORMAT_VERSION, SESSION_MODE_FILE);
+
+    BlockWriter writer(writeBenchRecord);
+    writer.reset(0, session);
+    uint32_t noise = session;
+    for (uint32_t i = 0; ftell(benchSink) < (long)size; i++)
+    {
+        noise = noise * 1664525 + 1013904223;
+        int16_t sample = (int16_t)(8000 * sin(i * 0.001) + (int)(noise >> 28) - 8);
+        writer.insert(sample, i * 1000 / 860);
+        if (i % 860 == 859)
+            writer.flush();
+    }
+    writer.flush();
+    return fclose(benchSink) == 0;
+}
+
+/**
+ * @brief Converts synthetic session files and reports the throughput of each stage.
+ */
+static int bench(size_t megabytes, const char *directory, unsigned threads)
+{
+    const size_t fileSize = 64UL * 1024 * 1024; // SESSION_ROTATE_SIZE in the firmware
+    std::vector<std::string> paths;
+    size_t total = 0;
+
+    fprintf(stderr, "Writing %zu MB of session files to %s...\n", megabytes, directory);
+    for (uint16_t session = 1; total < megabytes * 1024 * 1024; session++)
+    {
+        size_t size = megabytes * 1024 * 1024 - total < fileSize ? megabytes * 1024 * 1024 - total : fileSize;
+        std::string path = std::string(directory) + "/ds32conv_bench_" + std::to_string(session) + SESSION_EXTENSION;
+        if (!writeBenchFile(path.c_str(), size, session))
+        {
+            perror(path.c_str());
+            return 1;
+        }
+        paths.push_back(path);
+        total += size;
+    }
+
+    FILE *null = fopen("/dev/null", "wb");
+    double scan = 0, decode = 0, binary = 0, csv = 0;
+    uint64_t samples = 0;
+    size_t bytes = 0;
+    for (const std::string &path : paths)
+    {
+        Ds32File file;
+        Clock::time_point start = Clock::now();
+        if (!file.open(path.c_str(), threads))
+        {
+            fprintf(stderr, "%s\n", file.getError().c_str());
+            return 1;
+        }
+        scan += secondsSince(start);
+
+        std::vector<int16_t> raw(file.getSampleCount());
+        start = Clock::now();
+        file.decodeAll(raw.data(), threads);
+        decode += secondsSince(start);
+
+        start = Clock::now();
+        file.writeBinary(null, raw.data(), true, threads);
+        binary += secondsSince(start);
+
+        start = Clock::now();
+        file.writeCsv(null, raw.data(), true, threads);
+        csv += secondsSince(start);
+
+        samples += file.getSampleCount();
+        bytes += file.getFileSize();
+        remove(path.c_str());
+    }
+    fclose(null);
+
+    double gigabytes = bytes / 1e9;
+    printf("%.2f GB, %llu samples, %u threads\n", gigabytes, (unsigned long long)samples, threadCount(threads));
+    printf("map + scan:        %6.2f GB/s\n", gigabytes / scan);
+    printf("decode:            %6.2f GB/s  (%.0f Msamples/s)\n", gigabytes / decode, samples / decode / 1e6);
+    printf("to float32:        %6.2f GB/s  (scan + decode + convert + write)\n", gigabytes / (scan + decode + binary));
+    printf("to CSV:            %6.2f GB/s  (scan + decode + convert + format + write)\n", gigabytes / (scan + decode + csv));
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned threads = 0;
+    bool binary = false, converted = true, windows = false;
+    const char *output = NULL;
+
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-' && argv[arg][1] != '\0'; arg++)
+    {
+        if (strcmp(argv[arg], "--bench") == 0)
+        {
+            size_t megabytes = arg + 1 < argc ? strtoul(argv[arg + 1], NULL, 10) : 1024;
+            return bench(megabytes ? megabytes : 1024, arg + 2 < argc ? argv[arg + 2] : "/tmp", threads);
+        }
+        else if (strcmp(argv[arg], "-j") == 0 && arg + 1 < argc)
+            threads = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-r") == 0)
+            converted = false;
+        else if (strcmp(argv[arg], "-w") == 0)
+            windows = true;
+        else if (strcmp(argv[arg], "-b") == 0)
+            binary = true;
+        else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc)
+            output = argv[++arg];
+        else
+            break;
+    }
+    if (arg >= argc || (windows && !converted))
+    {
+        fprintf(stderr, "usage: %s [-j threads] [-r | -w] [-b] [-o output] <file.ds32>...\n"
+                        "       %s [-j threads] --bench [megabytes] [directory]\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    FILE *out = output ? fopen(output, "wb") : stdout;
+    if (!out)
+    {
+        perror(output);
+        return 1;
+    }
+
+    if (!binary)
+        fputs(windows ? "window,value\n" : converted ? "sample,time_ms,value\n" : "sample,time_ms,raw\n", out);
+
+    int result = 0;
+    for (; arg < argc && result == 0; arg++)
+        result = convertFile(argv[arg], out, binary, converted, windows, threads);
+
+    if (output && fclose(out) != 0)
+    {
+        perror(output);
+        return 1;
+    }
+    return result;
+}
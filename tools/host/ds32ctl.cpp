@@ -0,0 +1,708 @@
+// ds32ctl: configures and controls the logger over the serial command channel (command.h).
+//
+//   ds32ctl [-b baud] <device> <command> [arguments] [<command> [arguments]]...
+//       ping
+//       status
+//       config MODE CHANNEL RATE [GAIN]   MODE: display, serial or sd; CHANNEL: voltage, current
+//                                         or resistance; GAIN: 0-5 for 2/3, 1, 2, 4, 8, 16
+//       start [compressed]
+//       stop
+//       counters
+//       transfers                         samples missed while serving the web pages and the
+//                                         downloads of session files, and their throughput
+//       metrics                           the health and performance metrics, in the text of
+//                                         GET /metrics
+//       boot                              when each device was initialized at the last boot,
+//                                         and the first sample
+//       calibration
+//       calibrate WINDOWS DEGREE REFERENCE...
+//                                         guided calibration of the configured channel and gain:
+//                                         for each reference value, asks for the input to be
+//                                         applied and has the logger average WINDOWS windows,
+//                                         then fits a curve of DEGREE (1 to 3) and saves it
+//       uncalibrate                       removes the saved curve of the configured channel and gain
+//       spectrum SIZE [hann|blackman-harris] [count]
+//                                         spectrum mode on the configured channel: prints the
+//                                         peaks of count spectra (10 by default) of SIZE samples
+//                                         (64 to 1024, a power of two) and the processor cycles
+//                                         the logger took for each, then leaves the mode
+//       autostart on|off                  logging starts at boot with the saved configuration
+//       sync [count]                      time synchronization exchanges (16 by default), then
+//                                         the offset and drift of the logger clock
+//       baud BAUD                         switches the logger and the connection to another speed
+//       bench [bytes]                     throughput at each speed from 115200 to 3000000 baud,
+//                                         sending that many bytes (256 KB by default)
+//   The commands are sent one after the other through the same connection. Each reply is
+//   printed; the exit status is 1 if one is missing after a second or is not OK.
+
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ads1115.h"
+#include "calibration.h"
+#include "serialrx.h"
+#include "spectrum.h"
+#include "timesync.h"
+
+#define REPLY_TIMEOUT 1000
+
+static const char *modeNames[] = {"display", "serial", "sd"};
+static const char *channelNames[] = {"voltage", "current", "resistance"};
+static const char *statusNames[] = {"ok", "unknown command", "invalid argument", "busy"};
+static const char *windowNames[SPECTRUM_WINDOWS] = {"hann", "blackman-harris"};
+
+static uint32_t milliseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static uint16_t get16(const uint8_t *data)
+{
+    return data[0] | data[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *data)
+{
+    return get16(data) | (uint32_t)get16(data + 2) << 16;
+}
+
+static uint64_t get64(const uint8_t *data)
+{
+    return get32(data) | (uint64_t)get32(data + 4) << 32;
+}
+
+static float getFloat(const uint8_t *data)
+{
+    uint32_t bits = get32(data);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static int lookup(const char *name, const char *const *names, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (strcmp(name, names[i]) == 0)
+            return i;
+    }
+    return -1;
+}
+
+// What came in while waiting for a reply
+struct Transfer
+{
+    uint64_t receivedAt;  // Host time the reply was complete
+    uint64_t firstByteAt; // Host time of the first byte that was not part of a reply
+    uint64_t bytes;       // Bytes that were not part of a reply (samples, or the benchmark pattern)
+    uint64_t errors;      // Of those, bytes that differ from the benchmark pattern
+};
+
+/**
+ * @brief Sends a request and waits for its reply, skipping the samples sent meanwhile.
+ *
+ * @param timeout Milliseconds to wait for the reply.
+ * @return true if a reply arrived, in parser.
+ */
+static bool transact(int fd, CommandParser &parser, uint8_t command, const uint8_t *payload, uint8_t length,
+                     Transfer *transfer, uint32_t timeout = REPLY_TIMEOUT)
+{
+    memset(transfer, 0, sizeof(*transfer));
+    uint8_t frame[COMMAND_MAX_FRAME];
+    size_t size = encodeCommand(COMMAND_REQUEST, command, payload, length, frame);
+    if (write(fd, frame, size) != (ssize_t)size)
+        return false;
+
+    uint32_t start = milliseconds();
+    while (milliseconds() - start < timeout)
+    {
+        struct pollfd descriptor = {fd, POLLIN, 0};
+        if (poll(&descriptor, 1, 50) <= 0)
+            continue;
+
+        uint8_t buffer[4096];
+        ssize_t received = read(fd, buffer, sizeof(buffer));
+        transfer->receivedAt = hostMicros();
+        for (ssize_t i = 0; i < received; i++)
+        {
+            COMMAND_PARSE result = parser.feed(buffer[i], milliseconds());
+            if (result == COMMAND_NONE)
+            {
+                if (transfer->bytes == 0)
+                    transfer->firstByteAt = transfer->receivedAt;
+                if (buffer[i] != '0' + transfer->bytes % 64)
+                    transfer->errors++;
+                transfer->bytes++;
+            }
+            else if (result == COMMAND_READY && parser.getCommand() == (command | COMMAND_REPLY_FLAG) &&
+                     parser.getLength() >= 1)
+                return true;
+        }
+    }
+    return false;
+}
+
+static void put32(uint8_t *out, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        out[i] = (uint8_t)(value >> (8 * i));
+}
+
+/**
+ * @brief Switches the logger, then the host, to another line speed.
+ *
+ * @return true if the logger answers at the new speed.
+ */
+static bool changeSpeed(int fd, CommandParser &parser, unsigned baud)
+{
+    uint8_t payload[4];
+    put32(payload, baud);
+    Transfer transfer;
+    if (!transact(fd, parser, COMMAND_SET_BAUD, payload, sizeof(payload), &transfer) ||
+        parser.getPayload()[0] != COMMAND_OK)
+        return false;
+
+    if (isatty(fd) && !setSerialSpeed(fd, baud))
+        return false;
+    usleep(50000);
+    if (isatty(fd))
+        tcflush(fd, TCIFLUSH);
+    return transact(fd, parser, COMMAND_PING, NULL, 0, &transfer) && parser.getPayload()[0] == COMMAND_OK;
+}
+
+/**
+ * @brief Measures the throughput of the link at each line speed, then goes back to the first one.
+ *
+ * @return true if every speed could be measured.
+ */
+static bool benchmark(int fd, CommandParser &parser, unsigned initialBaud, uint32_t bytes)
+{
+    static const unsigned speeds[] = {115200, 230400, 460800, 921600, 1000000, 1500000, 2000000, 3000000};
+    bool complete = true;
+
+    printf("%9s %12s %12s %8s %8s %12s\n", "baud", "device KB/s", "host KB/s", "of line", "errors", "0xCC SPS");
+    for (unsigned baud : speeds)
+    {
+        if (!changeSpeed(fd, parser, baud))
+        {
+            printf("%9u no link\n", baud);
+            complete = false;
+            break;
+        }
+
+        uint8_t payload[4];
+        put32(payload, bytes);
+        Transfer transfer;
+        uint32_t timeout = (uint32_t)(bytes * 10ULL * 2000 / baud) + REPLY_TIMEOUT;
+        if (!transact(fd, parser, COMMAND_BENCHMARK, payload, sizeof(payload), &transfer, timeout) ||
+            parser.getPayload()[0] != COMMAND_OK || parser.getLength() != 9)
+        {
+            printf("%9u no reply\n", baud);
+            complete = false;
+            continue;
+        }
+
+        uint32_t deviceTime = get32(parser.getPayload() + 5);
+        double device = deviceTime ? bytes / (deviceTime / 1e6) : 0;
+        double host = transfer.receivedAt > transfer.firstByteAt
+                          ? transfer.bytes / ((transfer.receivedAt - transfer.firstByteAt) / 1e6)
+                          : 0;
+        printf("%9u %12.1f %12.1f %7.0f%% %8llu %12.0f\n", baud, device / 1000, host / 1000, 100 * device / (baud / 10.0),
+               (unsigned long long)(transfer.errors + (bytes - (transfer.bytes < bytes ? transfer.bytes : bytes))),
+               device / 3);
+    }
+
+    if (!changeSpeed(fd, parser, initialBaud))
+    {
+        fprintf(stderr, "the logger did not come back to %u baud\n", initialBaud);
+        return false;
+    }
+    return complete;
+}
+
+/**
+ * @brief Reads a paged text, of GET_METRICS or GET_BOOT, page by page and prints it.
+ *
+ * @return true if the whole text was read.
+ */
+static bool printText(int fd, CommandParser &parser, uint8_t command)
+{
+    uint16_t offset = 0, total = 0;
+    do
+    {
+        uint8_t payload[2] = {(uint8_t)offset, (uint8_t)(offset >> 8)};
+        Transfer transfer;
+        if (!transact(fd, parser, command, payload, sizeof(payload), &transfer) ||
+            parser.getLength() < 3 || parser.getPayload()[0] != COMMAND_OK)
+            return false;
+        const uint8_t *reply = parser.getPayload();
+        total = reply[1] | reply[2] << 8;
+        fwrite(reply + 3, 1, parser.getLength() - 3, stdout);
+        offset += parser.getLength() - 3;
+        if (parser.getLength() == 3 && offset < total)
+            return false;
+    } while (offset < total);
+    return true;
+}
+
+/**
+ * @brief Sends a step of the CALIBRATE command (command.h).
+ *
+ * @return true if it was answered OK, with the reply in parser.
+ */
+static bool calibrationStep(int fd, CommandParser &parser, const uint8_t *payload, uint8_t length)
+{
+    Transfer transfer;
+    return transact(fd, parser, COMMAND_CALIBRATE, payload, length, &transfer) && parser.getLength() >= 1 &&
+           parser.getPayload()[0] == COMMAND_OK;
+}
+
+/**
+ * @brief Leads the operator through the reference points of the guided calibration, then has the
+ * logger fit and save the curve.
+ *
+ * @return true if the curve was saved.
+ */
+static bool calibrate(int fd, CommandParser &parser, uint8_t windows, uint8_t degree, const float *references,
+                      int count)
+{
+    uint8_t begin[3] = {CALIBRATE_BEGIN, windows, degree}, status[1] = {CALIBRATE_STATUS};
+    if (!calibrationStep(fd, parser, begin, sizeof(begin)))
+        return false;
+    // The routine starts from the main loop of the logger
+    uint32_t start = milliseconds();
+    do
+    {
+        if (milliseconds() - start > REPLY_TIMEOUT || !calibrationStep(fd, parser, status, sizeof(status)) ||
+            parser.getLength() < 9)
+            return false;
+    } while (!parser.getPayload()[1]);
+
+    for (int point = 0; point < count; point++)
+    {
+        printf("apply %g and press Enter: ", references[point]);
+        fflush(stdout);
+        int c;
+        while ((c = getchar()) != '\n' && c != EOF)
+            ;
+
+        uint32_t bits;
+        memcpy(&bits, &references[point], sizeof(bits));
+        uint8_t request[5] = {CALIBRATE_POINT, (uint8_t)bits, (uint8_t)(bits >> 8), (uint8_t)(bits >> 16),
+                              (uint8_t)(bits >> 24)};
+        if (!calibrationStep(fd, parser, request, sizeof(request)))
+            return false;
+        // The logger drops the window under way, then averages the next ones
+        for (;;)
+        {
+            usleep(250000);
+            if (!calibrationStep(fd, parser, status, sizeof(status)) || parser.getLength() < 9)
+                return false;
+            const uint8_t *reply = parser.getPayload() + 1;
+            if (!reply[0])
+            {
+                fprintf(stderr, "calibrate: left on the logger\n");
+                return false;
+            }
+            if (reply[1] == point + 1 && !reply[2])
+            {
+                printf("%g counts\n", getFloat(reply + 4));
+                break;
+            }
+            printf("\r%u/%u windows ", reply[3], windows);
+            fflush(stdout);
+        }
+    }
+
+    uint8_t fit[1] = {CALIBRATE_FIT};
+    if (!calibrationStep(fd, parser, fit, sizeof(fit)))
+    {
+        uint8_t cancel[1] = {CALIBRATE_CANCEL};
+        calibrationStep(fd, parser, cancel, sizeof(cancel));
+        return false;
+    }
+    const uint8_t *reply = parser.getPayload() + 1;
+    printf("curve");
+    for (uint8_t i = 0; i < reply[0] && 1 + 1 + 4 * (i + 1) <= parser.getLength(); i++)
+        printf(" %.9g", getFloat(reply + 1 + 4 * i));
+    if (parser.getLength() >= 2 + 4 * (reply[0] + 1))
+        printf(", RMS residual %g", getFloat(reply + 1 + 4 * reply[0]));
+    printf("\n");
+    return true;
+}
+
+/**
+ * @brief Starts the spectrum mode, prints the peaks of the records it sends, then leaves it.
+ *
+ * @return true if count records were received.
+ */
+static bool analyze(int fd, CommandParser &parser, uint16_t size, uint8_t window, unsigned count)
+{
+    uint8_t request[3] = {(uint8_t)size, (uint8_t)(size >> 8), window};
+    Transfer transfer;
+    if (!transact(fd, parser, COMMAND_SPECTRUM, request, sizeof(request), &transfer) ||
+        parser.getPayload()[0] != COMMAND_OK)
+        return false;
+
+    // The first record comes after a block, which takes the longest at the lowest rate
+    const uint32_t timeout = (uint32_t)size * 1000 / ADC_RATES[0].samples + REPLY_TIMEOUT;
+    static uint8_t buffer[2 * SPECTRUM_MAX_RECORD];
+    size_t pending = 0;
+    unsigned received = 0;
+    uint64_t cycles = 0;
+    uint32_t last = milliseconds();
+    while (received < count && milliseconds() - last < timeout)
+    {
+        struct pollfd descriptor = {fd, POLLIN, 0};
+        if (poll(&descriptor, 1, 50) <= 0)
+            continue;
+        ssize_t bytes = read(fd, buffer + pending, sizeof(buffer) - pending);
+        if (bytes <= 0)
+            continue;
+        pending += bytes;
+
+        size_t position = 0;
+        while (position < pending && received < count)
+        {
+            size_t available = pending - position;
+            if (buffer[position] != SPECTRUM_MAGIC)
+            {
+                position++;
+                continue;
+            }
+            if (available < sizeof(SpectrumHeader))
+                break;
+            SpectrumHeader header;
+            memcpy(&header, buffer + position, sizeof(header));
+            int length = checkSpectrum(buffer + position, available);
+            size_t expected = sizeof(header) + 2 * (size_t)header.bins;
+            if (length < 0 && available < expected && expected <= SPECTRUM_MAX_RECORD)
+                break; // Possibly a record whose end has not come yet
+            if (length < 0)
+            {
+                position++;
+                continue;
+            }
+
+            printf("%lu: %u cycles", (unsigned long)header.sequence, (unsigned)header.cycles);
+            for (uint8_t i = 0; i < SPECTRUM_PEAKS && header.peaks[i].amplitude > 0; i++)
+                printf(", %.2f Hz %.1f", header.peaks[i].frequency, header.peaks[i].amplitude);
+            printf("\n");
+            cycles += header.cycles;
+            received++;
+            last = milliseconds();
+            position += length;
+        }
+        memmove(buffer, buffer + position, pending - position);
+        pending -= position;
+        if (pending == sizeof(buffer))
+            pending = 0;
+    }
+
+    uint8_t leave[3] = {0, 0, 0};
+    if (!transact(fd, parser, COMMAND_SPECTRUM, leave, sizeof(leave), &transfer) || parser.getPayload()[0] != COMMAND_OK)
+        fprintf(stderr, "spectrum: the mode may still be running\n");
+    if (received > 0)
+        printf("%u spectra of %u samples (%s), %.0f cycles per transform\n", received, size, windowNames[window],
+               (double)cycles / received);
+    return received == count;
+}
+
+/**
+ * @brief Makes time synchronization exchanges and prints the estimate of the logger clock.
+ *
+ * @return true if every exchange was answered.
+ */
+static bool synchronize(int fd, CommandParser &parser, unsigned count)
+{
+    ClockSync clock;
+    for (unsigned i = 0; i < count; i++)
+    {
+        uint64_t now = hostMicros();
+        uint8_t payload[8];
+        for (int byte = 0; byte < 8; byte++)
+            payload[byte] = (uint8_t)(now >> (8 * byte));
+
+        Transfer transfer;
+        if (!transact(fd, parser, COMMAND_TIME_SYNC, payload, sizeof(payload), &transfer) ||
+            parser.getLength() != 25 || parser.getPayload()[0] != COMMAND_OK)
+            return false;
+        const uint8_t *reply = parser.getPayload() + 1;
+        SyncExchange exchange = {get64(reply), get64(reply + 8), get64(reply + 16), transfer.receivedAt};
+        clock.addExchange(exchange);
+        usleep(20000);
+    }
+
+    printf("offset %.6f s, drift %.1f ppm, round trip %.0f us, error < %.0f us (%u exchanges)\n",
+           clock.getOffset(hostMicros()) / 1e6, clock.getDrift(), clock.getDelay(), clock.getError(), count);
+    return true;
+}
+
+/**
+ * @brief Prints the fields of a reply.
+ */
+static void printReply(uint8_t command, const uint8_t *data, uint8_t length)
+{
+    switch (command)
+    {
+    case COMMAND_PING:
+        if (length >= 1)
+            printf("version %u\n", data[0]);
+        break;
+    case COMMAND_GET_STATUS:
+        if (length >= 16)
+        {
+            char gain[8] = "default";
+            if (data[4] != COMMAND_GAIN_DEFAULT)
+                snprintf(gain, sizeof(gain), "%u", data[4]);
+            printf("mode %s, channel %s, rate %u, gain %s, %s, session %u, %lu samples, up %lu ms\n",
+                   data[0] < 3 ? modeNames[data[0]] : "?", data[1] < 3 ? channelNames[data[1]] : "?",
+                   get16(data + 2), gain, data[5] ? "acquiring" : "idle", get16(data + 6),
+                   (unsigned long)get32(data + 8), (unsigned long)get32(data + 12));
+        }
+        break;
+    case COMMAND_STOP:
+        if (length >= 4)
+            printf("stopped after %lu samples\n", (unsigned long)get32(data));
+        break;
+    case COMMAND_GET_COUNTERS:
+        if (length >= 24)
+            printf("%lu samples, %lu records, %lu commands, %lu rejected frames, %lu dropped batches (%lu samples)\n",
+                   (unsigned long)get32(data), (unsigned long)get32(data + 4), (unsigned long)get32(data + 8),
+                   (unsigned long)get32(data + 12), (unsigned long)get32(data + 16), (unsigned long)get32(data + 20));
+        break;
+    case COMMAND_GET_TRANSFERS:
+        if (length >= 24)
+        {
+            uint32_t bytes = get32(data + 16), milliseconds = get32(data + 20);
+            printf("%lu missed samples, longest web poll %lu us, %lu/%lu downloads complete, %lu bytes in %lu ms (%.1f KB/s)\n",
+                   (unsigned long)get32(data), (unsigned long)get32(data + 4), (unsigned long)get32(data + 12),
+                   (unsigned long)get32(data + 8), (unsigned long)bytes, (unsigned long)milliseconds,
+                   milliseconds ? bytes / 1024.0 / (milliseconds / 1000.0) : 0.0);
+        }
+        break;
+    case COMMAND_GET_CALIBRATION:
+    {
+        static const char *curves[] = {"nominal", "polynomial", "inverse", "table"}; // CURVE_KIND
+        if (length >= 12)
+            printf("gain %.9g V/count, offset %g, factor %g\n", getFloat(data), getFloat(data + 4),
+                   getFloat(data + 8));
+        if (length >= 17 && data[12] < 4)
+            printf("curve %s, table error %g\n", curves[data[12]], getFloat(data + 13));
+        break;
+    }
+    default:
+        printf("ok\n");
+        break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned baud = 115200;
+    int arg = 1;
+    if (arg + 1 < argc && strcmp(argv[arg], "-b") == 0)
+    {
+        baud = strtoul(argv[arg + 1], NULL, 10);
+        arg += 2;
+    }
+    if (arg + 2 > argc)
+    {
+        fprintf(stderr, "usage: %s [-b baud] <device> ping|status|config MODE CHANNEL RATE [GAIN]|"
+                        "start [compressed]|stop|counters|transfers|metrics|boot|calibration|calibrate WINDOWS DEGREE REFERENCE...|"
+                        "uncalibrate|spectrum SIZE [hann|blackman-harris] [count]|autostart on|off|sync [count]|baud BAUD|"
+                        "bench [bytes]...\n",
+                argv[0]);
+        return 2;
+    }
+
+    const char *path = argv[arg++];
+    int fd = openSerialPort(path, baud);
+    if (fd < 0)
+    {
+        perror(path);
+        return 1;
+    }
+
+    CommandParser parser(COMMAND_REPLY);
+    while (arg < argc)
+    {
+        const char *name = argv[arg++];
+        uint8_t payload[COMMAND_MAX_PAYLOAD];
+        uint8_t length = 0;
+        uint8_t command;
+
+        if (strcmp(name, "ping") == 0)
+            command = COMMAND_PING;
+        else if (strcmp(name, "status") == 0)
+            command = COMMAND_GET_STATUS;
+        else if (strcmp(name, "stop") == 0)
+            command = COMMAND_STOP;
+        else if (strcmp(name, "counters") == 0)
+            command = COMMAND_GET_COUNTERS;
+        else if (strcmp(name, "transfers") == 0)
+            command = COMMAND_GET_TRANSFERS;
+        else if (strcmp(name, "calibration") == 0)
+            command = COMMAND_GET_CALIBRATION;
+        else if (strcmp(name, "baud") == 0 && arg < argc)
+        {
+            baud = strtoul(argv[arg++], NULL, 10);
+            if (!changeSpeed(fd, parser, baud))
+            {
+                fprintf(stderr, "%s: the logger does not answer at %u baud\n", name, baud);
+                return 1;
+            }
+            printf("%s: %u\n", name, baud);
+            continue;
+        }
+        else if (strcmp(name, "bench") == 0)
+        {
+            uint32_t bytes = 262144;
+            if (arg < argc && argv[arg][0] >= '1' && argv[arg][0] <= '9')
+                bytes = strtoul(argv[arg++], NULL, 10);
+            if (!benchmark(fd, parser, baud, bytes))
+                return 1;
+            continue;
+        }
+        else if (strcmp(name, "metrics") == 0 || strcmp(name, "boot") == 0)
+        {
+            if (!printText(fd, parser, name[0] == 'm' ? COMMAND_GET_METRICS : COMMAND_GET_BOOT))
+            {
+                fprintf(stderr, "%s: no reply\n", name);
+                return 1;
+            }
+            continue;
+        }
+        else if (strcmp(name, "sync") == 0)
+        {
+            unsigned count = 16;
+            if (arg < argc && argv[arg][0] >= '1' && argv[arg][0] <= '9')
+                count = strtoul(argv[arg++], NULL, 10);
+            printf("%s: ", name);
+            fflush(stdout);
+            if (!synchronize(fd, parser, count))
+            {
+                fprintf(stderr, "%s: no reply\n", name);
+                return 1;
+            }
+            continue;
+        }
+        else if (strcmp(name, "calibrate") == 0 && arg + 2 < argc)
+        {
+            unsigned windows = strtoul(argv[arg++], NULL, 10);
+            unsigned degree = strtoul(argv[arg++], NULL, 10);
+            float references[CALIBRATION_MAX_POINTS];
+            int count = 0;
+            char *end;
+            while (arg < argc && count < CALIBRATION_MAX_POINTS)
+            {
+                float reference = strtof(argv[arg], &end);
+                if (end == argv[arg] || *end != '\0')
+                    break;
+                references[count++] = reference;
+                arg++;
+            }
+            if (windows == 0 || windows > 255 || degree < 1 || degree > 3 || count <= (int)degree)
+            {
+                fprintf(stderr, "calibrate: 1-255 windows, degree 1-3 and more references than the degree\n");
+                return 2;
+            }
+            if (!calibrate(fd, parser, windows, degree, references, count))
+            {
+                fprintf(stderr, "%s: failed\n", name);
+                return 1;
+            }
+            continue;
+        }
+        else if (strcmp(name, "spectrum") == 0 && arg < argc)
+        {
+            unsigned size = strtoul(argv[arg++], NULL, 10);
+            int window = SPECTRUM_HANN;
+            if (arg < argc && lookup(argv[arg], windowNames, SPECTRUM_WINDOWS) >= 0)
+                window = lookup(argv[arg++], windowNames, SPECTRUM_WINDOWS);
+            unsigned count = 10;
+            if (arg < argc && argv[arg][0] >= '1' && argv[arg][0] <= '9')
+                count = strtoul(argv[arg++], NULL, 10);
+            if (size > 0xFFFF || !SpectrumAnalyzer::isValidSize(size))
+            {
+                fprintf(stderr, "spectrum: the size is a power of two from %u to %u\n", SPECTRUM_MIN_SIZE, SPECTRUM_MAX_SIZE);
+                return 2;
+            }
+            if (!analyze(fd, parser, size, window, count))
+            {
+                fprintf(stderr, "%s: failed\n", name);
+                return 1;
+            }
+            continue;
+        }
+        else if (strcmp(name, "autostart") == 0 && arg < argc &&
+                 (strcmp(argv[arg], "on") == 0 || strcmp(argv[arg], "off") == 0))
+        {
+            command = COMMAND_SET_AUTOSTART;
+            payload[length++] = strcmp(argv[arg++], "on") == 0;
+        }
+        else if (strcmp(name, "uncalibrate") == 0)
+        {
+            command = COMMAND_CALIBRATE;
+            payload[length++] = CALIBRATE_CLEAR;
+        }
+        else if (strcmp(name, "start") == 0)
+        {
+            command = COMMAND_START;
+            if (arg < argc && strcmp(argv[arg], "compressed") == 0)
+            {
+                payload[length++] = 1;
+                arg++;
+            }
+        }
+        else if (strcmp(name, "config") == 0 && arg + 3 <= argc)
+        {
+            command = COMMAND_SET_CONFIG;
+            int mode = lookup(argv[arg++], modeNames, 3);
+            int channel = lookup(argv[arg++], channelNames, 3);
+            unsigned rate = strtoul(argv[arg++], NULL, 10);
+            unsigned gain = COMMAND_GAIN_DEFAULT;
+            if (arg < argc && argv[arg][0] >= '0' && argv[arg][0] <= '9')
+                gain = strtoul(argv[arg++], NULL, 10);
+            if (mode < 0 || channel < 0)
+            {
+                fprintf(stderr, "config: unknown mode or channel\n");
+                return 2;
+            }
+            payload[length++] = mode;
+            payload[length++] = channel;
+            payload[length++] = (uint8_t)rate;
+            payload[length++] = (uint8_t)(rate >> 8);
+            payload[length++] = (uint8_t)gain;
+        }
+        else
+        {
+            fprintf(stderr, "%s: unknown command or missing arguments\n", name);
+            return 2;
+        }
+
+        Transfer transfer;
+        if (!transact(fd, parser, command, payload, length, &transfer))
+        {
+            fprintf(stderr, "%s: no reply\n", name);
+            return 1;
+        }
+        uint8_t status = parser.getPayload()[0];
+        if (status != COMMAND_OK)
+        {
+            fprintf(stderr, "%s: %s\n", name, status <= COMMAND_BUSY ? statusNames[status] : "error");
+            return 1;
+        }
+        printf("%s: ", name);
+        printReply(command, parser.getPayload() + 1, parser.getLength() - 1);
+    }
+    close(fd);
+    return 0;
+}
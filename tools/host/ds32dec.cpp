@@ -0,0 +1,235 @@
+// ds32dec: decodes a session file written by the logger (.ds32) on a PC.
+//
+//   ds32dec <file.ds32>                   prints one raw ADC sample per line, "index time_ms value"
+//   ds32dec <file.ds32> <from_ms> <to_ms> only the samples of the records in that time range
+//   ds32dec -s <file.ds32> [from to]      prints "count min max mean" of those samples
+//   ds32dec -i <file.ds32>                prints the block index
+//
+// A time range is located with the block index (.idx next to the file) when there is one,
+// and -s takes the entries that lie entirely in the range from the index without decoding
+// their records. The compression ratio, the damaged bytes skipped and the records missing
+// from the sequence are reported on stderr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../../include/blocks.h"
+#include "../../include/storage_format.h"
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return false;
+    uint8_t chunk[65536];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + length);
+    fclose(file);
+    return true;
+}
+
+// Positions in the index count the sector footers of raw files, positions in the data do not
+static size_t dataPosition(bool raw, uint32_t position)
+{
+    return raw ? position / SD_SECTOR_SIZE * SD_SECTOR_PAYLOAD + position % SD_SECTOR_SIZE : position;
+}
+
+struct Summary
+{
+    uint64_t count = 0;
+    int64_t sum = 0;
+    int minimum = INT16_MAX;
+    int maximum = INT16_MIN;
+};
+
+int main(int argc, char **argv)
+{
+    char option = 0;
+    if (argc > 1 && argv[1][0] == '-' && (argv[1][1] == 's' || argv[1][1] == 'i'))
+    {
+        option = argv[1][1];
+        argc--;
+        argv++;
+    }
+    if (argc != 2 && argc != 4)
+    {
+        fprintf(stderr, "usage: %s [-s|-i] <file.ds32> [from_ms to_ms]\n", argv[0]);
+        return 2;
+    }
+    bool ranged = argc == 4;
+    uint32_t from = ranged ? strtoul(argv[2], NULL, 10) : 0;
+    uint32_t to = ranged ? strtoul(argv[3], NULL, 10) : UINT32_MAX;
+
+    std::vector<uint8_t> file;
+    if (!readFile(argv[1], file))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    if (file.size() < 9 || memcmp(file.data(), "DS32 ", 5) != 0 || atoi((const char *)&file[5]) != SESSION_FORMAT_VERSION)
+    {
+        fprintf(stderr, "%s: not a version %d session file\n", argv[1], SESSION_FORMAT_VERSION);
+        return 1;
+    }
+    bool raw = file[7] == SESSION_MODE_RAW;
+
+    // The block index has the same name as the file
+    std::string indexPath = argv[1];
+    size_t dot = indexPath.rfind('.');
+    indexPath = indexPath.substr(0, dot) + BLOCK_INDEX_EXTENSION;
+    std::vector<uint8_t> indexData;
+    std::vector<BlockIndexEntry> index;
+    if (readFile(indexPath.c_str(), indexData))
+    {
+        index.resize(indexData.size() / sizeof(BlockIndexEntry));
+        memcpy(index.data(), indexData.data(), index.size() * sizeof(BlockIndexEntry));
+    }
+
+    if (option == 'i')
+    {
+        for (const BlockIndexEntry &entry : index)
+            printf("%u %u %u %u %u %d %d %.2f\n", entry.offset, entry.sequence, entry.first, entry.time, entry.count,
+                   entry.minimum, entry.maximum, entry.count ? (double)entry.sum / entry.count : 0.0);
+        return 0;
+    }
+
+    // Raw sessions are a sequence of sectors, each with a footer telling how much of it is used
+    std::vector<uint8_t> data;
+    if (raw)
+    {
+        for (size_t offset = 0; offset + SD_SECTOR_SIZE <= file.size(); offset += SD_SECTOR_SIZE)
+        {
+            SectorFooter footer;
+            memcpy(&footer, &file[offset + SD_SECTOR_PAYLOAD], sizeof(footer));
+            if (footer.length > SD_SECTOR_PAYLOAD)
+                break;
+            data.insert(data.end(), &file[offset], &file[offset] + footer.length);
+        }
+    }
+    else
+    {
+        data.swap(file);
+    }
+
+    // The text header ends with an empty line
+    const uint8_t *end = data.data() + data.size();
+    const uint8_t *p = data.data();
+    while (p + 1 < end && !(p[0] == '\n' && p[1] == '\n'))
+        p++;
+    if (p + 1 >= end)
+    {
+        fprintf(stderr, "%s: no sample blocks\n", argv[1]);
+        return 1;
+    }
+    fwrite(data.data(), 1, p + 1 - data.data(), stderr);
+    p += 2;
+
+    // Start from the last entry beginning at or before the range, found by bisection
+    size_t entry = 0;
+    if (ranged && !index.empty())
+    {
+        size_t low = 0, high = index.size();
+        while (high - low > 1)
+        {
+            size_t middle = (low + high) / 2;
+            if (index[middle].time <= from)
+                low = middle;
+            else
+                high = middle;
+        }
+        entry = low;
+        if (index[entry].time <= from && dataPosition(raw, index[entry].offset) < data.size())
+            p = data.data() + dataPosition(raw, index[entry].offset);
+    }
+
+    Summary summary;
+    size_t compressed = 0, samples = 0, bad = 0, missing = 0;
+    uint32_t sequence = 0;
+    bool started = false;
+    int16_t block[CODEC_BLOCK_SAMPLES];
+    while (p + sizeof(BlockHeader) <= end)
+    {
+        BlockHeader header;
+        int length = checkRecord(p, end - p, BLOCK_ANY_SESSION);
+        if (length < 0)
+        {
+            bad++;
+            p++; // Resynchronize on the next magic byte
+            continue;
+        }
+        memcpy(&header, p, sizeof(header));
+        if (header.time > to)
+            break;
+
+        // Rotated files continue the numbering of the previous file
+        if (started && header.sequence > sequence)
+            missing += header.sequence - sequence;
+        sequence = header.sequence + 1;
+        started = true;
+
+        // Entries lying entirely in the range are summed up without decoding their records
+        if (option == 's' && entry < index.size() && index[entry].sequence == header.sequence)
+        {
+            const BlockIndexEntry &current = index[entry];
+            bool last = entry + 1 == index.size();
+            uint32_t next = last ? UINT32_MAX : index[entry + 1].time;
+            if (current.time >= from && next <= to && !last)
+            {
+                summary.count += current.count;
+                samples += current.count;
+                summary.sum += current.sum;
+                summary.minimum = current.minimum < summary.minimum ? current.minimum : summary.minimum;
+                summary.maximum = current.maximum > summary.maximum ? current.maximum : summary.maximum;
+                sequence = index[entry + 1].sequence;
+                compressed += dataPosition(raw, index[entry + 1].offset) - dataPosition(raw, current.offset);
+                p = data.data() + dataPosition(raw, index[entry + 1].offset);
+                entry++;
+                continue;
+            }
+            entry++;
+        }
+
+        int count = decodeBlock(p + sizeof(header), header.length, block, CODEC_BLOCK_SAMPLES);
+        if (count < 0)
+        {
+            bad++;
+            p++;
+            continue;
+        }
+        if (header.time >= from)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if (option == 's')
+                {
+                    summary.count++;
+                    summary.sum += block[i];
+                    summary.minimum = block[i] < summary.minimum ? block[i] : summary.minimum;
+                    summary.maximum = block[i] > summary.maximum ? block[i] : summary.maximum;
+                }
+                else
+                {
+                    printf("%u %u %d\n", header.first + i, header.time, block[i]);
+                }
+            }
+            samples += count;
+        }
+
+        compressed += length;
+        p += length;
+    }
+
+    if (option == 's' && summary.count == 0)
+        printf("0\n");
+    else if (option == 's')
+        printf("%llu %d %d %.2f\n", (unsigned long long)summary.count, summary.minimum, summary.maximum,
+               (double)summary.sum / summary.count);
+    fprintf(stderr, "%zu samples, %zu bytes, ratio %.2f, %zu bad bytes skipped, %zu records missing\n", samples,
+            compressed, compressed ? 2.0 * samples / compressed : 0.0, bad, missing);
+    return 0;
+}
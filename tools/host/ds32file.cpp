@@ -0,0 +1,534 @@
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ds32file.h"
+#include "../../include/format.h"
+#include "../../include/storage_format.h"
+
+// Samples converted and written per batch by writeCsv() and writeBinary()
+#define EXPORT_BATCH (1UL << 20)
+
+Ds32File::Ds32File()
+{
+    map = NULL;
+    mapSize = 0;
+    samples = 0;
+    damaged = 0;
+}
+
+Ds32File::~Ds32File()
+{
+    close();
+}
+
+/**
+ * @brief Maps a session file and locates its records.
+ *
+ * @param path The .ds32 file.
+ * @param threads The number of threads used to scan the file, 0 for one per core.
+ * @return true on success; getError() tells what went wrong otherwise.
+ */
+bool Ds32File::open(const char *path, unsigned threads)
+{
+    close();
+    this->path = path;
+
+    int fd = ::open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        error = path + std::string(": ") + strerror(errno);
+        if (fd >= 0)
+            ::close(fd);
+        return false;
+    }
+    mapSize = st.st_size;
+    if (mapSize > 0)
+    {
+        void *address = mmap(NULL, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        map = address == MAP_FAILED ? NULL : (const uint8_t *)address;
+    }
+    ::close(fd);
+    if (!map)
+    {
+        error = path + std::string(": cannot map the file");
+        return false;
+    }
+    madvise((void *)map, mapSize, MADV_SEQUENTIAL);
+
+    const uint8_t *data = map;
+    size_t length = mapSize;
+    if (length > 7 && map[7] == SESSION_MODE_RAW)
+    {
+        // All the sectors of a raw session are full but the last one
+        size_t sectors = 0;
+        while ((sectors + 1) * SD_SECTOR_SIZE <= mapSize)
+        {
+            SectorFooter footer;
+            memcpy(&footer, map + sectors * SD_SECTOR_SIZE + SD_SECTOR_PAYLOAD, sizeof(footer));
+            if (footer.length > SD_SECTOR_PAYLOAD)
+                break;
+            sectors++;
+            if (footer.length < SD_SECTOR_PAYLOAD)
+                break;
+        }
+
+        gathered.resize(sectors * SD_SECTOR_PAYLOAD);
+        parallelFor(sectors, threads, [&](size_t first, size_t last, unsigned) {
+            for (size_t sector = first; sector < last; sector++)
+                memcpy(&gathered[sector * SD_SECTOR_PAYLOAD], map + sector * SD_SECTOR_SIZE, SD_SECTOR_PAYLOAD);
+        });
+        if (sectors > 0)
+        {
+            SectorFooter footer;
+            memcpy(&footer, map + (sectors - 1) * SD_SECTOR_SIZE + SD_SECTOR_PAYLOAD, sizeof(footer));
+            gathered.resize((sectors - 1) * SD_SECTOR_PAYLOAD + footer.length);
+        }
+        data = gathered.data();
+        length = gathered.size();
+    }
+
+    size_t headerEnd;
+    if (!parseHeader(data, length, &headerEnd))
+        return false;
+
+    scan(data + headerEnd, data + length, threads);
+    return true;
+}
+
+/**
+ * @brief Unmaps the file and forgets its records.
+ */
+void Ds32File::close()
+{
+    if (map)
+        munmap((void *)map, mapSize);
+    map = NULL;
+    mapSize = 0;
+    gathered.clear();
+    records.clear();
+    samples = 0;
+    damaged = 0;
+}
+
+/**
+ * @brief Reads the text lines at the top of the file, up to the empty line that ends them.
+ *
+ * @param headerEnd Receives the position of the first record.
+ */
+bool Ds32File::parseHeader(const uint8_t *data, size_t length, size_t *headerEnd)
+{
+    const char *text = (const char *)data;
+    const char *end = (const char *)memmem(text, length, "\n\n", 2);
+    if (length < 9 || memcmp(text, "DS32 ", 5) != 0 || !end)
+    {
+        error = path + ": not a session file";
+        return false;
+    }
+
+    info = Ds32Info();
+    info.version = atoi(text + 5);
+    info.mode = text[7];
+    if (info.version != SESSION_FORMAT_VERSION)
+    {
+        error = path + ": format version " + std::to_string(info.version) + ", expected " +
+                std::to_string(SESSION_FORMAT_VERSION);
+        return false;
+    }
+
+    // "Key: value" lines, see preliminaryControl()
+    for (const char *line = (const char *)memchr(text, '\n', end - text) + 1; line < end;)
+    {
+        const char *lineEnd = (const char *)memchr(line, '\n', end + 1 - line);
+        const char *colon = (const char *)memchr(line, ':', lineEnd - line);
+        if (colon)
+        {
+            std::string key(line, colon - line);
+            std::string value(colon + 2 <= lineEnd ? colon + 2 : lineEnd, lineEnd);
+            if (key == "Current measure")
+                info.channel = value;
+            else if (key == "Gain")
+                info.gain = atof(value.c_str());
+            else if (key == "Offset")
+                info.offset = atof(value.c_str());
+            else if (key == "Array length (Sample rate)")
+                info.rate = atoi(value.c_str());
+            else if (key == "Factor")
+                info.factor = atof(value.c_str());
+            else if (key == "Start")
+                info.start = value;
+            else if (key == "Curve" && !parseCurve(value.c_str(), &info.curve))
+            {
+                error = path + ": invalid curve \"" + value + "\"";
+                return false;
+            }
+        }
+        line = lineEnd + 1;
+    }
+
+    *headerEnd = end + 2 - text;
+    return true;
+}
+
+/**
+ * @brief Locates the intact records between begin and end.
+ *
+ * Each thread takes an equal share of the bytes, starts at the first intact record at or
+ * after the beginning of its share and follows the records up to where the next share
+ * starts. Since a record is only accepted when its CRC matches, the shares meet exactly
+ * where a single thread would have gone; damaged bytes are skipped one at a time.
+ */
+void Ds32File::scan(const uint8_t *begin, const uint8_t *end, unsigned threads)
+{
+    size_t length = end - begin;
+    threads = threadCount(threads);
+    if (threads > length / BLOCK_MAX_SIZE + 1)
+        threads = length / BLOCK_MAX_SIZE + 1;
+
+    std::vector<const uint8_t *> starts(threads + 1, end);
+    std::vector<std::vector<Ds32Record>> found(threads);
+    std::vector<size_t> skipped(threads, 0);
+
+    parallelFor(threads, threads, [&](size_t first, size_t last, unsigned) {
+        for (size_t share = first; share < last; share++)
+        {
+            const uint8_t *p = begin + length * share / threads;
+            while (share > 0 && p < end && checkRecord(p, end - p, BLOCK_ANY_SESSION) < 0)
+                p++;
+            starts[share] = p;
+        }
+    });
+
+    parallelFor(threads, threads, [&](size_t first, size_t last, unsigned) {
+        for (size_t share = first; share < last; share++)
+        {
+            const uint8_t *p = starts[share];
+            while (p < starts[share + 1])
+            {
+                int recordLength = checkRecord(p, end - p, BLOCK_ANY_SESSION);
+                if (recordLength < 0)
+                {
+                    skipped[share]++;
+                    p++;
+                    continue;
+                }
+
+                BlockHeader header;
+                memcpy(&header, p, sizeof(header));
+                Ds32Record record;
+                record.data = p;
+                record.sample = 0;
+                record.first = header.first;
+                record.time = header.time;
+                record.count = p[sizeof(header) + 1] | p[sizeof(header) + 2] << 8;
+                record.length = header.length;
+                found[share].push_back(record);
+                p += recordLength;
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (unsigned share = 0; share < threads; share++)
+        total += found[share].size();
+    records.reserve(total);
+    for (unsigned share = 0; share < threads; share++)
+    {
+        records.insert(records.end(), found[share].begin(), found[share].end());
+        damaged += skipped[share];
+    }
+
+    samples = 0;
+    for (Ds32Record &record : records)
+    {
+        record.sample = samples;
+        samples += record.count;
+    }
+}
+
+const std::string &Ds32File::getError() const
+{
+    return error;
+}
+
+const Ds32Info &Ds32File::getInfo() const
+{
+    return info;
+}
+
+const std::vector<Ds32Record> &Ds32File::getRecords() const
+{
+    return records;
+}
+
+/**
+ * @brief Returns the number of samples in the intact records.
+ */
+uint64_t Ds32File::getSampleCount() const
+{
+    return samples;
+}
+
+size_t Ds32File::getFileSize() const
+{
+    return mapSize;
+}
+
+/**
+ * @brief Returns the number of bytes skipped because they did not belong to an intact record.
+ */
+size_t Ds32File::getDamagedBytes() const
+{
+    return damaged;
+}
+
+/**
+ * @brief Decodes the records [first, last) into consecutive samples.
+ *
+ * @param out Receives the samples, records[last - 1].sample + count - records[first].sample of them.
+ * @return true if every record was decoded.
+ */
+bool Ds32File::decode(size_t first, size_t last, int16_t *out) const
+{
+    bool decoded = true;
+    for (size_t i = first; i < last; i++)
+    {
+        const Ds32Record &record = records[i];
+        int16_t *destination = out + (record.sample - records[first].sample);
+        if (decodeBlock(record.data + sizeof(BlockHeader), record.length, destination, record.count) != record.count)
+        {
+            memset(destination, 0, record.count * sizeof(int16_t));
+            decoded = false;
+        }
+    }
+    return decoded;
+}
+
+/**
+ * @brief Decodes every record, splitting the records among threads.
+ *
+ * @param out Receives getSampleCount() samples.
+ */
+bool Ds32File::decodeAll(int16_t *out, unsigned threads) const
+{
+    std::vector<char> results(threadCount(threads), true);
+    parallelFor(records.size(), threads, [&](size_t first, size_t last, unsigned slice) {
+        if (first < last)
+            results[slice] = decode(first, last, out + records[first].sample);
+    });
+    for (char result : results)
+    {
+        if (!result)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Converts a number of counts, a sample or the mean of a window, by the curve of the
+ * session if it has one and else by its gain, offset and factor.
+ *
+ * Resistances of 0 counts or less are an open circuit, returned as infinity like on the logger.
+ */
+float Ds32File::convertCounts(float counts) const
+{
+    bool resistance = info.channel == "Resistance";
+    if (resistance && !(counts > 0))
+        return INFINITY;
+    if (info.curve.kind != CURVE_NONE)
+        return evaluateCurve(info.curve, counts);
+    if (resistance)
+        return info.factor * 3.3 / (counts * info.gain) - info.factor;
+    return counts * info.gain * info.factor - info.offset;
+}
+
+/**
+ * @brief Converts an ADC count to the measured quantity.
+ *
+ * Every sample is converted on its own, the current too: the RMS of the current is only
+ * defined over a window, see convertWindow().
+ */
+float Ds32File::convert(int16_t raw) const
+{
+    return convertCounts(raw);
+}
+
+/**
+ * @brief Converts an array of ADC counts like convert(), splitting it among threads.
+ */
+void Ds32File::convertAll(const int16_t *in, float *out, size_t count, unsigned threads) const
+{
+    // The channel is resolved once, not per sample
+    float scale = info.gain * info.factor;
+    float offset = info.offset;
+    float factor = info.factor;
+    int channel = info.curve.kind != CURVE_NONE ? 3 : info.channel == "Resistance" ? 2 : 0;
+
+    parallelFor(count, threads, [&](size_t first, size_t last, unsigned) {
+        switch (channel)
+        {
+        case 0:
+            for (size_t i = first; i < last; i++)
+                out[i] = in[i] * scale - offset;
+            break;
+        case 2:
+            for (size_t i = first; i < last; i++)
+                out[i] = in[i] > 0 ? factor * 3.3f / (in[i] * (float)info.gain) - factor : INFINITY;
+            break;
+        case 3:
+            for (size_t i = first; i < last; i++)
+                out[i] = convertCounts(in[i]);
+            break;
+        }
+    });
+}
+
+/**
+ * @brief Returns the value of a window the way conversionMeasurement() does on the logger:
+ * the mean of its counts, or for the current their RMS, converted.
+ *
+ * For a straight line this is also the mean of the converted samples.
+ */
+float Ds32File::convertWindow(const int16_t *in, size_t count) const
+{
+    if (count == 0)
+        return NAN;
+    bool current = info.channel == "Current";
+    double sum = 0;
+    for (size_t i = 0; i < count; i++)
+        sum += current ? (double)in[i] * in[i] : in[i];
+    return convertCounts(current ? sqrt(sum / count) : sum / count);
+}
+
+/**
+ * @brief Writes the samples as CSV lines "sample,time_ms,value", without a title line.
+ *
+ * The time of a sample is the time of its record plus its position in the record over the
+ * sample rate, when the header gives one. Batches of records are formatted in parallel and written in order.
+ *
+ * @param samples The output of decodeAll().
+ * @param converted Whether values are converted with convert() or written as ADC counts.
+ */
+bool Ds32File::writeCsv(FILE *out, const int16_t *samples, bool converted, unsigned threads) const
+{
+    threads = threadCount(threads);
+    std::vector<std::vector<char>> buffers(threads);
+
+    for (size_t batch = 0; batch < records.size();)
+    {
+        size_t batchEnd = batch;
+        while (batchEnd < records.size() && records[batchEnd].sample - records[batch].sample < EXPORT_BATCH)
+            batchEnd++;
+
+        parallelFor(batchEnd - batch, threads, [&](size_t first, size_t last, unsigned slice) {
+            std::vector<char> &buffer = buffers[slice];
+            size_t count = 0;
+            for (size_t i = batch + first; i < batch + last; i++)
+                count += records[i].count;
+            buffer.resize(count * 3 * FORMAT_NUMBER_SIZE);
+
+            char *end = buffer.data();
+            for (size_t i = batch + first; i < batch + last; i++)
+            {
+                const Ds32Record &record = records[i];
+                for (uint16_t n = 0; n < record.count; n++)
+                {
+                    int16_t raw = samples[record.sample + n];
+                    uint64_t micros = record.time * 1000ULL + (info.rate ? n * 1000000ULL / info.rate : 0);
+                    end = formatUInt(end, record.first + n);
+                    *end++ = ',';
+                    end = formatUInt(end, (uint32_t)(micros / 1000));
+                    *end++ = '.';
+                    *end++ = '0' + micros / 100 % 10;
+                    *end++ = '0' + micros / 10 % 10;
+                    *end++ = '0' + micros % 10;
+                    *end++ = ',';
+                    end = converted ? formatFixed(end, convert(raw), 6) : formatInt(end, raw);
+                    *end++ = '\n';
+                }
+            }
+            buffer.resize(end - buffer.data());
+        });
+
+        for (std::vector<char> &buffer : buffers)
+        {
+            if (fwrite(buffer.data(), 1, buffer.size(), out) != buffer.size())
+                return false;
+            buffer.clear();
+        }
+        batch = batchEnd;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the samples as a flat little-endian array: float32 values, or int16 ADC counts.
+ *
+ * @param samples The output of decodeAll().
+ */
+bool Ds32File::writeBinary(FILE *out, const int16_t *samples, bool converted, unsigned threads) const
+{
+    if (!converted)
+        return fwrite(samples, sizeof(int16_t), this->samples, out) == this->samples;
+
+    std::vector<float> values(EXPORT_BATCH);
+    for (uint64_t first = 0; first < this->samples; first += EXPORT_BATCH)
+    {
+        size_t count = this->samples - first < EXPORT_BATCH ? this->samples - first : EXPORT_BATCH;
+        convertAll(samples + first, values.data(), count, threads);
+        if (fwrite(values.data(), sizeof(float), count, out) != count)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the value of every window of the sample rate (one second) with convertWindow(),
+ * as CSV lines "window,value" or as float32 values.
+ *
+ * The windows are counted from the start of the acquisition, as on the logger; a window is
+ * made of the samples of the intact records that fall in it.
+ *
+ * @param samples The output of decodeAll().
+ * @return false if the header gives no sample rate or on a write error.
+ */
+bool Ds32File::writeWindows(FILE *out, const int16_t *samples, bool binary) const
+{
+    if (info.rate == 0)
+        return false;
+
+    std::vector<int16_t> window;
+    uint32_t current = 0;
+    auto flush = [&]() {
+        if (window.empty())
+            return true;
+        float value = convertWindow(window.data(), window.size());
+        window.clear();
+        if (binary)
+            return fwrite(&value, sizeof(value), 1, out) == 1;
+        char line[2 * FORMAT_NUMBER_SIZE + 2];
+        char *end = formatUInt(line, current);
+        *end++ = ',';
+        end = formatFixed(end, value, 6);
+        *end++ = '\n';
+        return fwrite(line, 1, end - line, out) == (size_t)(end - line);
+    };
+
+    for (const Ds32Record &record : records)
+    {
+        for (uint16_t n = 0; n < record.count; n++)
+        {
+            uint32_t index = (record.first + n) / info.rate;
+            if (index != current && !flush())
+                return false;
+            current = index;
+            window.push_back(samples[record.sample + n]);
+        }
+    }
+    return flush();
+}
@@ -0,0 +1,116 @@
+// ds32file.h
+#ifndef DS32FILE_H
+#define DS32FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../include/blocks.h"
+#include "../../include/calibration.h"
+
+// Reader for the session files written by the logger (.ds32), for the host tools.
+//
+// The file is memory-mapped and its records are located by several threads at once, each
+// starting from the first intact record in its share of the file. Records are decoded
+// straight from the mapping into one contiguous array of samples; raw sessions are first
+// gathered into a buffer without their sector footers.
+
+// Text header of a session, see openSession() and preliminaryControl() in the firmware
+struct Ds32Info
+{
+    int version;
+    char mode;              // SESSION_MODE_FILE or SESSION_MODE_RAW
+    std::string channel;    // "Voltage", "Current" or "Resistance"
+    double gain;            // K, volts per ADC count
+    double offset;          // O
+    double factor;          // Divider or shunt factor of the channel
+    unsigned rate;          // Samples per second
+    std::string start;      // "MM/DD/YYYY HH:MM:SS"
+    CalibrationCurve curve; // The calibration of the acquisition, CURVE_NONE if nominal
+};
+
+struct Ds32Record
+{
+    const uint8_t *data; // Header and payload
+    uint64_t sample;     // Position of its first sample in the decoded array
+    uint32_t first;      // Index of its first sample since the acquisition started
+    uint32_t time;       // Milliseconds since the acquisition started, at the first sample
+    uint16_t count;      // Samples in the record
+    uint16_t length;     // Size of the payload
+};
+
+class Ds32File
+{
+private:
+    std::string path;
+    std::string error;
+    const uint8_t *map;
+    size_t mapSize;
+    std::vector<uint8_t> gathered; // Payload of a raw session, without the footers
+    Ds32Info info;
+    std::vector<Ds32Record> records;
+    uint64_t samples;
+    size_t damaged;
+
+    bool parseHeader(const uint8_t *data, size_t length, size_t *headerEnd);
+    float convertCounts(float counts) const;
+    void scan(const uint8_t *begin, const uint8_t *end, unsigned threads);
+
+public:
+    Ds32File();
+    ~Ds32File();
+    bool open(const char *path, unsigned threads = 0);
+    void close();
+
+    const std::string &getError() const;
+    const Ds32Info &getInfo() const;
+    const std::vector<Ds32Record> &getRecords() const;
+    uint64_t getSampleCount() const;
+    size_t getFileSize() const;
+    size_t getDamagedBytes() const;
+
+    bool decode(size_t first, size_t last, int16_t *out) const;
+    bool decodeAll(int16_t *out, unsigned threads = 0) const;
+    float convert(int16_t raw) const;
+    void convertAll(const int16_t *in, float *out, size_t count, unsigned threads = 0) const;
+    float convertWindow(const int16_t *in, size_t count) const;
+
+    bool writeCsv(FILE *out, const int16_t *samples, bool converted, unsigned threads = 0) const;
+    bool writeBinary(FILE *out, const int16_t *samples, bool converted, unsigned threads = 0) const;
+    bool writeWindows(FILE *out, const int16_t *samples, bool binary) const;
+};
+
+/**
+ * @brief Resolves a requested number of threads, 0 meaning one per core.
+ */
+inline unsigned threadCount(unsigned threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1;
+}
+
+/**
+ * @brief Runs work(begin, end, slice) on `threads` consecutive slices of [0, count), one thread per slice.
+ *
+ * @param threads The number of threads, 0 for one per core.
+ */
+template <typename Work>
+void parallelFor(size_t count, unsigned threads, Work work)
+{
+    threads = threadCount(threads);
+    if (threads > count)
+        threads = count ? (unsigned)count : 1;
+
+    std::vector<std::thread> workers;
+    for (unsigned slice = 1; slice < threads; slice++)
+        workers.emplace_back(work, count * slice / threads, count * (slice + 1) / threads, slice);
+    work((size_t)0, count / threads, 0u);
+    for (std::thread &worker : workers)
+        worker.join();
+}
+#endif // DS32FILE_H
@@ -0,0 +1,265 @@
+// ds32recv: receives the sample stream of the logger in serial mode.
+//
+//   ds32recv [-b baud] [-o output] [-t timestamps] [-q] <device>
+//       -b  line speed (default 115200)
+//       -o  writes the samples as little-endian int16 ADC counts
+//       -t  synchronizes with the logger clock and writes the host time of the samples it
+//           time stamps (one per second) as CSV: sample,device_us,host_time (seconds since 1970)
+//       -q  only prints the statistics at the end
+//   Both the 0xCC frames and the compressed records (serialCompression) are understood.
+//   The statistics are printed every second on standard error.
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include "serialrx.h"
+#include "timesync.h"
+
+#define RING_SAMPLES (1 << 20)
+#define SYNC_INTERVAL 250   // Milliseconds between two time synchronization requests
+#define SYNC_MINIMUM 8      // Exchanges made before the first time stamps are written
+
+struct TimeMark
+{
+    uint32_t sample;
+    uint64_t device;
+};
+
+// State of the time synchronization and of the loss count, shared with the reply callback
+struct Timing
+{
+    const SerialReceiver *receiver;
+    ClockSync clock;
+    std::vector<TimeMark> marks; // Received, not written yet, NULL without -t
+    FILE *out;
+    bool marked;                 // Whether a time mark was received
+    uint32_t lastMark;           // Sample index of the last time mark
+    uint64_t restartsAtMark;     // Acquisitions started before the last time mark
+    uint64_t receivedAtMark;     // Samples received up to the last time mark
+    uint64_t lostSamples;        // Samples the logger sent between two marks that did not arrive
+};
+
+static uint32_t get32(const uint8_t *data)
+{
+    return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+static uint64_t get64(const uint8_t *data)
+{
+    return get32(data) | (uint64_t)get32(data + 4) << 32;
+}
+
+/**
+ * @brief Takes the time synchronization replies and the time marks out of the stream.
+ */
+static void receiveReply(const uint8_t *frame, size_t length, uint64_t readTime, void *context)
+{
+    Timing *timing = (Timing *)context;
+    uint8_t command = frame[1] & ~COMMAND_REPLY_FLAG;
+    const uint8_t *payload = frame + 3;
+    uint8_t payloadLength = frame[2];
+    if (length != (size_t)COMMAND_OVERHEAD + payloadLength || payloadLength == 0 || payload[0] != COMMAND_OK)
+        return;
+
+    if (command == COMMAND_TIME_SYNC && payloadLength == 25)
+    {
+        SyncExchange exchange = {get64(payload + 1), get64(payload + 9), get64(payload + 17), readTime};
+        timing->clock.addExchange(exchange);
+    }
+    else if (command == COMMAND_TIME_MARK && payloadLength == 13)
+    {
+        TimeMark mark = {get32(payload + 1), get64(payload + 5)};
+        if (timing->out)
+            timing->marks.push_back(mark);
+
+        // The marks number the samples, so they show the batches the logger dropped, even in 0xCC frames
+        const ReceiverStats &stats = timing->receiver->getStats();
+        uint64_t received = stats.samples + stats.overruns;
+        if (stats.restarts != timing->restartsAtMark || mark.sample < timing->lastMark)
+            timing->marked = false; // A new acquisition numbers its samples from 0 again
+        if (timing->marked && mark.sample - timing->lastMark > received - timing->receivedAtMark)
+            timing->lostSamples += mark.sample - timing->lastMark - (received - timing->receivedAtMark);
+        timing->marked = true;
+        timing->lastMark = mark.sample;
+        timing->restartsAtMark = stats.restarts;
+        timing->receivedAtMark = received;
+    }
+}
+
+/**
+ * @brief Writes the time marks received, once the clock estimate is good enough.
+ */
+static void writeMarks(Timing &timing)
+{
+    if (!timing.out || timing.clock.getExchangeCount() < SYNC_MINIMUM)
+        return;
+    for (const TimeMark &mark : timing.marks)
+        fprintf(timing.out, "%lu,%llu,%.6f\n", (unsigned long)mark.sample, (unsigned long long)mark.device,
+                timing.clock.toHost(mark.device) / 1e6);
+    timing.marks.clear();
+}
+
+/**
+ * @brief Sends a time synchronization request carrying the host time.
+ */
+static void requestSync(int fd)
+{
+    uint64_t now = hostMicros();
+    uint8_t payload[8];
+    for (int i = 0; i < 8; i++)
+        payload[i] = (uint8_t)(now >> (8 * i));
+    uint8_t frame[COMMAND_MAX_FRAME];
+    size_t size = encodeCommand(COMMAND_REQUEST, COMMAND_TIME_SYNC, payload, sizeof(payload), frame);
+    if (write(fd, frame, size) != (ssize_t)size)
+        perror("write");
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static void printStats(const ReceiverStats &stats, const Timing &timing, double seconds, double interval,
+                       uint64_t samplesBefore)
+{
+    fprintf(stderr,
+            "%8.1f s  %10llu samples  %7.0f S/s  %6llu records  %4llu resyncs  %6llu skipped bytes  "
+            "%4llu lost records  %6llu lost samples  %llu overruns\n",
+            seconds, (unsigned long long)stats.samples, interval > 0 ? (stats.samples - samplesBefore) / interval : 0.0,
+            (unsigned long long)stats.records, (unsigned long long)stats.resyncs,
+            (unsigned long long)stats.skippedBytes, (unsigned long long)stats.lostRecords,
+            (unsigned long long)timing.lostSamples, (unsigned long long)stats.overruns);
+}
+
+/**
+ * @brief Writes the waiting samples without copying them out of the ring.
+ */
+static bool drain(SerialReceiver &receiver, FILE *out)
+{
+    const int16_t *first, *second;
+    size_t firstLength, secondLength;
+    size_t count = receiver.peek(&first, &firstLength, &second, &secondLength);
+    bool written = true;
+    if (out)
+        written = fwrite(first, sizeof(int16_t), firstLength, out) == firstLength &&
+                  fwrite(second, sizeof(int16_t), secondLength, out) == secondLength;
+    receiver.consume(count);
+    return written;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned baud = 115200;
+    const char *output = NULL, *timestamps = NULL;
+    bool quiet = false;
+
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-' && argv[arg][1] != '\0'; arg++)
+    {
+        if (strcmp(argv[arg], "-b") == 0 && arg + 1 < argc)
+            baud = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc)
+            output = argv[++arg];
+        else if (strcmp(argv[arg], "-t") == 0 && arg + 1 < argc)
+            timestamps = argv[++arg];
+        else if (strcmp(argv[arg], "-q") == 0)
+            quiet = true;
+        else
+            break;
+    }
+    if (arg + 1 != argc)
+    {
+        fprintf(stderr, "usage: %s [-b baud] [-o output] [-t timestamps] [-q] <device>\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<int16_t> ring(RING_SAMPLES);
+    SerialReceiver receiver(ring.data(), ring.size());
+    if (!receiver.openDevice(argv[arg], baud))
+    {
+        perror(argv[arg]);
+        return 1;
+    }
+
+    FILE *out = NULL;
+    if (output && !(out = fopen(output, "wb")))
+    {
+        perror(output);
+        return 1;
+    }
+
+    Timing timing;
+    timing.receiver = &receiver;
+    timing.out = NULL;
+    timing.marked = false;
+    timing.lastMark = 0;
+    timing.restartsAtMark = 0;
+    timing.receivedAtMark = timing.lostSamples = 0;
+    receiver.setReplySink(receiveReply, &timing);
+    if (timestamps)
+    {
+        if (!(timing.out = fopen(timestamps, "w")))
+        {
+            perror(timestamps);
+            return 1;
+        }
+        fputs("sample,device_us,host_time\n", timing.out);
+    }
+
+    Clock::time_point start = Clock::now(), report = start, synchronized = start - std::chrono::seconds(1);
+    uint64_t reported = 0;
+    while (receiver.poll(timestamps ? SYNC_INTERVAL / 2 : 100) >= 0)
+    {
+        if (timestamps)
+        {
+            if (Clock::now() - synchronized >= std::chrono::milliseconds(SYNC_INTERVAL))
+            {
+                requestSync(receiver.getDescriptor());
+                synchronized = Clock::now();
+            }
+            writeMarks(timing);
+        }
+
+        if (!drain(receiver, out))
+        {
+            perror(output);
+            return 1;
+        }
+        if (!quiet && Clock::now() - report >= std::chrono::seconds(1))
+        {
+            Clock::time_point now = Clock::now();
+            printStats(receiver.getStats(), timing, std::chrono::duration<double>(now - start).count(),
+                       std::chrono::duration<double>(now - report).count(), reported);
+            if (timestamps && timing.clock.isReady())
+                fprintf(stderr, "          clock offset %.6f s, drift %.1f ppm, round trip %.0f us, error < %.0f us\n",
+                        timing.clock.getOffset(hostMicros()) / 1e6, timing.clock.getDrift(),
+                        timing.clock.getDelay(), timing.clock.getError());
+            reported = receiver.getStats().samples;
+            report = now;
+        }
+    }
+    drain(receiver, out);
+
+    const ReceiverStats &stats = receiver.getStats();
+    Clock::time_point now = Clock::now();
+    printStats(stats, timing, std::chrono::duration<double>(now - start).count(),
+               std::chrono::duration<double>(now - report).count(), reported);
+    fprintf(stderr, "%llu bytes, %llu frames, %llu command replies\n", (unsigned long long)stats.bytes,
+            (unsigned long long)stats.frames, (unsigned long long)stats.replies);
+    if (out && fclose(out) != 0)
+    {
+        perror(output);
+        return 1;
+    }
+    if (timing.out)
+    {
+        writeMarks(timing);
+        if (fclose(timing.out) != 0)
+        {
+            perror(timestamps);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,232 @@
+// fitcheck: checks the least-squares fit of the guided calibration (fitCurve() in calibration.h).
+//
+//   fitcheck
+//   Fits exact lines and cubics over the range of the ADC and checks that their coefficients
+//   come back, checks that too few points, repeated counts and degrees out of range are
+//   refused, that counts bunched far from zero still give the curve through them, and compares
+//   the coefficients and the residual of noisy points with the solution of the normal equations
+//   in long double. Prints every failure and exits with 1 if there is one.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "../../include/calibration.h"
+
+static int failures;
+
+static void expect(bool passed, const char *what)
+{
+    if (!passed && failures++ < 20)
+        printf("FAIL: %s\n", what);
+}
+
+/**
+ * @brief Tells whether the coefficients of a fit are those of a polynomial, each to within a
+ * fraction of the largest value the polynomial takes over the counts.
+ */
+static bool sameCurve(const CalibrationCurve &curve, const double *expected, uint8_t columns, double range,
+                      double tolerance)
+{
+    if (curve.kind != CURVE_POLYNOMIAL || curve.count != columns)
+        return false;
+    double largest = 0;
+    for (uint8_t j = 0; j < columns; j++)
+        largest += fabs(expected[j]) * pow(range, j);
+    for (uint8_t j = 0; j < columns; j++)
+    {
+        if (fabs(curve.values[j] - expected[j]) * pow(range, j) > tolerance * largest)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Fits points taken exactly on a polynomial, and checks it comes back with a residual
+ * of float rounding.
+ *
+ * @param range The largest magnitude of the counts the coefficients are compared over, 0 to only
+ * check the residual: counts bunched far from zero fix the curve through them, not its coefficients.
+ */
+static void checkExact(const char *name, const double *coefficients, uint8_t degree, const float *counts,
+                       uint8_t points, double range)
+{
+    float values[CALIBRATION_MAX_POINTS];
+    double largest = 0;
+    for (uint8_t i = 0; i < points; i++)
+    {
+        double value = 0;
+        for (int j = degree; j >= 0; j--)
+            value = value * counts[i] + coefficients[j];
+        values[i] = (float)value;
+        largest = fmax(largest, fabs(value));
+    }
+
+    CalibrationCurve curve;
+    float residual;
+    bool fitted = fitCurve(counts, values, points, degree, &curve, &residual);
+    char what[96];
+    snprintf(what, sizeof(what), "%s: not fitted", name);
+    expect(fitted, what);
+    if (!fitted)
+        return;
+    snprintf(what, sizeof(what), "%s: coefficients differ", name);
+    expect(range == 0 || sameCurve(curve, coefficients, degree + 1, range, 1e-5), what);
+    snprintf(what, sizeof(what), "%s: residual %g", name, residual);
+    expect(residual <= 1e-5 * largest, what);
+}
+
+/**
+ * @brief Solves the least-squares problem by the normal equations in long double, in the counts
+ * centred and scaled like fitCurve() does, and expands the result to powers of the counts.
+ */
+static void referenceFit(const float *counts, const float *values, uint8_t points, uint8_t degree, double *expanded,
+                         double *residual)
+{
+    uint8_t columns = degree + 1;
+    long double low = counts[0], high = counts[0];
+    for (uint8_t i = 1; i < points; i++)
+    {
+        low = fminl(low, counts[i]);
+        high = fmaxl(high, counts[i]);
+    }
+    long double centre = (low + high) / 2, scale = (high - low) / 2;
+
+    long double normal[4][5] = {};
+    for (uint8_t i = 0; i < points; i++)
+    {
+        long double t = (counts[i] - centre) / scale, powers[4] = {1, t, t * t, t * t * t};
+        for (uint8_t r = 0; r < columns; r++)
+        {
+            for (uint8_t c = 0; c < columns; c++)
+                normal[r][c] += powers[r] * powers[c];
+            normal[r][columns] += powers[r] * values[i];
+        }
+    }
+
+    // Gauss-Jordan with partial pivoting
+    for (uint8_t k = 0; k < columns; k++)
+    {
+        uint8_t pivot = k;
+        for (uint8_t r = k + 1; r < columns; r++)
+        {
+            if (fabsl(normal[r][k]) > fabsl(normal[pivot][k]))
+                pivot = r;
+        }
+        for (uint8_t c = 0; c <= columns; c++)
+        {
+            long double swap = normal[k][c];
+            normal[k][c] = normal[pivot][c];
+            normal[pivot][c] = swap;
+        }
+        for (uint8_t r = 0; r < columns; r++)
+        {
+            if (r == k)
+                continue;
+            long double factor = normal[r][k] / normal[k][k];
+            for (uint8_t c = k; c <= columns; c++)
+                normal[r][c] -= factor * normal[k][c];
+        }
+    }
+
+    long double fitted[4], powers[4] = {0, 0, 0, 0};
+    for (uint8_t j = 0; j < columns; j++)
+        fitted[j] = normal[j][columns] / normal[j][j];
+    for (int j = columns - 1; j >= 0; j--)
+    {
+        for (int m = columns - 1; m >= 0; m--)
+            powers[m] = ((m > 0 ? powers[m - 1] : 0) - centre * powers[m]) / scale;
+        powers[0] += fitted[j];
+    }
+    for (uint8_t j = 0; j < columns; j++)
+        expanded[j] = (double)powers[j];
+
+    long double squares = 0;
+    for (uint8_t i = 0; i < points; i++)
+    {
+        long double t = (counts[i] - centre) / scale, value = 0;
+        for (int j = columns - 1; j >= 0; j--)
+            value = value * t + fitted[j];
+        squares += (value - values[i]) * (value - values[i]);
+    }
+    *residual = (double)sqrtl(squares / points);
+}
+
+int main()
+{
+    CalibrationCurve curve;
+    float residual;
+
+    // Exact curves over the whole range of the ADC, and over part of it
+    const float spread[] = {-32768, -24000, -9000, -10, 0, 700, 12000, 25000, 32767};
+    const float positive[] = {0, 1000, 5000, 10000, 20000, 32767};
+    const double line[] = {-0.0025, 0.000812659};
+    const double cubic[] = {0.5, 0.0021, -3.1e-9, 4.7e-14};
+    checkExact("line over the range", line, 1, spread, 9, 32768);
+    checkExact("line over positive counts", line, 1, positive, 6, 32768);
+    checkExact("line through 2 points", line, 1, positive, 2, 1000);
+    checkExact("cubic over the range", cubic, 3, spread, 9, 32768);
+    checkExact("cubic through 4 points", cubic, 3, positive + 1, 4, 32768);
+    checkExact("quadratic over positive counts", cubic, 2, positive, 6, 32768);
+
+    // Fewer points than coefficients, degrees out of range, too many points
+    const float values[CALIBRATION_MAX_POINTS + 1] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+    const float counts[CALIBRATION_MAX_POINTS + 1] = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150, 160};
+    for (uint8_t degree = 1; degree <= 3; degree++)
+    {
+        for (uint8_t points = 0; points <= degree; points++)
+        {
+            char what[64];
+            snprintf(what, sizeof(what), "degree %u fitted to %u points", degree, points);
+            expect(!fitCurve(counts, values, points, degree, &curve, &residual), what);
+        }
+    }
+    expect(!fitCurve(counts, values, 5, 0, &curve, &residual), "degree 0 fitted");
+    expect(!fitCurve(counts, values, 5, 4, &curve, &residual), "degree 4 fitted");
+    expect(!fitCurve(counts, values, CALIBRATION_MAX_POINTS + 1, 1, &curve, &residual), "17 points fitted");
+    expect(fitCurve(counts, values, CALIBRATION_MAX_POINTS, 3, &curve, &residual), "16 points refused");
+
+    // Ill-conditioned counts: all the same, or fewer different ones than coefficients
+    const float same[] = {1200, 1200, 1200, 1200, 1200};
+    const float twoCounts[] = {100, 100, 5000, 5000, 100, 5000};
+    const float threeCounts[] = {-300, 0, 300, 300, 0, -300};
+    expect(!fitCurve(same, values, 5, 1, &curve, &residual), "line through one count");
+    expect(!fitCurve(twoCounts, values, 6, 2, &curve, &residual), "quadratic through two counts");
+    expect(!fitCurve(threeCounts, values, 6, 3, &curve, &residual), "cubic through three counts");
+    expect(fitCurve(twoCounts, values, 6, 1, &curve, &residual), "line through two counts refused");
+
+    // Counts bunched far from zero, where the powers of the counts are nearly collinear
+    const float bunched[] = {30000, 30001, 30002, 30004, 30007};
+    checkExact("line through bunched counts", line, 1, bunched, 5, 0);
+    checkExact("cubic through bunched counts", cubic, 3, bunched, 5, 0);
+    const float narrow[] = {-20, -10, -3, 0, 4, 11, 20};
+    checkExact("cubic through counts near 0", cubic, 3, narrow, 7, 20);
+
+    // Noisy points: the fit must match the least-squares solution computed another way
+    const float noisyCounts[] = {-30000, -21000, -15000, -8000, -2000, 0, 3000, 9000, 14000, 20000, 26000, 32000};
+    for (uint8_t degree = 1; degree <= 3; degree++)
+    {
+        float noisy[12];
+        for (uint8_t i = 0; i < 12; i++)
+        {
+            double value = 0;
+            for (int j = degree; j >= 0; j--)
+                value = value * noisyCounts[i] + cubic[j];
+            noisy[i] = (float)(value + 0.01 * ((i * 7 % 5) - 2)); // Known, uneven errors of up to 0.02
+        }
+        double expected[4], expectedResidual;
+        referenceFit(noisyCounts, noisy, 12, degree, expected, &expectedResidual);
+        char what[96];
+        bool fitted = fitCurve(noisyCounts, noisy, 12, degree, &curve, &residual);
+        snprintf(what, sizeof(what), "noisy degree %u: not fitted", degree);
+        expect(fitted, what);
+        if (!fitted)
+            continue;
+        snprintf(what, sizeof(what), "noisy degree %u: coefficients differ from the reference", degree);
+        expect(sameCurve(curve, expected, degree + 1, 32768, 1e-5), what);
+        snprintf(what, sizeof(what), "noisy degree %u: residual %g instead of %g", degree, residual, expectedResidual);
+        expect(fabs(residual - expectedResidual) <= 1e-3 * expectedResidual + 1e-5, what);
+    }
+
+    printf("%d failures\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+// formatbench: times the formatting kernel of the firmware (format.h) on the host, against the
+// String code it replaced, and checks a few of its outputs.
+//
+//   formatbench [runs]
+//   Formats `runs` time stamps, date stamps and resistances (1000000 by default) both ways, and
+//   prints the time per call. The String paths run on a stand-in for the Arduino String below,
+//   which grows its buffer with realloc() and converts numbers with utoa() and dtostrf() as the
+//   ESP32 core does, so the comparison counts the same heap traffic, not the same cycles.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../include/format.h"
+
+// A stand-in for the Arduino String (WString.h), with the operations the old code used
+class StringSumHelper;
+
+class String
+{
+protected:
+    char *buffer;
+    unsigned int capacity;
+    unsigned int len;
+
+    void init()
+    {
+        buffer = NULL;
+        capacity = 0;
+        len = 0;
+    }
+
+    bool reserve(unsigned int size)
+    {
+        if (buffer && capacity >= size)
+            return true;
+        char *grown = (char *)realloc(buffer, size + 1);
+        if (!grown)
+            return false;
+        if (!buffer)
+            grown[0] = '\0';
+        buffer = grown;
+        capacity = size;
+        return true;
+    }
+
+    void copy(const char *text, unsigned int length)
+    {
+        if (!reserve(length))
+            return;
+        len = length;
+        memcpy(buffer, text, length + 1);
+    }
+
+public:
+    String(const char *text = "")
+    {
+        init();
+        copy(text, strlen(text));
+    }
+    String(const String &other)
+    {
+        init();
+        copy(other.c_str(), other.len);
+    }
+    String(String &&other)
+    {
+        buffer = other.buffer;
+        capacity = other.capacity;
+        len = other.len;
+        other.init();
+    }
+    String(float value, unsigned char decimals = 2)
+    {
+        // dtostrf() of the ESP32 core: a sprintf() with a built format
+        char text[33], format[16];
+        init();
+        snprintf(format, sizeof(format), "%%%d.%df", decimals + 2, decimals);
+        snprintf(text, sizeof(text), format, value);
+        copy(text, strlen(text));
+    }
+    ~String() { free(buffer); }
+
+    String &operator=(const String &other)
+    {
+        if (this != &other)
+            copy(other.c_str(), other.len);
+        return *this;
+    }
+    String &operator=(String &&other)
+    {
+        if (this != &other)
+        {
+            free(buffer);
+            buffer = other.buffer;
+            capacity = other.capacity;
+            len = other.len;
+            other.init();
+        }
+        return *this;
+    }
+
+    bool concat(const char *text, unsigned int length)
+    {
+        if (!reserve(len + length))
+            return false;
+        memcpy(buffer + len, text, length + 1);
+        len += length;
+        return true;
+    }
+    bool concat(unsigned int value)
+    {
+        // utoa() of the ESP32 core
+        char text[1 + 8 * sizeof(unsigned int)];
+        char *p = text + sizeof(text) - 1;
+        *p = '\0';
+        do
+        {
+            *--p = (char)('0' + value % 10);
+            value /= 10;
+        } while (value);
+        return concat(p, (unsigned int)(text + sizeof(text) - 1 - p));
+    }
+
+    const char *c_str() const { return buffer ? buffer : ""; }
+    unsigned int length() const { return len; }
+
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, const char *text);
+    friend StringSumHelper &operator+(const StringSumHelper &lhs, unsigned int value);
+};
+
+class StringSumHelper : public String
+{
+public:
+    StringSumHelper(const String &text) : String(text) {}
+};
+
+StringSumHelper &operator+(const StringSumHelper &lhs, const char *text)
+{
+    StringSumHelper &sum = const_cast<StringSumHelper &>(lhs);
+    sum.concat(text, strlen(text));
+    return sum;
+}
+
+StringSumHelper &operator+(const StringSumHelper &lhs, unsigned int value)
+{
+    StringSumHelper &sum = const_cast<StringSumHelper &>(lhs);
+    sum.concat(value);
+    return sum;
+}
+
+// The String code of the firmware before format.h
+static String stringTimeStamp(uint8_t hour, uint8_t minute, uint8_t second)
+{
+    String currentTime = "";
+    if (hour < 10)
+        currentTime = currentTime + "0";
+    currentTime = currentTime + (unsigned int)hour + ":";
+    if (minute < 10)
+        currentTime = currentTime + "0";
+    currentTime = currentTime + (unsigned int)minute + ":";
+    if (second < 10)
+        currentTime = currentTime + "0";
+    currentTime = currentTime + (unsigned int)second;
+    return currentTime;
+}
+
+static String stringDateStamp(uint8_t month, uint8_t day, uint16_t year)
+{
+    String currentDate = "";
+    if (month < 10)
+        currentDate = currentDate + "0";
+    currentDate = currentDate + (unsigned int)month + "/";
+    if (day < 10)
+        currentDate = currentDate + "0";
+    currentDate = currentDate + (unsigned int)day;
+    currentDate = currentDate + "/" + (unsigned int)year;
+    return currentDate;
+}
+
+static String stringEngineering(float measure)
+{
+    if (fabsf(measure) >= 1000000)
+        return String(measure / 1000000);
+    if (fabsf(measure) >= 1000)
+        return String(measure / 1000);
+    return String(measure);
+}
+
+static uint64_t nanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static volatile size_t sink;
+static int failures;
+
+static void expect(const char *got, const char *expected, char prefix, char expectedPrefix)
+{
+    if (strcmp(got, expected) != 0 || prefix != expectedPrefix)
+    {
+        fprintf(stderr, "FAIL: \"%s\" prefix '%c', expected \"%s\" prefix '%c'\n", got, prefix ? prefix : ' ',
+                expected, expectedPrefix ? expectedPrefix : ' ');
+        failures++;
+    }
+}
+
+/**
+ * @brief Checks the kernel against the String code, and the engineering prefixes at the limits.
+ */
+static void check()
+{
+    char buffer[FORMAT_NUMBER_SIZE], prefix;
+
+    for (unsigned second = 0; second < 86400; second += 37)
+    {
+        formatTime(buffer, second / 3600, second / 60 % 60, second % 60);
+        String old = stringTimeStamp(second / 3600, second / 60 % 60, second % 60);
+        expect(buffer, old.c_str(), 0, 0);
+    }
+    for (unsigned day = 1; day <= 31; day++)
+    {
+        formatDate(buffer, day % 12 + 1, day, 2024);
+        String old = stringDateStamp(day % 12 + 1, day, 2024);
+        expect(buffer, old.c_str(), 0, 0);
+    }
+
+    static const struct
+    {
+        float value;
+        const char *text;
+        char prefix;
+    } limits[] = {
+        {999.99f, "999.99", 0},     {999.996f, "1.00", 'k'},   {1000.0f, "1.00", 'k'},
+        {-999.996f, "-1.00", 'k'},  {999994.0f, "999.99", 'k'}, {999996.0f, "1.00", 'M'},
+        {1000000.0f, "1.00", 'M'}, {4700.0f, "4.70", 'k'},    {22.5f, "22.50", 0},
+    };
+    for (size_t i = 0; i < sizeof(limits) / sizeof(limits[0]); i++)
+    {
+        formatEngineering(buffer, limits[i].value, 2, &prefix);
+        expect(buffer, limits[i].text, prefix, limits[i].prefix);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned runs = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    if (argc > 2 || runs == 0)
+    {
+        fprintf(stderr, "usage: %s [runs]\n", argv[0]);
+        return 2;
+    }
+
+    check();
+    if (failures)
+        return 1;
+
+    char buffer[FORMAT_NUMBER_SIZE], prefix;
+    uint64_t start;
+    double kernel, string;
+
+    printf("%-12s %12s %12s %8s\n", "", "format.h ns", "String ns", "ratio");
+
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += formatTime(buffer, i / 3600 % 24, i / 60 % 60, i % 60) - buffer;
+    kernel = (double)(nanoseconds() - start) / runs;
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += stringTimeStamp(i / 3600 % 24, i / 60 % 60, i % 60).length();
+    string = (double)(nanoseconds() - start) / runs;
+    printf("%-12s %12.1f %12.1f %8.1f\n", "time", kernel, string, string / kernel);
+
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += formatDate(buffer, i % 12 + 1, i % 28 + 1, 2024) - buffer;
+    kernel = (double)(nanoseconds() - start) / runs;
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += stringDateStamp(i % 12 + 1, i % 28 + 1, 2024).length();
+    string = (double)(nanoseconds() - start) / runs;
+    printf("%-12s %12.1f %12.1f %8.1f\n", "date", kernel, string, string / kernel);
+
+    // Resistances from 21 ohm to 4.7 Mohm, as shown by the ohmmeter
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += formatEngineering(buffer, 21.0f * (1 + i % 223) * (1 + i % 1009), 2, &prefix) - buffer;
+    kernel = (double)(nanoseconds() - start) / runs;
+    start = nanoseconds();
+    for (unsigned i = 0; i < runs; i++)
+        sink += stringEngineering(21.0f * (1 + i % 223) * (1 + i % 1009)).length();
+    string = (double)(nanoseconds() - start) / runs;
+    printf("%-12s %12.1f %12.1f %8.1f\n", "engineering", kernel, string, string / kernel);
+    return 0;
+}
@@ -0,0 +1,169 @@
+// mqtthost: runs the MQTT publisher of the logger on the host, with a simulated acquisition, so
+// it can be tried against a local broker: mosquitto -v, then mosquitto_sub -v -t 'ds32/#'.
+//
+//   mqtthost [-b address] [-p port] [-r rate] [-R] [-s spool] [-n seconds] [-i id]
+//       -b  IPv4 address of the broker (default 127.0.0.1)
+//       -p  its port (default 1883)
+//       -r  samples per second (default 860)
+//       -R  publishes the samples too, not only the statistics of the windows
+//       -s  spool file (default mqtthost.spool), which plays the file on the card
+//       -n  ends the acquisition after that many seconds, then waits up to MQTT_TIMEOUT ms for
+//           the messages to be delivered and exits (default: never)
+//       -i  client id (default host), so the topics are ds32/host/stats and ds32/host/raw
+//   The publisher and the statistics are the ones built into the firmware (src/mqtt.cpp,
+//   src/live.cpp). Sample i is simulatedSample(i) of webhost. Stopping the broker and starting
+//   it again shows the messages going to the spool and coming back in order. The state of the
+//   connection is printed every second, and the metrics of the publisher at the end.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../include/ads1115.h"
+#include "../../include/live.h"
+#include "../../include/metrics.h"
+#include "../../include/mqtt.h"
+
+#define SIMULATED_GAIN adcLsb(ADC_CHANNELS[0].gain) // Volts per count of the voltage channel
+#define SIMULATED_FACTOR ADC_CHANNELS[0].factor
+
+static const char *spoolPath = "mqtthost.spool";
+static FILE *spoolWriter = NULL;
+
+static bool appendSpool(const uint8_t *data, size_t length)
+{
+    if (!spoolWriter)
+        spoolWriter = fopen(spoolPath, "ab");
+    if (!spoolWriter || fwrite(data, 1, length, spoolWriter) != length)
+        return false;
+    return fflush(spoolWriter) == 0;
+}
+
+static size_t readSpool(uint32_t position, uint8_t *data, size_t length)
+{
+    FILE *file = fopen(spoolPath, "rb");
+    if (!file)
+        return 0;
+    size_t read = fseek(file, position, SEEK_SET) == 0 ? fread(data, 1, length, file) : 0;
+    fclose(file);
+    return read;
+}
+
+static uint32_t spoolSize()
+{
+    FILE *file = fopen(spoolPath, "rb");
+    if (!file)
+        return 0;
+    fseek(file, 0, SEEK_END);
+    uint32_t size = (uint32_t)ftell(file);
+    fclose(file);
+    return size;
+}
+
+static void clearSpool()
+{
+    if (spoolWriter)
+        fclose(spoolWriter);
+    spoolWriter = NULL;
+    remove(spoolPath);
+}
+
+static uint32_t hostMillis()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static int16_t simulatedSample(uint32_t i)
+{
+    return (int16_t)(8000 * sin(i * 0.01) + (int)(i * 2654435761U >> 28) - 8);
+}
+
+int main(int argc, char **argv)
+{
+    const char *broker = "127.0.0.1", *clientId = "host";
+    unsigned port = MQTT_PORT, rate = 860, seconds = 0;
+    bool raw = false;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "-b") == 0 && arg + 1 < argc)
+            broker = argv[++arg];
+        else if (strcmp(argv[arg], "-p") == 0 && arg + 1 < argc)
+            port = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+            rate = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-R") == 0)
+            raw = true;
+        else if (strcmp(argv[arg], "-s") == 0 && arg + 1 < argc)
+            spoolPath = argv[++arg];
+        else if (strcmp(argv[arg], "-n") == 0 && arg + 1 < argc)
+            seconds = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-i") == 0 && arg + 1 < argc)
+            clientId = argv[++arg];
+        else
+        {
+            fprintf(stderr, "usage: %s [-b address] [-p port] [-r rate] [-R] [-s spool] [-n seconds] [-i id]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (rate == 0)
+        rate = 860;
+
+    static const char *stateNames[] = {"disconnected", "connecting", "waiting for CONNACK", "connected"};
+    static HttpServer server; // Not listening: the live stream only computes the statistics
+    static LiveStream live(server);
+    static MqttPublisher publisher(MqttSpool{appendSpool, readSpool, spoolSize, clearSpool});
+    publisher.begin(broker, port, clientId);
+    live.begin(0, rate, SIMULATED_GAIN, 0, SIMULATED_FACTOR);
+    publisher.start(0, rate, SIMULATED_GAIN * SIMULATED_FACTOR, (uint32_t)time(NULL), raw);
+    fprintf(stderr, "publishing to %s:%u as %s\n", broker, port, clientId);
+
+    uint32_t start = hostMillis(), ended = 0, sample = 0, status = start;
+    double sum = 0;
+    bool acquiring = true;
+    for (;;)
+    {
+        uint32_t now = hostMillis();
+        publisher.poll(now);
+
+        while (acquiring && (uint64_t)sample * 1000 < (uint64_t)(now - start) * rate)
+        {
+            int16_t value = simulatedSample(sample++);
+            live.insert(value);
+            publisher.insert(value);
+            sum += value;
+            if (sample % rate == 0)
+            {
+                const LiveStats *statistics = live.endWindow((float)(sum / rate * SIMULATED_GAIN * SIMULATED_FACTOR));
+                if (statistics)
+                    publisher.addWindow(*statistics);
+                sum = 0;
+            }
+        }
+        if (acquiring && seconds > 0 && now - start >= seconds * 1000UL)
+        {
+            acquiring = false;
+            ended = now;
+            live.end();
+            publisher.end();
+            fprintf(stderr, "acquisition stopped after %u samples\n", sample);
+        }
+        if (!acquiring && (publisher.getPending() == 0 || now - ended >= MQTT_TIMEOUT))
+            break;
+
+        if (now - status >= 1000)
+        {
+            status = now;
+            fprintf(stderr, "%s, %u bytes waiting\n", stateNames[publisher.getState()], publisher.getPending());
+        }
+        usleep(1000);
+    }
+
+    static char text[4096];
+    fwrite(text, 1, writeMetrics(text, sizeof(text)), stderr);
+    return publisher.getPending() == 0 ? 0 : 1;
+}
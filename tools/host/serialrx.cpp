@@ -0,0 +1,467 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "serialrx.h"
+#include "../../include/crc32.h"
+
+/**
+ * @brief Puts a serial device in raw mode at the given speed.
+ *
+ * @return false if the speed is not supported, or if the descriptor is not a terminal.
+ */
+bool setSerialSpeed(int fd, unsigned baud)
+{
+    speed_t speed;
+    switch (baud)
+    {
+    case 9600: speed = B9600; break;
+    case 57600: speed = B57600; break;
+    case 115200: speed = B115200; break;
+    case 230400: speed = B230400; break;
+    case 460800: speed = B460800; break;
+    case 921600: speed = B921600; break;
+#ifdef B1000000
+    case 1000000: speed = B1000000; break;
+    case 1500000: speed = B1500000; break;
+    case 2000000: speed = B2000000; break;
+    case 3000000: speed = B3000000; break;
+#endif
+    default: return false;
+    }
+
+    struct termios settings;
+    if (tcgetattr(fd, &settings) != 0)
+        return false;
+    cfmakeraw(&settings);
+    settings.c_cflag |= CLOCAL | CREAD;
+    cfsetispeed(&settings, speed);
+    cfsetospeed(&settings, speed);
+    return tcsetattr(fd, TCSANOW, &settings) == 0;
+}
+
+/**
+ * @brief Opens a serial device in raw mode, non-blocking.
+ *
+ * Pipes, FIFOs and files are accepted too; the line settings are then left alone.
+ *
+ * @param baud The line speed, for a real serial port.
+ * @return The descriptor, or -1 with errno set.
+ */
+int openSerialPort(const char *path, unsigned baud)
+{
+    int device = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (device < 0)
+        device = open(path, O_RDONLY | O_NONBLOCK);
+    if (device < 0)
+        return -1;
+
+    if (isatty(device))
+    {
+        setSerialSpeed(device, baud);
+        tcflush(device, TCIFLUSH);
+    }
+    return device;
+}
+
+/**
+ * @brief Returns the host wall-clock time in microseconds since 1970, the time base of the replies.
+ */
+uint64_t hostMicros()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * @brief Creates a receiver writing into a ring of samples owned by the caller.
+ *
+ * @param ring The ring buffer.
+ * @param capacity Its size in samples.
+ */
+SerialReceiver::SerialReceiver(int16_t *ring, size_t capacity)
+{
+    this->ring = ring;
+    this->capacity = capacity;
+    head = 0;
+    tail = 0;
+    writing = 0;
+    room = 0;
+    fd = -1;
+    pending = 0;
+    synchronized = false;
+    sequenced = false;
+    nextSequence = 0;
+    memset(&stats, 0, sizeof(stats));
+    replySink = NULL;
+    replyContext = NULL;
+    readTime = 0;
+}
+
+SerialReceiver::~SerialReceiver()
+{
+    if (fd >= 0)
+        close(fd);
+}
+
+/**
+ * @brief Opens a serial device with openSerialPort().
+ *
+ * @return true if the device was opened.
+ */
+bool SerialReceiver::openDevice(const char *path, unsigned baud)
+{
+    int device = openSerialPort(path, baud);
+    if (device < 0)
+        return false;
+    attach(device);
+    return true;
+}
+
+/**
+ * @brief Reads from an already open descriptor, which the receiver then owns.
+ */
+void SerialReceiver::attach(int fd)
+{
+    if (this->fd >= 0)
+        close(this->fd);
+    this->fd = fd;
+    pending = 0;
+    synchronized = false;
+}
+
+/**
+ * @brief Sets the function called with every command reply, e.g. for the time synchronization.
+ */
+void SerialReceiver::setReplySink(ReplySink sink, void *context)
+{
+    replySink = sink;
+    replyContext = context;
+}
+
+int SerialReceiver::getDescriptor() const
+{
+    return fd;
+}
+
+/**
+ * @brief Waits for data and decodes everything the device has, one large read at a time.
+ *
+ * @param timeout Milliseconds to wait for data, -1 to wait forever.
+ * @return The number of samples added to the ring, or -1 at the end of the stream or on error.
+ */
+long SerialReceiver::poll(int timeout)
+{
+    struct pollfd descriptor = {fd, POLLIN, 0};
+    int ready = ::poll(&descriptor, 1, timeout);
+    if (ready < 0)
+        return errno == EINTR ? 0 : -1;
+    if (ready == 0)
+        return 0;
+
+    ssize_t length = read(fd, buffer + pending, RX_CHUNK_SIZE);
+    if (length < 0)
+        return errno == EAGAIN || errno == EINTR ? 0 : -1;
+    if (length == 0)
+        return -1;
+    readTime = hostMicros();
+
+    uint64_t before = stats.samples;
+    size_t total = pending + length;
+    size_t used = process(buffer, total);
+    pending = total - used;
+    memmove(buffer, buffer + used, pending);
+    return (long)(stats.samples - before);
+}
+
+/**
+ * @brief Decodes bytes received by other means, e.g. read from a capture file.
+ *
+ * @return The number of samples added to the ring.
+ */
+size_t SerialReceiver::feed(const uint8_t *data, size_t length)
+{
+    uint64_t before = stats.samples;
+    readTime = 0;
+    while (length > 0)
+    {
+        size_t chunk = length < RX_CHUNK_SIZE ? length : RX_CHUNK_SIZE;
+        memcpy(buffer + pending, data, chunk);
+        data += chunk;
+        length -= chunk;
+
+        size_t total = pending + chunk;
+        size_t used = process(buffer, total);
+        pending = total - used;
+        memmove(buffer, buffer + used, pending);
+    }
+    return stats.samples - before;
+}
+
+/**
+ * @brief Finds the first byte that can start a frame or a record.
+ *
+ * Eight bytes are tested at a time: OR-ing every byte with 1 maps both 0xCC and 0xCD to
+ * 0xCD, and the XOR with 0xCD turns them into zero bytes, which the usual bit trick finds.
+ *
+ * @return The position of the byte, or length if there is none.
+ */
+size_t SerialReceiver::findCandidate(const uint8_t *data, size_t length)
+{
+    static_assert((RX_FRAME_START | 1) == BLOCK_MAGIC, "both start bytes must differ only in bit 0");
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+
+    size_t i = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        uint64_t x = (word | ones) ^ (BLOCK_MAGIC * ones);
+        uint64_t zeros = (x - ones) & ~x & highs; // The lowest flag is always exact
+        if (zeros)
+            return i + __builtin_ctzll(zeros) / 8;
+    }
+#endif
+    for (; i < length; i++)
+    {
+        if ((data[i] | 1) == BLOCK_MAGIC)
+            return i;
+    }
+    return length;
+}
+
+/**
+ * @brief Checks whether a frame or a record starts at data.
+ *
+ * Out of sync, a 0xCC frame is only accepted if RX_SYNC_FRAMES frame or record starts follow
+ * at the right distance, since the sample bytes can take the value 0xCC too. Command replies
+ * are only recognised in sync, between two frames or records.
+ *
+ * @param size Receives the size of the frame or record.
+ * @return 1 if it is valid, 0 if more bytes are needed to tell, -1 if it is not valid.
+ */
+int SerialReceiver::frameAt(const uint8_t *data, size_t length, size_t *size)
+{
+    if (data[0] == RX_FRAME_START)
+    {
+        size_t needed = synchronized ? RX_FRAME_SIZE : RX_FRAME_SIZE * RX_SYNC_FRAMES;
+        if (length < needed)
+            return 0;
+        for (size_t next = RX_FRAME_SIZE; next < needed; next += RX_FRAME_SIZE)
+        {
+            if ((data[next] | 1) != BLOCK_MAGIC)
+                return -1;
+        }
+        *size = RX_FRAME_SIZE;
+        return 1;
+    }
+
+    if (data[0] == BLOCK_MAGIC)
+    {
+        BlockHeader header;
+        if (length < sizeof(header))
+            return 0;
+        memcpy(&header, data, sizeof(header));
+        if (header.length > CODEC_MAX_SIZE)
+            return -1;
+        if (length < sizeof(header) + header.length)
+            return 0;
+        int recordLength = checkRecord(data, length, BLOCK_ANY_SESSION);
+        if (recordLength < 0)
+            return -1;
+        *size = recordLength;
+        return 1;
+    }
+
+    if (data[0] == COMMAND_REPLY && synchronized)
+    {
+        if (length < 3)
+            return 0;
+        if (data[2] > COMMAND_MAX_PAYLOAD)
+            return -1;
+        size_t frameLength = COMMAND_OVERHEAD + data[2];
+        if (length < frameLength)
+            return 0;
+        const uint8_t *crc = data + frameLength - 4;
+        uint32_t expected = crc[0] | (uint32_t)crc[1] << 8 | (uint32_t)crc[2] << 16 | (uint32_t)crc[3] << 24;
+        if (crc32(0, data + 1, 2 + data[2]) != expected)
+            return -1;
+        *size = frameLength;
+        return 1;
+    }
+    return -1;
+}
+
+inline void SerialReceiver::push(int16_t sample)
+{
+    if (room == 0)
+    {
+        stats.overruns++;
+        return;
+    }
+    ring[writing % capacity] = sample;
+    writing++;
+    room--;
+    stats.samples++;
+}
+
+/**
+ * @brief Decodes a compressed record into the ring, directly unless it would wrap around.
+ */
+void SerialReceiver::pushRecord(const uint8_t *record)
+{
+    BlockHeader header;
+    memcpy(&header, record, sizeof(header));
+    if (sequenced && (int32_t)(header.sequence - nextSequence) < 0)
+        restart();
+    if (sequenced && header.sequence != nextSequence)
+        stats.lostRecords += header.sequence - nextSequence;
+    sequenced = true;
+    nextSequence = header.sequence + 1;
+    stats.records++;
+
+    const uint8_t *payload = record + sizeof(header);
+    uint16_t count = payload[1] | payload[2] << 8;
+    size_t start = writing % capacity;
+    if (count <= room && count <= capacity - start)
+    {
+        if (decodeBlock(payload, header.length, ring + start, count) == count)
+        {
+            writing += count;
+            room -= count;
+            stats.samples += count;
+        }
+        return;
+    }
+
+    int16_t samples[CODEC_BLOCK_SAMPLES];
+    int decoded = decodeBlock(payload, header.length, samples, CODEC_BLOCK_SAMPLES);
+    for (int i = 0; i < decoded; i++)
+        push(samples[i]);
+}
+
+/**
+ * @brief Starts counting the records of a new acquisition, whose sequence starts again at 0.
+ */
+void SerialReceiver::restart()
+{
+    sequenced = false;
+    stats.restarts++;
+}
+
+/**
+ * @brief Decodes the frames and records in data.
+ *
+ * @return The number of bytes used; the rest is the beginning of an incomplete frame or record.
+ */
+size_t SerialReceiver::process(const uint8_t *data, size_t length)
+{
+    stats.bytes += length - pending;
+    writing = head.load(std::memory_order_relaxed);
+    room = capacity - (writing - tail.load(std::memory_order_acquire));
+
+    size_t i = 0;
+    while (i < length)
+    {
+        // Fast path: consecutive frames at a fixed stride
+        if (synchronized)
+        {
+            while (i + RX_FRAME_SIZE <= length && data[i] == RX_FRAME_START)
+            {
+                push((int16_t)(data[i + 1] << 8 | data[i + 2]));
+                stats.frames++;
+                i += RX_FRAME_SIZE;
+            }
+            if (i == length)
+                break;
+        }
+
+        size_t size;
+        int result = frameAt(data + i, length - i, &size);
+        if (result == 0)
+            break;
+        if (result > 0)
+        {
+            if (data[i] == RX_FRAME_START)
+            {
+                push((int16_t)(data[i + 1] << 8 | data[i + 2]));
+                stats.frames++;
+            }
+            else if (data[i] == BLOCK_MAGIC)
+            {
+                pushRecord(data + i);
+            }
+            else
+            {
+                stats.replies++;
+                if (replySink)
+                    replySink(data + i, size, readTime, replyContext);
+            }
+            synchronized = true;
+            i += size;
+            continue;
+        }
+
+        if (synchronized)
+        {
+            synchronized = false;
+            stats.resyncs++;
+        }
+        size_t skip = 1 + findCandidate(data + i + 1, length - i - 1);
+        // The header of a new acquisition is text, skipped whole up to its first frame or record
+        if (memmem(data + i, skip, RX_START_LINE, strlen(RX_START_LINE)))
+            restart();
+        stats.skippedBytes += skip;
+        i += skip;
+    }
+
+    head.store(writing, std::memory_order_release);
+    return i;
+}
+
+/**
+ * @brief Returns the number of samples waiting in the ring.
+ */
+size_t SerialReceiver::available() const
+{
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gives the waiting samples in place, as at most two spans (the ring may wrap around).
+ *
+ * @return The number of samples, firstLength + secondLength.
+ */
+size_t SerialReceiver::peek(const int16_t **first, size_t *firstLength, const int16_t **second,
+                            size_t *secondLength) const
+{
+    size_t start = tail.load(std::memory_order_relaxed);
+    size_t count = head.load(std::memory_order_acquire) - start;
+    size_t offset = start % capacity;
+
+    *first = ring + offset;
+    *firstLength = count < capacity - offset ? count : capacity - offset;
+    *second = ring;
+    *secondLength = count - *firstLength;
+    return count;
+}
+
+/**
+ * @brief Releases samples obtained with peek(), making room for new ones.
+ */
+void SerialReceiver::consume(size_t count)
+{
+    tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+const ReceiverStats &SerialReceiver::getStats() const
+{
+    return stats;
+}
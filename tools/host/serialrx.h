@@ -0,0 +1,93 @@
+// serialrx.h
+#ifndef SERIALRX_H
+#define SERIALRX_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../../include/blocks.h"
+#include "../../include/command.h"
+
+// Receiver for the stream sent by loggerActSerial(): 3-byte frames "0xCC hi lo" (big-endian
+// raw ADC counts) or, with serialCompression, compressed records starting with BLOCK_MAGIC.
+//
+// The device is read in large chunks. While the stream is in sync, frames are taken at a
+// fixed stride; after a bad byte the next candidate start byte is searched for 8 bytes at a
+// time, and a position is only accepted when the following frames line up as well (or the
+// record CRC matches). Samples are decoded straight into a ring supplied by the caller, which
+// may be drained from another thread. Replies to commands (command.h) found in the stream are
+// handed to a callback without losing sync.
+
+#define RX_CHUNK_SIZE 65536
+#define RX_FRAME_START 0xCC
+#define RX_FRAME_SIZE 3
+#define RX_SYNC_FRAMES 3 // Consecutive frames needed to accept a position after a resync
+#define RX_START_LINE "START\r\n" // First line of sendSerialHeader(), before every acquisition
+
+struct ReceiverStats
+{
+    uint64_t bytes;        // Bytes received
+    uint64_t frames;       // Valid 0xCC frames
+    uint64_t records;      // Valid compressed records
+    uint64_t samples;      // Samples written to the ring
+    uint64_t resyncs;      // Times the stream was lost and found again
+    uint64_t skippedBytes; // Bytes dropped while searching for the next frame
+    uint64_t lostRecords;  // Gaps in the sequence numbers of the records
+    uint64_t overruns;     // Samples dropped because the ring was full
+    uint64_t replies;      // Command replies skipped
+    uint64_t restarts;     // New acquisitions: START lines, or record sequences going back
+};
+
+// Receives every command reply found in the stream, with the host time of the read it came in
+typedef void (*ReplySink)(const uint8_t *frame, size_t length, uint64_t readTime, void *context);
+
+int openSerialPort(const char *path, unsigned baud);
+bool setSerialSpeed(int fd, unsigned baud);
+uint64_t hostMicros();
+
+class SerialReceiver
+{
+private:
+    int16_t *ring;
+    size_t capacity;
+    std::atomic<size_t> head; // Next sample written, only moved by the receiver
+    std::atomic<size_t> tail; // Next sample read, only moved by the consumer
+    size_t writing;           // Local copy of head while a chunk is processed
+    size_t room;              // Free samples in the ring while a chunk is processed
+
+    int fd;
+    uint8_t buffer[RX_CHUNK_SIZE + BLOCK_MAX_SIZE];
+    size_t pending; // Bytes of an incomplete frame or record kept at the start of buffer
+    bool synchronized;
+    bool sequenced; // Whether a record was seen, so nextSequence is meaningful
+    uint32_t nextSequence;
+    ReceiverStats stats;
+    ReplySink replySink;
+    void *replyContext;
+    uint64_t readTime; // hostMicros() after the last read, 0 for data given to feed()
+
+    size_t process(const uint8_t *data, size_t length);
+    int frameAt(const uint8_t *data, size_t length, size_t *size);
+    size_t findCandidate(const uint8_t *data, size_t length);
+    void push(int16_t sample);
+    void pushRecord(const uint8_t *record);
+    void restart();
+
+public:
+    SerialReceiver(int16_t *ring, size_t capacity);
+    ~SerialReceiver();
+
+    bool openDevice(const char *path, unsigned baud);
+    void attach(int fd);
+    void setReplySink(ReplySink sink, void *context);
+    int getDescriptor() const;
+    long poll(int timeout);
+    size_t feed(const uint8_t *data, size_t length);
+
+    size_t available() const;
+    size_t peek(const int16_t **first, size_t *firstLength, const int16_t **second, size_t *secondLength) const;
+    void consume(size_t count);
+    const ReceiverStats &getStats() const;
+};
+#endif // SERIALRX_H
@@ -0,0 +1,476 @@
+// serialsim: pretends to be the logger in serial mode, on a pseudo-terminal, to test receivers.
+//
+//   serialsim [-r rate] [-n samples] [-z] [-d ppm] [-c ppm] [-k ppm] [-m marks] [-w] [-f file]
+//       -r  samples per second, 0 for as fast as possible (default 860)
+//       -n  stops after that many samples (default: never)
+//       -z  sends compressed records, as with serialCompression, instead of 0xCC frames
+//       -d  drops that many bytes per million
+//       -c  corrupts that many bytes per million
+//       -k  makes the simulated device clock run that many parts per million fast
+//       -m  writes the true host time of the time-stamped samples as CSV: sample,host_time
+//       -w  waits for a START command before sending samples
+//       -f  writes to a file instead of a pseudo-terminal
+//   The name of the pseudo-terminal is printed on standard output. Sample i is
+//   simulatedSample(i), so a receiver can check what it got. PING, GET_STATUS, START, STOP,
+//   GET_COUNTERS, TIME_SYNC, SET_BAUD and BENCHMARK commands (command.h) are answered and a
+//   time mark is sent once per second, like the logger does. With -n, the simulator waits for
+//   a receiver to open the pseudo-terminal before sending, and exits once it has read
+//   everything, so that the totals can be compared.
+
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../../include/blocks.h"
+#include "../../include/command.h"
+#include "serialrx.h"
+
+static std::vector<uint8_t> pending;
+
+static void writeRecord(const uint8_t *record, size_t length, const BlockSummary *)
+{
+    pending.insert(pending.end(), record, record + length);
+}
+
+static int16_t simulatedSample(uint32_t i)
+{
+    return (int16_t)(8000 * sin(i * 0.01) + (int)(i * 2654435761U >> 28) - 8);
+}
+
+static uint32_t randomState = 12345;
+
+static uint32_t nextRandom()
+{
+    randomState = randomState * 1664525 + 1013904223;
+    return randomState >> 8;
+}
+
+/**
+ * @brief Writes the pending bytes, dropping or corrupting some of them.
+ */
+static bool sendPending(int fd, uint32_t dropRate, uint32_t corruptRate, uint64_t *dropped, uint64_t *corrupted)
+{
+    std::vector<uint8_t> out;
+    out.reserve(pending.size());
+    for (uint8_t byte : pending)
+    {
+        uint32_t draw = nextRandom() % 1000000;
+        if (draw < dropRate)
+        {
+            (*dropped)++;
+            continue;
+        }
+        if (draw < dropRate + corruptRate)
+        {
+            byte ^= 1 << (nextRandom() % 8);
+            (*corrupted)++;
+        }
+        out.push_back(byte);
+    }
+    pending.clear();
+
+    for (size_t sent = 0; sent < out.size();)
+    {
+        ssize_t length = write(fd, out.data() + sent, out.size() - sent);
+        if (length <= 0)
+            return false;
+        sent += length;
+    }
+    return true;
+}
+
+static CommandParser commands(COMMAND_REQUEST);
+static bool streaming = true;
+static uint64_t sentSamples = 0;
+static uint32_t answered = 0, rejected = 0;
+static uint64_t bootTime;    // Host time the simulated device booted
+static double clockRate = 1; // Device microseconds per host microsecond
+
+static uint32_t milliseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+/**
+ * @brief Returns the simulated device time (deviceMicros() in the firmware) at a host time.
+ */
+static uint64_t deviceTime(uint64_t host)
+{
+    return (uint64_t)((host - bootTime) * clockRate);
+}
+
+static uint8_t *put32(uint8_t *out, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        *out++ = (uint8_t)(value >> (8 * i));
+    return out;
+}
+
+static uint8_t *put64(uint8_t *out, uint64_t value)
+{
+    out = put32(out, (uint32_t)value);
+    return put32(out, (uint32_t)(value >> 32));
+}
+
+static void queueReply(uint8_t command, const uint8_t *reply, uint8_t length)
+{
+    uint8_t frame[COMMAND_MAX_FRAME];
+    size_t size = encodeCommand(COMMAND_REPLY, command | COMMAND_REPLY_FLAG, reply, length, frame);
+    pending.insert(pending.end(), frame, frame + size);
+}
+
+/**
+ * @brief Answers the commands received so far, like executeCommand() in the firmware.
+ */
+static void answerCommands(int fd, unsigned rate)
+{
+    struct pollfd descriptor = {fd, POLLIN, 0};
+    while (poll(&descriptor, 1, 0) > 0 && (descriptor.revents & POLLIN))
+    {
+        uint8_t byte;
+        if (read(fd, &byte, 1) != 1)
+            return;
+
+        uint64_t received = deviceTime(hostMicros());
+        COMMAND_PARSE result = commands.feed(byte, milliseconds());
+        if (result == COMMAND_REJECTED)
+            rejected++;
+        if (result != COMMAND_READY)
+            continue;
+
+        answered++;
+        uint8_t reply[COMMAND_MAX_PAYLOAD] = {COMMAND_OK};
+        uint8_t *end = reply + 1;
+        switch (commands.getCommand())
+        {
+        case COMMAND_PING:
+            *end++ = COMMAND_VERSION;
+            break;
+        case COMMAND_GET_STATUS:
+            *end++ = 1; // SERIAL_ONLY
+            *end++ = 0; // VOLTAGE
+            *end++ = (uint8_t)rate;
+            *end++ = (uint8_t)(rate >> 8);
+            *end++ = COMMAND_GAIN_DEFAULT;
+            *end++ = streaming;
+            *end++ = 0;
+            *end++ = 0;
+            end = put32(end, (uint32_t)sentSamples);
+            end = put32(end, milliseconds());
+            break;
+        case COMMAND_START:
+            streaming = true;
+            break;
+        case COMMAND_STOP:
+            streaming = false;
+            end = put32(end, (uint32_t)sentSamples);
+            break;
+        case COMMAND_GET_COUNTERS:
+            end = put32(end, (uint32_t)sentSamples);
+            end = put32(end, 0);
+            end = put32(end, answered);
+            end = put32(end, rejected);
+            end = put32(end, 0);
+            end = put32(end, 0);
+            break;
+        case COMMAND_SET_BAUD:
+            break; // A pseudo-terminal has no line speed
+        case COMMAND_BENCHMARK:
+            if (commands.getLength() != 4)
+            {
+                reply[0] = COMMAND_INVALID;
+                break;
+            }
+            else
+            {
+                const uint8_t *request = commands.getPayload();
+                uint32_t bytes = request[0] | request[1] << 8 | request[2] << 16 | (uint32_t)request[3] << 24;
+                std::vector<uint8_t> pattern(bytes);
+                for (uint32_t i = 0; i < bytes; i++)
+                    pattern[i] = '0' + (i % 64);
+
+                uint64_t start = hostMicros();
+                for (size_t sent = 0; sent < pattern.size();)
+                {
+                    ssize_t length = write(fd, pattern.data() + sent, pattern.size() - sent);
+                    if (length <= 0)
+                        break;
+                    sent += length;
+                }
+                end = put32(end, bytes);
+                end = put32(end, (uint32_t)(hostMicros() - start));
+            }
+            break;
+        case COMMAND_TIME_SYNC:
+            if (commands.getLength() != 8)
+            {
+                reply[0] = COMMAND_INVALID;
+                break;
+            }
+            memcpy(end, commands.getPayload(), 8);
+            end = put64(end + 8, received);
+            end = put64(end, deviceTime(hostMicros()));
+            break;
+        default:
+            reply[0] = COMMAND_UNKNOWN;
+            break;
+        }
+        queueReply(commands.getCommand(), reply, end - reply);
+    }
+}
+
+static uint64_t uncounted = 0;
+
+/**
+ * @brief Answers commands as soon as they arrive until the deadline, like the polling loop of the firmware.
+ *
+ * Replies go out untouched, since the drops and corruption only simulate the sample link.
+ *
+ * @return false if the pseudo-terminal was closed.
+ */
+static bool waitCommands(int fd, unsigned rate, const struct timespec *deadline)
+{
+    for (;;)
+    {
+        struct timespec now, timeout;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t remaining = (deadline->tv_sec - now.tv_sec) * 1000000000LL + deadline->tv_nsec - now.tv_nsec;
+        if (remaining <= 0)
+            return true;
+        timeout.tv_sec = remaining / 1000000000LL;
+        timeout.tv_nsec = remaining % 1000000000LL;
+
+        struct pollfd descriptor = {fd, POLLIN, 0};
+        if (ppoll(&descriptor, 1, &timeout, NULL) > 0)
+        {
+            answerCommands(fd, rate);
+            if (!pending.empty() && !sendPending(fd, 0, 0, &uncounted, &uncounted))
+                return false;
+        }
+    }
+}
+
+#define DRAIN_TIMEOUT 2000 // ms without the receiver reading before giving up
+
+/**
+ * @brief Waits until a receiver has opened the pseudo-terminal and set it up.
+ *
+ * Receivers flush the input of the port once it is in raw mode (openSerialPort()), which
+ * would discard the first samples. The master sees the settings of the slave side, so the
+ * simulator waits for canonical mode to be turned off, then for the flush to be done.
+ */
+static void waitReceiver(int fd)
+{
+    struct termios settings;
+    while (tcgetattr(fd, &settings) == 0 && (settings.c_lflag & ICANON))
+        usleep(1000);
+    usleep(50000);
+}
+
+/**
+ * @brief Waits until the receiver has read everything written to the pseudo-terminal.
+ *
+ * Closing the master discards what is still queued on the slave side, so the receiver would
+ * miss the end of the stream without noticing it. The queue is read through a second,
+ * non-blocking descriptor of the slave, which takes nothing from it.
+ */
+static void waitDrained(int fd)
+{
+    tcdrain(fd);
+    int slave = open(ptsname(fd), O_RDONLY | O_NOCTTY | O_NONBLOCK);
+    if (slave < 0)
+    {
+        sleep(1);
+        return;
+    }
+
+    int queued, last = -1;
+    uint32_t progress = milliseconds();
+    while (ioctl(slave, FIONREAD, &queued) == 0 && queued > 0)
+    {
+        if (queued != last)
+        {
+            last = queued;
+            progress = milliseconds();
+        }
+        else if (milliseconds() - progress >= DRAIN_TIMEOUT)
+        {
+            fprintf(stderr, "%d bytes not read by the receiver\n", queued);
+            break;
+        }
+        usleep(1000);
+    }
+    close(slave);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned rate = 860;
+    uint64_t total = UINT64_MAX;
+    bool compressed = false;
+    uint32_t dropRate = 0, corruptRate = 0;
+    const char *file = NULL, *marks = NULL;
+    double drift = 0;
+
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+            rate = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-n") == 0 && arg + 1 < argc)
+            total = strtoull(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-z") == 0)
+            compressed = true;
+        else if (strcmp(argv[arg], "-d") == 0 && arg + 1 < argc)
+            dropRate = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-c") == 0 && arg + 1 < argc)
+            corruptRate = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-k") == 0 && arg + 1 < argc)
+            drift = strtod(argv[++arg], NULL);
+        else if (strcmp(argv[arg], "-m") == 0 && arg + 1 < argc)
+            marks = argv[++arg];
+        else if (strcmp(argv[arg], "-w") == 0)
+            streaming = false;
+        else if (strcmp(argv[arg], "-f") == 0 && arg + 1 < argc)
+            file = argv[++arg];
+        else
+        {
+            fprintf(stderr, "usage: %s [-r rate] [-n samples] [-z] [-d ppm] [-c ppm] [-k ppm] [-m marks] [-w] [-f file]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    clockRate = 1 + drift * 1e-6;
+    bootTime = hostMicros() - 5000000; // As if the logger had been on for 5 s
+    FILE *truth = marks ? fopen(marks, "w") : NULL;
+    if (marks && !truth)
+    {
+        perror(marks);
+        return 1;
+    }
+    if (truth)
+        fputs("sample,host_time\n", truth);
+
+    int fd;
+    if (file)
+    {
+        fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    else
+    {
+        fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (fd >= 0 && (grantpt(fd) != 0 || unlockpt(fd) != 0))
+            fd = -1;
+        if (fd >= 0)
+        {
+            printf("%s\n", ptsname(fd));
+            fflush(stdout);
+        }
+    }
+    if (fd < 0)
+    {
+        perror(file ? file : "posix_openpt");
+        return 1;
+    }
+
+    if (!file && streaming && total != UINT64_MAX)
+        waitReceiver(fd);
+
+    // What the logger prints before the samples, which the receiver has to skip
+    const char *preamble = "START\nCurrent measure: Voltage\nGain: 0.000125000\nOffset: 0.00\n"
+                           "Array length (Sample rate): 860\nFactor: 4.33\n";
+    pending.assign(preamble, preamble + strlen(preamble));
+
+    BlockWriter writer(writeRecord);
+    writer.reset(0, 0);
+    unsigned window = rate ? rate : 860;
+    unsigned batch = rate >= 100 ? rate / 100 : 1; // Samples sent every 10 ms
+    uint64_t dropped = 0, corrupted = 0;
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    uint64_t i = 0;
+    for (; i < total; i++)
+    {
+        while (!streaming && !file)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &next);
+            next.tv_nsec += 10000000;
+            if (next.tv_nsec >= 1000000000L)
+            {
+                next.tv_nsec -= 1000000000L;
+                next.tv_sec++;
+            }
+            if (!waitCommands(fd, rate, &next))
+                break;
+        }
+
+        uint64_t sampleTime = hostMicros();
+        int16_t value = simulatedSample((uint32_t)i);
+        if (compressed)
+        {
+            writer.insert(value, (uint32_t)(i * 1000 / window));
+            if (i % window == window - 1 || i + 1 == total)
+                writer.flush();
+        }
+        else
+        {
+            pending.push_back(0xCC);
+            pending.push_back((value >> 8) & 0xFF);
+            pending.push_back(value & 0xFF);
+        }
+
+        if (i % window == window - 1)
+        {
+            // Time mark of the last sample of the window, like sendTimeMark()
+            uint8_t mark[13] = {COMMAND_OK};
+            put64(put32(mark + 1, (uint32_t)i), deviceTime(sampleTime));
+            queueReply(COMMAND_TIME_MARK, mark, sizeof(mark));
+            if (truth)
+                fprintf(truth, "%llu,%.6f\n", (unsigned long long)i, sampleTime / 1e6);
+        }
+        sentSamples = i + 1;
+        if (i % batch == batch - 1 || i + 1 == total)
+        {
+            if (!sendPending(fd, dropRate, corruptRate, &dropped, &corrupted))
+                break;
+            if (rate)
+            {
+                next.tv_nsec += 1000000000LL * batch / rate;
+                while (next.tv_nsec >= 1000000000L)
+                {
+                    next.tv_nsec -= 1000000000L;
+                    next.tv_sec++;
+                }
+                if (file)
+                    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+                else if (!waitCommands(fd, rate, &next))
+                    break;
+            }
+            else if (!file)
+            {
+                answerCommands(fd, rate);
+                if (!sendPending(fd, 0, 0, &uncounted, &uncounted))
+                    break;
+            }
+        }
+    }
+
+    if (!file)
+        waitDrained(fd);
+    close(fd);
+    if (truth)
+        fclose(truth);
+    fprintf(stderr, "%llu samples sent, %llu bytes dropped, %llu bytes corrupted\n", (unsigned long long)i,
+            (unsigned long long)dropped, (unsigned long long)corrupted);
+    return 0;
+}
@@ -0,0 +1,131 @@
+// spectrumbench: times the transform of the spectrum mode (spectrum.h) on the host, and checks
+// it against a direct DFT.
+//
+//   spectrumbench [runs]
+//   For every block size and window, transforms a block of two sines and noise `runs` times
+//   (1000 by default) from a ring like the logger's, and prints the time per transform, the
+//   processor cycles on x86 (time-stamp counter), the largest difference of the amplitudes
+//   from a direct DFT in double precision, and the two largest peaks. Exits with 1 if a
+//   difference is above BENCH_TOLERANCE. The cycles taken on the logger are in every record of
+//   the spectrum mode (ds32ctl spectrum) and in the metric ds32_spectrum_fft_cycles.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES 1
+#endif
+
+#include "../../include/spectrum.h"
+
+#define BENCH_RATE 860
+#define BENCH_TOLERANCE 0.01 // Counts of amplitude; the float transform is within about 1e-3
+
+static const char *windowNames[SPECTRUM_WINDOWS] = {"hann", "blackman-harris"};
+
+static SpectrumAnalyzer analyzer;
+static SampleHistory history;
+
+static uint64_t nanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/**
+ * @brief Returns the largest difference between the amplitudes of the analyzer and those of a
+ * direct DFT of the same block, weighted by the same window.
+ */
+static double directError(uint32_t first, uint16_t size, uint8_t window)
+{
+    double mean = 0, windowSum = 0;
+    static double weights[SPECTRUM_MAX_SIZE];
+    for (uint16_t n = 0; n < size; n++)
+    {
+        double phase = 2 * M_PI * n / size;
+        weights[n] = window == SPECTRUM_HANN
+                         ? 0.5 - 0.5 * cos(phase)
+                         : 0.35875 - 0.48829 * cos(phase) + 0.14128 * cos(2 * phase) - 0.01168 * cos(3 * phase);
+        windowSum += weights[n];
+        mean += history.at(first + n) * weights[n];
+    }
+    mean /= windowSum;
+
+    double error = 0;
+    for (uint16_t k = 1; k <= size / 2; k++)
+    {
+        double re = 0, im = 0;
+        for (uint16_t n = 0; n < size; n++)
+        {
+            double value = (history.at(first + n) - mean) * weights[n];
+            double phase = 2 * M_PI * ((uint32_t)k * n % size) / size;
+            re += value * cos(phase);
+            im -= value * sin(phase);
+        }
+        double amplitude = sqrt(re * re + im * im) / windowSum * (k == size / 2 ? 1 : 2);
+        double difference = fabs(amplitude - analyzer.getAmplitudes()[k]);
+        if (difference > error)
+            error = difference;
+    }
+    return error;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned runs = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000;
+    if (argc > 2 || runs == 0)
+    {
+        fprintf(stderr, "usage: %s [runs]\n", argv[0]);
+        return 2;
+    }
+
+    // A mains tone at 50 Hz and a weaker one at 123.4 Hz, between two bins, sampled at 860 SPS
+    srand(1);
+    for (uint32_t n = 0; n < HISTORY_SAMPLES; n++)
+    {
+        double t = (double)n / BENCH_RATE;
+        history.insert((int16_t)lrint(1000 + 8000 * sin(2 * M_PI * 50 * t) + 800 * sin(2 * M_PI * 123.4 * t + 0.3) +
+                                      rand() % 9 - 4));
+    }
+
+    int failures = 0;
+    printf("%5s %-16s %10s %12s %10s %20s %20s\n", "size", "window", "us", "cycles", "error", "peak", "second");
+    for (uint16_t size = SPECTRUM_MIN_SIZE; size <= SPECTRUM_MAX_SIZE; size *= 2)
+    {
+        for (uint8_t window = 0; window < SPECTRUM_WINDOWS; window++)
+        {
+            analyzer.begin(size, window);
+            uint32_t first = 0;
+            uint64_t cycles = 0;
+            uint64_t start = nanoseconds();
+            for (unsigned run = 0; run < runs; run++)
+            {
+                // Half a block on, as the logger does
+                first = (first + size / 2) % (HISTORY_SAMPLES - size);
+#ifdef HAVE_CYCLES
+                uint64_t begin = __rdtsc();
+                analyzer.transform(history, first, BENCH_RATE);
+                cycles += __rdtsc() - begin;
+#else
+                analyzer.transform(history, first, BENCH_RATE);
+#endif
+            }
+            double micros = (nanoseconds() - start) / 1000.0 / runs;
+
+            char peak[32], second[32];
+            const SpectrumPeak *peaks = analyzer.getPeaks();
+            snprintf(peak, sizeof(peak), "%.2f Hz %.0f", peaks[0].frequency, peaks[0].amplitude);
+            snprintf(second, sizeof(second), "%.2f Hz %.0f", peaks[1].frequency, peaks[1].amplitude);
+            double error = directError(first, size, window);
+            printf("%5u %-16s %10.2f %12.0f %10.4f %20s %20s\n", size, windowNames[window], micros,
+                   cycles ? (double)cycles / runs : NAN, error, peak, second);
+            if (!(error <= BENCH_TOLERANCE) && failures++ < 20)
+                printf("FAIL: %u %s: amplitudes %g counts from the direct DFT, above %g\n", size,
+                       windowNames[window], error, BENCH_TOLERANCE);
+        }
+    }
+    return failures ? 1 : 0;
+}
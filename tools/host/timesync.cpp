@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <math.h>
+
+#include "timesync.h"
+
+/**
+ * @brief Creates an estimator using the given number of most recent exchanges.
+ */
+ClockSync::ClockSync(size_t window)
+{
+    this->window = window < 4 ? 4 : window;
+    reset();
+}
+
+/**
+ * @brief Forgets every exchange, e.g. after the logger restarted.
+ */
+void ClockSync::reset()
+{
+    exchanges.clear();
+    fitted = false;
+    hostBase = deviceBase = 0;
+    intercept = 0;
+    slope = 1;
+    delay = residual = 0;
+}
+
+/**
+ * @brief Adds an exchange and updates the estimate.
+ *
+ * Exchanges whose times are not in order (a lost or mismatched reply) are ignored.
+ */
+void ClockSync::addExchange(const SyncExchange &exchange)
+{
+    if (exchange.hostReceived < exchange.hostSent || exchange.deviceSent < exchange.deviceReceived)
+        return;
+    if (!exchanges.empty() && exchange.deviceReceived < exchanges.back().deviceSent)
+        reset(); // The device time went back: the logger restarted
+
+    exchanges.push_back(exchange);
+    if (exchanges.size() > window)
+        exchanges.erase(exchanges.begin());
+    fit();
+}
+
+/**
+ * @brief Fits the device time against the host time through the exchanges with the shortest round trips.
+ */
+void ClockSync::fit()
+{
+    std::vector<double> delays;
+    for (const SyncExchange &exchange : exchanges)
+        delays.push_back((double)(exchange.hostReceived - exchange.hostSent) -
+                         (double)(exchange.deviceSent - exchange.deviceReceived));
+    std::vector<double> sorted = delays;
+    std::sort(sorted.begin(), sorted.end());
+    delay = sorted[0];
+    double threshold = sorted[sorted.size() / 4];
+
+    // Least squares in coordinates relative to the first exchange kept, to keep the precision of doubles
+    std::vector<double> hosts, devices;
+    for (size_t i = 0; i < exchanges.size(); i++)
+    {
+        if (delays[i] > threshold)
+            continue;
+        const SyncExchange &exchange = exchanges[i];
+        if (hosts.empty())
+        {
+            hostBase = exchange.hostSent;
+            deviceBase = exchange.deviceReceived;
+        }
+        hosts.push_back((double)(exchange.hostSent - hostBase) + (exchange.hostReceived - exchange.hostSent) / 2.0);
+        devices.push_back((double)(exchange.deviceReceived - deviceBase) +
+                          (exchange.deviceSent - exchange.deviceReceived) / 2.0);
+    }
+
+    size_t count = hosts.size();
+    double meanHost = 0, meanDevice = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        meanHost += hosts[i];
+        meanDevice += devices[i];
+    }
+    meanHost /= count;
+    meanDevice /= count;
+
+    double covariance = 0, variance = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        covariance += (hosts[i] - meanHost) * (devices[i] - meanDevice);
+        variance += (hosts[i] - meanHost) * (hosts[i] - meanHost);
+    }
+    // Under a second of history the drift cannot be told from the jitter
+    slope = hosts[count - 1] - hosts[0] >= 1e6 && variance > 0 ? covariance / variance : 1.0;
+    intercept = meanDevice - slope * meanHost;
+
+    double squares = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        double distance = devices[i] - (intercept + slope * hosts[i]);
+        squares += distance * distance;
+    }
+    residual = sqrt(squares / count);
+    fitted = true;
+}
+
+/**
+ * @brief Tells whether at least one exchange has been made.
+ */
+bool ClockSync::isReady() const
+{
+    return fitted;
+}
+
+/**
+ * @brief Converts a device time to host microseconds.
+ */
+double ClockSync::toHost(uint64_t device) const
+{
+    double relative = (double)(int64_t)(device - deviceBase);
+    return (double)hostBase + (relative - intercept) / slope;
+}
+
+/**
+ * @brief Converts a host time to device microseconds.
+ */
+double ClockSync::toDevice(uint64_t host) const
+{
+    double relative = (double)(int64_t)(host - hostBase);
+    return (double)deviceBase + intercept + slope * relative;
+}
+
+/**
+ * @brief Returns the device time minus the host time at the given host time, in microseconds.
+ */
+double ClockSync::getOffset(uint64_t host) const
+{
+    return toDevice(host) - (double)host;
+}
+
+/**
+ * @brief Returns how much faster the device clock runs than the host clock, in parts per million.
+ */
+double ClockSync::getDrift() const
+{
+    return (slope - 1) * 1e6;
+}
+
+/**
+ * @brief Returns the shortest round trip seen, in microseconds.
+ */
+double ClockSync::getDelay() const
+{
+    return delay;
+}
+
+/**
+ * @brief Returns a bound of the error of converted times, in microseconds.
+ *
+ * Half the shortest round trip bounds an asymmetry of the link; the residual adds the jitter.
+ */
+double ClockSync::getError() const
+{
+    return delay / 2 + residual;
+}
+
+size_t ClockSync::getExchangeCount() const
+{
+    return exchanges.size();
+}
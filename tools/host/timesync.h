@@ -0,0 +1,56 @@
+// timesync.h
+#ifndef TIMESYNC_H
+#define TIMESYNC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Estimate of the logger clock against the host clock, from COMMAND_TIME_SYNC exchanges
+// (command.h), in the manner of NTP.
+//
+// Each exchange gives the host time the request was sent (t1), the device times it was
+// received and answered (t2, t3) and the host time the reply arrived (t4). Its round trip
+// is (t4 - t1) - (t3 - t2), and the device time at the host midpoint (t1 + t4) / 2 is
+// (t2 + t3) / 2, give or take half the round trip. USB buffering only ever adds delay, so
+// only the quarter of the recent exchanges with the shortest round trips are kept, and a
+// line is fitted through them: its slope is the drift, its value the offset.
+
+struct SyncExchange
+{
+    uint64_t hostSent;       // t1, host microseconds
+    uint64_t deviceReceived; // t2, device microseconds
+    uint64_t deviceSent;     // t3
+    uint64_t hostReceived;   // t4
+};
+
+class ClockSync
+{
+private:
+    std::vector<SyncExchange> exchanges; // The most recent ones, oldest first
+    size_t window;
+    bool fitted;
+    uint64_t hostBase;   // Host time of the first exchange used by the fit
+    uint64_t deviceBase; // Device time of the first exchange used by the fit
+    double intercept;    // Device - deviceBase at hostBase, microseconds
+    double slope;        // Device microseconds per host microsecond
+    double delay;        // Shortest round trip, microseconds
+    double residual;     // RMS distance of the exchanges used to the line, microseconds
+
+    void fit();
+
+public:
+    ClockSync(size_t window = 256);
+    void addExchange(const SyncExchange &exchange);
+    void reset();
+
+    bool isReady() const;
+    double toHost(uint64_t device) const;
+    double toDevice(uint64_t host) const;
+    double getOffset(uint64_t host) const;
+    double getDrift() const;
+    double getDelay() const;
+    double getError() const;
+    size_t getExchangeCount() const;
+};
+#endif // TIMESYNC_H
@@ -0,0 +1,468 @@
+// webhost: runs the web server of the logger on the host, with a simulated acquisition, so the
+// pages and the live view can be tried from a local browser without the device or a radio.
+//
+//   webhost [-p port] [-r rate] [-a] [-c]
+//       -p  TCP port (default 8080), then open http://localhost:8080/
+//       -r  samples per second (default 860)
+//       -a  starts acquiring at once instead of waiting for the "start" button
+//       -c  sends malformed requests and frames to the server instead, checks that each one
+//           is refused, checks the reductions of the chart (history.h) against reference
+//           implementations, and exits with 1 if a check fails
+//   The server, the live stream and the pages are the ones built into the firmware
+//   (src/webserver.cpp, src/live.cpp, src/history.cpp, src/metrics.cpp, src/web_assets.cpp).
+//   Sample i is 8000 sin(i / 100) ADC counts with noise, converted like the voltage channel;
+//   /metrics counts them and times the turns of the loop.
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../include/ads1115.h"
+#include "../../include/history.h"
+#include "../../include/live.h"
+#include "../../include/metrics.h"
+#include "../../include/web_assets.h"
+#include "../../include/webserver.h"
+
+#define SIMULATED_GAIN adcLsb(ADC_CHANNELS[0].gain) // Volts per count of the voltage channel
+#define SIMULATED_FACTOR ADC_CHANNELS[0].factor
+#define CHECK_TIMEOUT 500 // Milliseconds a check waits for the server to answer or close
+
+static HttpServer server;
+static LiveStream live(server);
+static bool acquiring = false;
+static bool startRequested = false;
+static bool stopRequested = false;
+
+static const uint32_t loopBounds[] = {500, 1000, 1100, 1250, 1500, 2000, 5000, 10000};
+static Counter samplesMetric("ds32_samples_acquired", "Samples read from the ADC.");
+static Histogram loopMetric("ds32_loop_seconds", "Time between two turns of the acquisition loop.", loopBounds, 8);
+
+static uint32_t hostMillis()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+static int16_t simulatedSample(uint32_t i)
+{
+    return (int16_t)(8000 * sin(i * 0.01) + (int)(i * 2654435761U >> 28) - 8);
+}
+
+static void serveAsset(HttpServer &server, int client, const HttpRequest &request)
+{
+    server.sendAsset(client, request, *findWebAsset(request.path));
+}
+
+static void serveChart(HttpServer &, int client, const HttpRequest &request)
+{
+    live.sendChart(client, request);
+}
+
+static uint32_t socketMessages = 0; // Received from the browsers, for the checks
+
+static void handleWebSocket(HttpServer &, int client, WS_EVENT event, const uint8_t *data, size_t length)
+{
+    if (event == WS_MESSAGE)
+        socketMessages++;
+    if (event == WS_OPEN)
+    {
+        live.greet(client);
+        fprintf(stderr, "browser %d connected\n", client);
+    }
+    else if (event == WS_CLOSE)
+        fprintf(stderr, "browser %d disconnected\n", client);
+    else if (length == 5 && memcmp(data, "start", 5) == 0)
+        startRequested = !acquiring;
+    else if (length == 4 && memcmp(data, "stop", 4) == 0)
+        stopRequested = acquiring;
+}
+
+/**
+ * @brief Sends bytes to the server on a connection and collects what it answers.
+ *
+ * @return true if the server closed the connection within CHECK_TIMEOUT ms.
+ */
+static bool exchange(int connection, const char *data, size_t length, char *reply, size_t size)
+{
+    size_t received = 0;
+    send(connection, data, length, MSG_NOSIGNAL);
+    for (uint32_t start = hostMillis(); hostMillis() - start < CHECK_TIMEOUT;)
+    {
+        server.handleClients(hostMillis());
+        ssize_t count = recv(connection, reply + received, size - 1 - received, MSG_DONTWAIT);
+        if (count == 0 || (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+        {
+            reply[received] = '\0';
+            return true;
+        }
+        if (count > 0)
+            received += count;
+        usleep(1000);
+    }
+    reply[received] = '\0';
+    return false;
+}
+
+static int connectServer(unsigned port)
+{
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int connection = socket(AF_INET, SOCK_STREAM, 0);
+    if (connection >= 0 && connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(connection);
+        connection = -1;
+    }
+    return connection;
+}
+
+struct RequestCheck
+{
+    const char *name;
+    const char *request;
+    const char *status; // Start of the answer
+};
+
+static const RequestCheck requestChecks[] = {
+    {"valid request", "GET /metrics HTTP/1.1\r\nConnection: close\r\n\r\n", "HTTP/1.1 200"},
+    {"no version", "GET /\r\n\r\n", "HTTP/1.1 400"},
+    {"no path", "GET\r\n\r\n", "HTTP/1.1 400"},
+    {"empty version", "GET / \r\n\r\n", "HTTP/1.1 400"},
+    {"space in a header", "GET /\r\nHost: a b\r\n\r\n", "HTTP/1.1 400"},
+    {"space after the headers", "GET /\r\n\r\nA B", "HTTP/1.1 400"},
+};
+
+struct FrameCheck
+{
+    const char *name;
+    size_t length;
+    uint8_t frame[24]; // Masked with a zero mask, so the payload reads as is
+};
+
+static const FrameCheck frameChecks[] = {
+    {"64-bit length", 19, {0x81, 0xFF, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 's', 't', 'a', 'r', 't'}},
+    {"unmasked frame", 7, {0x81, 0x05, 's', 't', 'a', 'r', 't'}},
+    {"fragment", 11, {0x01, 0x85, 0, 0, 0, 0, 's', 't', 'a', 'r', 't'}},
+};
+
+static const char upgradeRequest[] = "GET /ws HTTP/1.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                                     "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+
+/**
+ * @brief Sends malformed requests and WebSocket frames to the server, each on its own connection.
+ *
+ * @return The number of checks that failed.
+ */
+static int checkServer(unsigned port)
+{
+    static char reply[HTTP_QUEUE_SIZE + 1];
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(requestChecks) / sizeof(requestChecks[0]); i++)
+    {
+        const RequestCheck &check = requestChecks[i];
+        int connection = connectServer(port);
+        bool closed = connection >= 0 && exchange(connection, check.request, strlen(check.request), reply, sizeof(reply));
+        bool passed = closed && strncmp(reply, check.status, strlen(check.status)) == 0;
+        printf("%-28s %s\n", check.name, passed ? "ok" : "FAILED");
+        failures += !passed;
+        if (connection >= 0)
+            close(connection);
+    }
+
+    // Frames the server must close the connection on, without passing a message on
+    for (size_t i = 0; i < sizeof(frameChecks) / sizeof(frameChecks[0]); i++)
+    {
+        const FrameCheck &check = frameChecks[i];
+        int connection = connectServer(port);
+        bool upgraded = connection >= 0 &&
+                        !exchange(connection, upgradeRequest, sizeof(upgradeRequest) - 1, reply, sizeof(reply)) &&
+                        strncmp(reply, "HTTP/1.1 101", 12) == 0;
+        uint32_t messages = socketMessages;
+        bool closed = upgraded && exchange(connection, (const char *)check.frame, check.length, reply, sizeof(reply));
+        bool passed = closed && socketMessages == messages;
+        printf("%-28s %s\n", check.name, passed ? "ok" : "FAILED");
+        failures += !passed;
+        if (connection >= 0)
+            close(connection);
+    }
+    return failures;
+}
+
+/**
+ * @brief Twice the area of the triangle of LTTB, in double precision.
+ */
+static double triangleArea(double keptX, double keptY, double x, double y, double averageX, double averageY)
+{
+    return fabs((keptX - averageX) * (y - keptY) - (keptX - x) * (averageY - keptY));
+}
+
+/**
+ * @brief LTTB as written in Steinarsson's thesis, in double precision, with its bucket bounds
+ * floor(b * (count - 2) / (points - 2)) + 1 computed exactly.
+ */
+static void referenceLttb(const SampleHistory &history, uint32_t first, uint32_t count, uint16_t points,
+                          uint16_t *offsets)
+{
+    uint32_t inner = count - 2, buckets = points - 2, kept = 0;
+    offsets[0] = 0;
+    for (uint32_t bucket = 0; bucket < buckets; bucket++)
+    {
+        uint32_t start = bucket * inner / buckets + 1, end = (bucket + 1) * inner / buckets + 1;
+        uint32_t nextEnd = (bucket + 2) * inner / buckets + 1 < count ? (bucket + 2) * inner / buckets + 1 : count;
+        double averageX = 0, averageY = 0;
+        for (uint32_t i = end; i < nextEnd; i++)
+        {
+            averageX += i;
+            averageY += history.at(first + i);
+        }
+        averageX /= nextEnd - end;
+        averageY /= nextEnd - end;
+
+        double largest = -1;
+        for (uint32_t i = start; i < end; i++)
+        {
+            double area = triangleArea(kept, history.at(first + kept), i, history.at(first + i), averageX, averageY);
+            if (area > largest)
+            {
+                largest = area;
+                offsets[bucket + 1] = (uint16_t)i;
+            }
+        }
+        kept = offsets[bucket + 1];
+    }
+    offsets[points - 1] = (uint16_t)(count - 1);
+}
+
+/**
+ * @brief Checks one window of downsampleLttb() against the reference.
+ *
+ * Each point must be in its bucket and, given the point kept before it, form a triangle as
+ * large as the reference's largest to within float rounding; the points identical to those of
+ * the reference are counted.
+ *
+ * @return true if it passed.
+ */
+static bool checkLttb(const SampleHistory &history, uint32_t first, uint32_t count, uint16_t points,
+                      uint32_t *identical, uint32_t *compared)
+{
+    static uint16_t offsets[HISTORY_MAX_POINTS], expected[HISTORY_MAX_POINTS];
+    static int16_t values[HISTORY_MAX_POINTS];
+    uint16_t written = history.downsampleLttb(first, count, points, offsets, values);
+    if (written != (count <= points ? count : points))
+        return false;
+    for (uint16_t i = 0; i < written; i++)
+    {
+        if (values[i] != history.at(first + offsets[i]))
+            return false;
+    }
+    if (count <= points)
+    {
+        for (uint16_t i = 0; i < written; i++)
+        {
+            if (offsets[i] != i)
+                return false;
+        }
+        return true;
+    }
+
+    referenceLttb(history, first, count, points, expected);
+    uint32_t inner = count - 2, buckets = points - 2;
+    for (uint32_t bucket = 0; bucket < buckets; bucket++)
+    {
+        uint32_t start = bucket * inner / buckets + 1, end = (bucket + 1) * inner / buckets + 1;
+        uint32_t nextEnd = (bucket + 2) * inner / buckets + 1 < count ? (bucket + 2) * inner / buckets + 1 : count;
+        uint16_t chosen = offsets[bucket + 1], kept = offsets[bucket];
+        if (chosen < start || chosen >= end)
+            return false;
+
+        double averageX = 0, averageY = 0;
+        for (uint32_t i = end; i < nextEnd; i++)
+        {
+            averageX += i;
+            averageY += history.at(first + i);
+        }
+        averageX /= nextEnd - end;
+        averageY /= nextEnd - end;
+        double largest = 0;
+        for (uint32_t i = start; i < end; i++)
+            largest = fmax(largest, triangleArea(kept, values[bucket], i, history.at(first + i), averageX, averageY));
+        double area = triangleArea(kept, values[bucket], chosen, values[bucket + 1], averageX, averageY);
+        if (area < largest * (1 - 1e-5) - 1e-3)
+            return false;
+    }
+    for (uint16_t i = 0; i < points; i++)
+        *identical += offsets[i] == expected[i];
+    *compared += points;
+    return offsets[0] == 0 && offsets[points - 1] == count - 1;
+}
+
+/**
+ * @brief Checks one window of downsampleMinMax() against a plain minimum and maximum of each bucket.
+ */
+static bool checkMinMax(const SampleHistory &history, uint32_t first, uint32_t count, uint16_t buckets)
+{
+    static int16_t minima[HISTORY_MAX_POINTS], maxima[HISTORY_MAX_POINTS];
+    uint16_t written = history.downsampleMinMax(first, count, buckets, minima, maxima);
+    uint16_t expected = count < buckets ? count : buckets;
+    if (written != expected)
+        return false;
+    for (uint32_t bucket = 0; bucket < expected; bucket++)
+    {
+        int16_t minimum = INT16_MAX, maximum = INT16_MIN;
+        for (uint32_t i = count * bucket / expected; i < count * (bucket + 1) / expected; i++)
+        {
+            minimum = history.at(first + i) < minimum ? history.at(first + i) : minimum;
+            maximum = history.at(first + i) > maximum ? history.at(first + i) : maximum;
+        }
+        if (minima[bucket] != minimum || maxima[bucket] != maximum)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reduces windows of a ring that has wrapped, of a sine with noise, spikes and flat
+ * stretches, with both methods.
+ *
+ * @return The number of checks that failed.
+ */
+static int checkDownsampling()
+{
+    static SampleHistory history;
+    for (uint32_t i = 0; i < HISTORY_SAMPLES + 5000; i++)
+    {
+        int16_t sample = simulatedSample(i);
+        if (i % 997 == 0)
+            sample = i % 2 ? INT16_MAX : INT16_MIN;
+        else if (i / 2000 % 3 == 1)
+            sample = 1234;
+        history.insert(sample);
+    }
+
+    static const uint32_t counts[] = {1, 2, 3, 4, 10, 15, 1000, 1025, 5000, 12345, HISTORY_SAMPLES};
+    static const uint16_t points[] = {3, 4, 7, 13, 100, 1000, HISTORY_MAX_POINTS};
+    int failures = 0;
+    uint32_t windows = 0, identical = 0, compared = 0;
+    for (uint32_t count : counts)
+    {
+        for (uint16_t point : points)
+        {
+            // The newest window, and one ending where the ring wraps
+            uint32_t firsts[] = {history.getNext() - count, history.getNext() - HISTORY_SAMPLES};
+            for (uint32_t first : firsts)
+            {
+                bool lttb = checkLttb(history, first, count, point, &identical, &compared);
+                bool minMax = checkMinMax(history, first, count, point);
+                if ((!lttb || !minMax) && failures++ < 20)
+                    printf("FAIL: %s of %u samples to %u points\n", lttb ? "min/max" : "LTTB", count, point);
+                windows++;
+            }
+        }
+    }
+    printf("%-28s %s (%u windows, %u of %u LTTB points as the reference)\n", "downsampling",
+           failures ? "FAILED" : "ok", windows, identical, compared);
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned port = 8080, rate = 860;
+    bool checking = false;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        if (strcmp(argv[arg], "-p") == 0 && arg + 1 < argc)
+            port = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+            rate = strtoul(argv[++arg], NULL, 10);
+        else if (strcmp(argv[arg], "-a") == 0)
+            startRequested = true;
+        else if (strcmp(argv[arg], "-c") == 0)
+            checking = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [-p port] [-r rate] [-a] [-c]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (rate == 0)
+        rate = 860;
+
+    server.on("/", serveAsset);
+    for (size_t i = 0; i < webAssetCount; i++)
+        server.on(webAssets[i].path, serveAsset);
+    server.on("/chart", serveChart);
+    server.on("/metrics", serveMetrics);
+    server.onWebSocket("/ws", handleWebSocket);
+    if (!server.begin(port))
+    {
+        perror("listen");
+        return 1;
+    }
+    if (checking)
+        return checkServer(port) + checkDownsampling() ? 1 : 0;
+    fprintf(stderr, "serving on http://localhost:%u/\n", port);
+
+    uint32_t start = 0, sample = 0, lastTurn = 0;
+    double sum = 0;
+    for (;;)
+    {
+        uint32_t now = hostMillis();
+        server.handleClients(now);
+        if (acquiring)
+        {
+            struct timespec turn;
+            clock_gettime(CLOCK_MONOTONIC, &turn);
+            uint32_t micros = (uint32_t)(turn.tv_sec * 1000000 + turn.tv_nsec / 1000);
+            if (lastTurn != 0)
+                loopMetric.observe(micros - lastTurn);
+            lastTurn = micros;
+        }
+
+        if (startRequested)
+        {
+            startRequested = false;
+            acquiring = true;
+            start = now;
+            sample = 0;
+            sum = 0;
+            live.begin(0, rate, SIMULATED_GAIN, 0, SIMULATED_FACTOR);
+            fprintf(stderr, "acquisition started\n");
+        }
+        if (stopRequested)
+        {
+            stopRequested = false;
+            acquiring = false;
+            live.end();
+            fprintf(stderr, "acquisition stopped after %u samples, %u messages dropped\n", sample,
+                    server.getDroppedMessages());
+        }
+
+        // Samples are produced in real time, and the window ends every `rate` samples like in the logger
+        while (acquiring && (uint64_t)sample * 1000 < (uint64_t)(now - start) * rate)
+        {
+            int16_t value = simulatedSample(sample++);
+            samplesMetric.add();
+            live.insert(value);
+            sum += value;
+            if (sample % rate == 0)
+            {
+                live.endWindow((float)(sum / rate * SIMULATED_GAIN * SIMULATED_FACTOR));
+                sum = 0;
+            }
+        }
+        usleep(1000);
+    }
+}
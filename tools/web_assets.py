@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Embeds the web pages in include/website/ into the firmware as minified,
+gzip-compressed constant byte arrays (see include/web_assets.h), served by the
+HTTP server straight from flash with Content-Encoding: gzip.
+
+Every asset gets a strong ETag from the hash of its content. The style sheet
+and the script are served at a path that contains that hash (style.1a2b3c4d.css)
+and the pages link them there, so a browser may cache them forever; the pages
+themselves are revalidated with If-None-Match and cost one small round trip
+when nothing changed. Every asset is decompressed again before it is written
+and the script fails if the result differs from the minified source.
+
+Usage:
+    python3 tools/web_assets.py            # regenerate src/web_assets.cpp
+    python3 tools/web_assets.py --check    # only verify that it is up to date
+
+PlatformIO also runs it before every build (extra_scripts in platformio.ini),
+so the firmware always carries the current pages. Only the Python standard
+library is needed.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+if '__file__' in globals():
+    ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), '..'))
+else:
+    ROOT = os.getcwd()  # Run by PlatformIO from the project directory
+WEB_DIR = os.path.join(ROOT, 'include', 'website')
+OUTPUT = os.path.join(ROOT, 'src', 'web_assets.cpp')
+
+# File in include/website, whether it is served at a hashed path and cached forever
+ASSETS = [
+    ('style.css', True),
+    ('script.js', True),
+    ('index.html', False),
+    ('embed.html', False),
+]
+
+TYPES = {
+    '.html': 'text/html; charset=utf-8',
+    '.css': 'text/css; charset=utf-8',
+    '.js': 'application/javascript; charset=utf-8',
+}
+
+
+def minify_css(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'\s+', ' ', text)
+    text = re.sub(r'\s*([{}:;,>])\s*', r'\1', text)
+    return text.replace(';}', '}').strip()
+
+
+def minify_js(text):
+    """Drops comments, indentation and blank lines; leaves the code itself alone."""
+    lines = []
+    for line in text.split('\n'):
+        line = line.strip()
+        if line.startswith('//'):
+            continue
+        line = re.sub(r'\s+//\s.*$', '', line)  # Trailing comment, never inside 'ws://'
+        if line:
+            lines.append(line)
+    return '\n'.join(lines) + '\n'
+
+
+def minify_html(text):
+    text = re.sub(r'<!--.*?-->', '', text, flags=re.S)
+    text = re.sub(r'(<style>)(.*?)(</style>)', lambda m: m.group(1) + minify_css(m.group(2)) + m.group(3),
+                  text, flags=re.S)
+    text = re.sub(r'>\s+<', '><', text)
+    text = re.sub(r'\s+', ' ', text)
+    return text.strip()
+
+
+def minify(name, text):
+    extension = os.path.splitext(name)[1]
+    if extension == '.css':
+        return minify_css(text)
+    if extension == '.js':
+        return minify_js(text)
+    return minify_html(text)
+
+
+def hashed_path(name, digest):
+    base, extension = os.path.splitext(name)
+    return '/%s.%s%s' % (base, digest[:8], extension)
+
+
+def build():
+    """Returns (name, path, etag, immutable, source size, minified text, compressed data) for every asset."""
+    assets = []
+    links = {}
+    for name, immutable in ASSETS:
+        with open(os.path.join(WEB_DIR, name), encoding='utf-8') as f:
+            source = f.read()
+        text = minify(name, source)
+        for original, path in links.items():
+            text = text.replace('"%s"' % original, '"%s"' % path.lstrip('/'))
+        data = gzip.compress(text.encode('utf-8'), compresslevel=9, mtime=0)
+        if gzip.decompress(data).decode('utf-8') != text:
+            sys.exit('%s: compressed asset does not decompress to the source' % name)
+
+        digest = hashlib.sha256(text.encode('utf-8')).hexdigest()
+        path = hashed_path(name, digest) if immutable else '/' + name
+        if immutable:
+            links[name] = path
+        assets.append((name, path, '"%s"' % digest[:16], immutable, len(source.encode('utf-8')), text, data))
+    return assets
+
+
+def emit(assets):
+    lines = [
+        '// Generated by tools/web_assets.py from include/website/, do not edit.',
+        '#include <string.h>',
+        '#include "../include/web_assets.h"',
+        '',
+    ]
+    for index, (name, path, etag, immutable, size, text, data) in enumerate(assets):
+        lines.append("// '%s', %d bytes gzipped (%d minified, %d source)" % (name, len(data), len(text), size))
+        lines.append('static const uint8_t asset%d[] PROGMEM = {' % index)
+        for row in range(0, len(data), 16):
+            chunk = ', '.join('0x%02x' % b for b in data[row:row + 16])
+            end = '};' if row + 16 >= len(data) else ','
+            lines.append('    ' + chunk + end)
+        lines.append('')
+
+    lines.append('const WebAsset webAssets[] = {')
+    for index, (name, path, etag, immutable, size, text, data) in enumerate(assets):
+        content_type = TYPES[os.path.splitext(name)[1]]
+        lines.append('    {"%s", "%s", "%s", %s, asset%d, %d},' %
+                     (path, content_type, etag.replace('"', '\\"'), 'true' if immutable else 'false', index, len(data)))
+    lines.append('};')
+    lines.append('const size_t webAssetCount = %d;' % len(assets))
+    lines.append('')
+    lines.append('/**')
+    lines.append(' * @brief Returns the asset served at a path, "/" being the index, or NULL.')
+    lines.append(' */')
+    lines.append('const WebAsset *findWebAsset(const char *path)')
+    lines.append('{')
+    lines.append('    if (strcmp(path, "/") == 0)')
+    lines.append('        path = "/index.html";')
+    lines.append('    for (size_t i = 0; i < webAssetCount; i++)')
+    lines.append('    {')
+    lines.append('        if (strcmp(webAssets[i].path, path) == 0)')
+    lines.append('            return &webAssets[i];')
+    lines.append('    }')
+    lines.append('    return NULL;')
+    lines.append('}')
+    lines.append('')
+    return '\n'.join(lines)
+
+
+def generate(check=False, quiet=False):
+    assets = build()
+    if not quiet:
+        for name, path, etag, immutable, size, text, data in assets:
+            print('%-12s %6d -> %5d minified -> %5d gzipped  %s' % (name, size, len(text), len(data), path))
+        print('total        %6d -> %5d gzipped' % (sum(a[4] for a in assets), sum(len(a[6]) for a in assets)))
+
+    output = emit(assets)
+    current = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT) as f:
+            current = f.read()
+    if check:
+        if current != output:
+            sys.exit('%s is out of date, run tools/web_assets.py' % OUTPUT)
+    elif current != output:  # Left untouched otherwise, so it is not rebuilt
+        with open(OUTPUT, 'w') as f:
+            f.write(output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--check', action='store_true', help='verify only, do not write the output file')
+    args = parser.parse_args()
+    generate(args.check)
+
+
+if __name__ == '__main__':
+    main()
+else:
+    generate(quiet=True)  # pre: extra script of PlatformIO